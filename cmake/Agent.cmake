@@ -91,6 +91,40 @@ target_link_libraries(stats
   Folly::folly
 )
 
+add_library(fsdb_stats_delta_generator
+  fboss/agent/FsdbStatsDeltaGenerator.cpp
+)
+
+target_link_libraries(fsdb_stats_delta_generator
+  agent_stats_cpp2
+  fsdb_oper_cpp2
+  thrift_cow_serializer
+  Folly::folly
+  FBThrift::thriftcpp2
+)
+
+add_library(fsdb_state_delta_converter
+  fboss/agent/FsdbStatePathDeltaConverter.cpp
+  fboss/agent/oss/FsdbStateDeltaConverter.cpp
+)
+
+target_link_libraries(fsdb_state_delta_converter
+  state
+  fsdb_oper_cpp2
+  thrift_cow_serializer
+  Folly::folly
+  FBThrift::thriftcpp2
+)
+
+add_library(neighbor_cache_timer_wheel
+  fboss/agent/NeighborCacheTimerWheel.cpp
+)
+
+target_link_libraries(neighbor_cache_timer_wheel
+  fboss_types
+  Folly::folly
+)
+
 add_library(fboss_types
   fboss/agent/types.cpp
   fboss/agent/PortDescriptorTemplate.cpp
@@ -154,7 +188,6 @@ add_library(core
   fboss/agent/oss/PacketLogger.cpp
   fboss/agent/oss/RouteUpdateLogger.cpp
   fboss/agent/oss/SwSwitch.cpp
-  fboss/agent/oss/FsdbStateDeltaConverter.cpp
   fboss/agent/oss/FsdbSyncer.cpp
 )
 
@@ -192,6 +225,9 @@ target_link_libraries(core
   fsdb_stream_client
   fsdb_pub_sub
   fsdb_flags
+  fsdb_state_delta_converter
+  fsdb_stats_delta_generator
+  neighbor_cache_timer_wheel
   ${IPROUTE2}
   ${NETLINK3}
   ${NETLINKROUTE3}
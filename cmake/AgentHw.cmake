@@ -55,6 +55,10 @@ add_library(hw_resource_stats_publisher
   fboss/agent/hw/HwResourceStatsPublisher.cpp
 )
 
+add_library(sflow_v5_exporter
+  fboss/agent/hw/SflowV5Exporter.cpp
+)
+
 target_link_libraries(hw_switch_warmboot_helper
   async_logger
   utils
@@ -107,3 +111,11 @@ target_link_libraries(hw_resource_stats_publisher
   fb303::fb303
   hardware_stats_cpp2
 )
+
+target_link_libraries(sflow_v5_exporter
+  error
+  fboss_types
+  hardware_stats_cpp2
+  sflow_cpp2
+  Folly::folly
+)
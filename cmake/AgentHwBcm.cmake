@@ -102,6 +102,7 @@ add_library(bcm
 target_link_libraries(bcm
   config
   sflow_cpp2
+  sflow_v5_exporter
   hw_switch_warmboot_helper
   hw_switch_stats
   hw_trunk_counters
@@ -194,10 +194,12 @@ add_library(hw_rx_slow_path_rate
 )
 
 target_link_libraries(hw_rx_slow_path_rate
+  bidirectional_packet_stream
   config_factory
   hw_packet_utils
   ecmp_helper
   Folly::folly
+  FBThrift::thriftcpp2
 )
 
 add_library(hw_init_and_exit_benchmark_helper
@@ -67,3 +67,24 @@ set_target_properties(switch_test PROPERTIES COMPILE_FLAGS
 )
 
 gtest_discover_tests(switch_test)
+
+add_executable(sai_next_hop_group_shrink_benchmark
+  fboss/agent/hw/sai/switch/tests/NextHopGroupShrinkBenchmark.cpp
+)
+
+target_link_libraries(sai_next_hop_group_shrink_benchmark
+  sai_platform
+  sai_store
+  sai_switch
+  fake_sai
+  manager_test_base
+  Folly::folly
+  Folly::follybenchmark
+)
+
+set_target_properties(sai_next_hop_group_shrink_benchmark PROPERTIES
+  COMPILE_FLAGS
+  "-DSAI_VER_MAJOR=${SAI_VER_MAJOR} \
+  -DSAI_VER_MINOR=${SAI_VER_MINOR}  \
+  -DSAI_VER_RELEASE=${SAI_VER_RELEASE}"
+)
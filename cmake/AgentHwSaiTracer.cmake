@@ -5,6 +5,7 @@
 
 add_library(sai_tracer
   fboss/agent/hw/sai/tracer/AclApiTracer.cpp
+  fboss/agent/hw/sai/tracer/BinaryTrace.cpp
   fboss/agent/hw/sai/tracer/BridgeApiTracer.cpp
   fboss/agent/hw/sai/tracer/BufferApiTracer.cpp
   fboss/agent/hw/sai/tracer/CounterApiTracer.cpp
@@ -61,3 +62,40 @@ target_link_options(sai_tracer
   "LINKER:-wrap,sai_api_uninitialize"
   "LINKER:-wrap,sai_get_object_key"
 )
+
+add_executable(sai_tracer_benchmark
+  fboss/agent/hw/sai/tracer/tests/SaiTracerBenchmark.cpp
+)
+
+target_link_libraries(sai_tracer_benchmark
+  sai_traced_api
+  fake_sai
+  Folly::folly
+  Folly::follybenchmark
+)
+
+set_target_properties(sai_tracer_benchmark PROPERTIES COMPILE_FLAGS
+  "-DSAI_VER_MAJOR=${SAI_VER_MAJOR} \
+  -DSAI_VER_MINOR=${SAI_VER_MINOR}  \
+  -DSAI_VER_RELEASE=${SAI_VER_RELEASE}"
+)
+
+add_executable(sai_tracer_test
+  fboss/agent/hw/sai/tracer/tests/BinaryTraceTest.cpp
+)
+
+target_link_libraries(sai_tracer_test
+  sai_tracer
+  fake_sai
+  Folly::folly
+  ${GTEST}
+  ${LIBGMOCK_LIBRARIES}
+)
+
+set_target_properties(sai_tracer_test PROPERTIES COMPILE_FLAGS
+  "-DSAI_VER_MAJOR=${SAI_VER_MAJOR} \
+  -DSAI_VER_MINOR=${SAI_VER_MINOR}  \
+  -DSAI_VER_RELEASE=${SAI_VER_RELEASE}"
+)
+
+gtest_discover_tests(sai_tracer_test)
@@ -16,6 +16,52 @@ target_link_libraries(platform_mapping
   ${RE2}
 )
 
+add_executable(platform_mapping_blob_gen
+  fboss/agent/platforms/common/PlatformMappingBlobGen.cpp
+)
+
+target_link_libraries(platform_mapping_blob_gen
+  platform_config_cpp2
+  Folly::folly
+  FBThrift::thriftcpp2
+)
+
+# Compiles the platform mapping JSON into the thrift compact binary blob
+# returned by FUNCTION, and adds it to TARGET's sources, see
+# PlatformMappingBlobGen.cpp
+function(add_platform_mapping_blob TARGET JSON FUNCTION)
+  set(blob_src "${CMAKE_CURRENT_BINARY_DIR}/${JSON}.cpp")
+  get_filename_component(blob_dir ${blob_src} DIRECTORY)
+  add_custom_command(
+    OUTPUT ${blob_src}
+    COMMAND ${CMAKE_COMMAND} -E make_directory ${blob_dir}
+    COMMAND platform_mapping_blob_gen
+      --json=${CMAKE_CURRENT_SOURCE_DIR}/${JSON}
+      --output=${blob_src}
+      --function=${FUNCTION}
+    DEPENDS platform_mapping_blob_gen ${CMAKE_CURRENT_SOURCE_DIR}/${JSON}
+  )
+  target_sources(${TARGET} PRIVATE ${blob_src})
+endfunction()
+
+# Embeds the platform mapping JSON as is, returned by FUNCTION, for tests
+# checking the blob against the JSON it was generated from
+function(add_platform_mapping_json TARGET JSON FUNCTION)
+  set(json_src "${CMAKE_CURRENT_BINARY_DIR}/${JSON}.raw.cpp")
+  get_filename_component(json_dir ${json_src} DIRECTORY)
+  add_custom_command(
+    OUTPUT ${json_src}
+    COMMAND ${CMAKE_COMMAND} -E make_directory ${json_dir}
+    COMMAND platform_mapping_blob_gen
+      --json=${CMAKE_CURRENT_SOURCE_DIR}/${JSON}
+      --output=${json_src}
+      --function=${FUNCTION}
+      --raw_json
+    DEPENDS platform_mapping_blob_gen ${CMAKE_CURRENT_SOURCE_DIR}/${JSON}
+  )
+  target_sources(${TARGET} PRIVATE ${json_src})
+endfunction()
+
 add_library(wedge_led_utils
   fboss/agent/platforms/common/utils/GalaxyLedUtils.cpp
   fboss/agent/platforms/common/utils/Wedge100LedUtils.cpp
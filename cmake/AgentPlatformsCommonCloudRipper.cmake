@@ -10,3 +10,8 @@ add_library(cloud_ripper_platform_mapping
 target_link_libraries(cloud_ripper_platform_mapping
   platform_mapping
 )
+
+add_platform_mapping_blob(cloud_ripper_platform_mapping
+  fboss/agent/platforms/common/cloud_ripper/CloudRipperPlatformMapping.json
+  cloudRipperPlatformMappingBlob
+)
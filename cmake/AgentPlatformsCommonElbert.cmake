@@ -11,3 +11,8 @@ add_library(elbert_platform_mapping
 target_link_libraries(elbert_platform_mapping
   platform_mapping
 )
+
+add_platform_mapping_blob(elbert_platform_mapping
+  fboss/agent/platforms/common/elbert/Elbert16QPimPlatformMapping.json
+  elbert16QPimPlatformMappingBlob
+)
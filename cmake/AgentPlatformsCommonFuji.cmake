@@ -11,3 +11,8 @@ add_library(fuji_platform_mapping
 target_link_libraries(fuji_platform_mapping
   platform_mapping
 )
+
+add_platform_mapping_blob(fuji_platform_mapping
+  fboss/agent/platforms/common/fuji/Fuji16QPimPlatformMapping.json
+  fuji16QPimPlatformMappingBlob
+)
@@ -10,3 +10,8 @@ add_library(kamet_platform_mapping
 target_link_libraries(kamet_platform_mapping
   platform_mapping
 )
+
+add_platform_mapping_blob(kamet_platform_mapping
+  fboss/agent/platforms/common/kamet/KametPlatformMapping.json
+  kametPlatformMappingBlob
+)
@@ -10,3 +10,8 @@ add_library(lassen_platform_mapping
 target_link_libraries(lassen_platform_mapping
   platform_mapping
 )
+
+add_platform_mapping_blob(lassen_platform_mapping
+  fboss/agent/platforms/common/lassen/LassenPlatformMapping.json
+  lassenPlatformMappingBlob
+)
@@ -12,3 +12,13 @@ add_library(sandia_platform_mapping
 target_link_libraries(sandia_platform_mapping
   platform_mapping
 )
+
+add_platform_mapping_blob(sandia_platform_mapping
+  fboss/agent/platforms/common/sandia/Sandia8DDPimPlatformMapping.json
+  sandia8DDPimPlatformMappingBlob
+)
+
+add_platform_mapping_blob(sandia_platform_mapping
+  fboss/agent/platforms/common/sandia/Sandia16QPimPlatformMapping.json
+  sandia16QPimPlatformMappingBlob
+)
@@ -10,3 +10,8 @@ add_library(wedge100_platform_mapping
 target_link_libraries(wedge100_platform_mapping
   platform_mapping
 )
+
+add_platform_mapping_blob(wedge100_platform_mapping
+  fboss/agent/platforms/common/wedge100/Wedge100PlatformMapping.json
+  wedge100PlatformMappingBlob
+)
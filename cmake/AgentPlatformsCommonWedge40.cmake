@@ -10,3 +10,8 @@ add_library(wedge40_platform_mapping
 target_link_libraries(wedge40_platform_mapping
   platform_mapping
 )
+
+add_platform_mapping_blob(wedge40_platform_mapping
+  fboss/agent/platforms/common/wedge40/Wedge40PlatformMapping.json
+  wedge40PlatformMappingBlob
+)
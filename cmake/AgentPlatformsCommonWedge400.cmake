@@ -13,6 +13,21 @@ target_link_libraries(wedge400_platform_mapping
   platform_mapping
 )
 
+add_platform_mapping_blob(wedge400_platform_mapping
+  fboss/agent/platforms/common/wedge400/Wedge400PlatformMapping.json
+  wedge400PlatformMappingBlob
+)
+
+add_platform_mapping_blob(wedge400_platform_mapping
+  fboss/agent/platforms/common/wedge400/Wedge400AcadiaPlatformMapping.json
+  wedge400AcadiaPlatformMappingBlob
+)
+
+add_platform_mapping_blob(wedge400_platform_mapping
+  fboss/agent/platforms/common/wedge400/Wedge400GrandTetonPlatformMapping.json
+  wedge400GrandTetonPlatformMappingBlob
+)
+
 add_library(wedge400_platform_utils
   fboss/agent/platforms/common/wedge400/oss/Wedge400PlatformUtil.cpp
 )  
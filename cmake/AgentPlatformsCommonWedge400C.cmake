@@ -12,6 +12,16 @@ target_link_libraries(wedge400c_platform_mapping
   platform_mapping
 )
 
+add_platform_mapping_blob(wedge400c_platform_mapping
+  fboss/agent/platforms/common/wedge400c/Wedge400CPlatformMapping.json
+  wedge400CPlatformMappingBlob
+)
+
+add_platform_mapping_blob(wedge400c_platform_mapping
+  fboss/agent/platforms/common/wedge400c/Wedge400CGrandTetonPlatformMapping.json
+  wedge400CGrandTetonPlatformMappingBlob
+)
+
 
 add_library(wedge400c_ebb_lab_platform_mapping
     fboss/agent/platforms/common/ebb_lab/Wedge400CEbbLabPlatformMapping.cpp
@@ -21,6 +31,11 @@ target_link_libraries(wedge400c_ebb_lab_platform_mapping
   platform_mapping
 )
 
+add_platform_mapping_blob(wedge400c_ebb_lab_platform_mapping
+  fboss/agent/platforms/common/ebb_lab/Wedge400CEbbLabPlatformMapping.json
+  wedge400CEbbLabPlatformMappingBlob
+)
+
 add_library(wedge400c_platform_utils
   fboss/agent/platforms/common/wedge400c/oss/Wedge400CPlatformUtil.cpp
 )
@@ -43,3 +43,16 @@ target_link_libraries(bcm_led_utils
   error
   Folly::folly
 )
+
+add_executable(platform_mapping_benchmark
+  fboss/agent/platforms/wedge/tests/PlatformMappingBenchmark.cpp
+)
+
+target_link_libraries(platform_mapping_benchmark
+  fuji_platform_mapping
+  sandia_platform_mapping
+  wedge400_platform_mapping
+  yamp_platform_mapping
+  Folly::folly
+  Folly::follybenchmark
+)
@@ -11,3 +11,20 @@ add_library(yamp_platform_mapping
 target_link_libraries(yamp_platform_mapping
   platform_mapping
 )
+
+add_platform_mapping_blob(yamp_platform_mapping
+  fboss/agent/platforms/common/yamp/Yamp16QPimPlatformMapping.json
+  yamp16QPimPlatformMappingBlob
+)
+
+# For tests only, keeps the JSON out of the agent and qsfp_service
+add_library(yamp_platform_mapping_json)
+
+target_link_libraries(yamp_platform_mapping_json
+  Folly::folly
+)
+
+add_platform_mapping_json(yamp_platform_mapping_json
+  fboss/agent/platforms/common/yamp/Yamp16QPimPlatformMapping.json
+  yamp16QPimPlatformMappingJson
+)
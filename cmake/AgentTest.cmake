@@ -83,6 +83,108 @@ target_link_libraries(async_logger_test
 
 gtest_discover_tests(async_logger_test)
 
+add_executable(async_logger_benchmark
+  fboss/agent/test/AsyncLoggerBenchmark.cpp
+)
+
+target_link_libraries(async_logger_benchmark
+  async_logger
+  Folly::folly
+  Folly::follybenchmark
+)
+
+add_executable(fsdb_stats_delta_generator_test
+  fboss/agent/test/oss/Main.cpp
+  fboss/agent/test/FsdbStatsDeltaGeneratorTest.cpp
+)
+
+target_link_libraries(fsdb_stats_delta_generator_test
+  fsdb_stats_delta_generator
+  ${GTEST}
+  ${LIBGMOCK_LIBRARIES}
+)
+
+gtest_discover_tests(fsdb_stats_delta_generator_test)
+
+add_executable(fsdb_state_path_delta_converter_test
+  fboss/agent/test/oss/Main.cpp
+  fboss/agent/test/FsdbStatePathDeltaConverterTest.cpp
+)
+
+target_link_libraries(fsdb_state_path_delta_converter_test
+  fsdb_state_delta_converter
+  ${GTEST}
+  ${LIBGMOCK_LIBRARIES}
+)
+
+gtest_discover_tests(fsdb_state_path_delta_converter_test)
+
+add_executable(neighbor_cache_timer_wheel_test
+  fboss/agent/test/oss/Main.cpp
+  fboss/agent/test/NeighborCacheTimerWheelTest.cpp
+)
+
+target_link_libraries(neighbor_cache_timer_wheel_test
+  neighbor_cache_timer_wheel
+  ${GTEST}
+  ${LIBGMOCK_LIBRARIES}
+)
+
+gtest_discover_tests(neighbor_cache_timer_wheel_test)
+
+add_executable(fsdb_stats_delta_benchmark
+  fboss/agent/test/FsdbStatsDeltaBenchmark.cpp
+)
+
+target_link_libraries(fsdb_stats_delta_benchmark
+  fsdb_stats_delta_generator
+  Folly::folly
+  Folly::follybenchmark
+)
+
+add_executable(fsdb_state_path_delta_benchmark
+  fboss/agent/test/FsdbStatePathDeltaBenchmark.cpp
+)
+
+target_link_libraries(fsdb_state_path_delta_benchmark
+  fsdb_state_delta_converter
+  Folly::folly
+  Folly::follybenchmark
+)
+
+add_executable(switch_state_to_thrift_benchmark
+  fboss/agent/test/SwitchStateToThriftBenchmark.cpp
+)
+
+target_link_libraries(switch_state_to_thrift_benchmark
+  state
+  Folly::folly
+  Folly::follybenchmark
+)
+
+add_executable(sflow_v5_exporter_test
+  fboss/agent/test/oss/Main.cpp
+  fboss/agent/test/SflowV5ExporterTest.cpp
+)
+
+target_link_libraries(sflow_v5_exporter_test
+  sflow_v5_exporter
+  ${GTEST}
+  ${LIBGMOCK_LIBRARIES}
+)
+
+gtest_discover_tests(sflow_v5_exporter_test)
+
+add_executable(sflow_v5_exporter_benchmark
+  fboss/agent/test/SflowV5ExporterBenchmark.cpp
+)
+
+target_link_libraries(sflow_v5_exporter_benchmark
+  sflow_v5_exporter
+  Folly::folly
+  Folly::follybenchmark
+)
+
 add_library(agent_test_lib
   fboss/agent/test/AgentTest.cpp
 )
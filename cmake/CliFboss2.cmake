@@ -242,6 +242,7 @@ add_executable(fboss2
   fboss/cli/fboss2/utils/CmdUtils.cpp
   fboss/cli/fboss2/utils/CLIParserUtils.cpp
   fboss/cli/fboss2/utils/CmdClientUtils.cpp
+  fboss/cli/fboss2/utils/HostQueryExecutor.cpp
   fboss/cli/fboss2/utils/Table.cpp
   fboss/cli/fboss2/utils/HostInfo.h
   fboss/cli/fboss2/utils/FilterOp.h
@@ -294,6 +295,30 @@ target_link_libraries(fboss2
   ${RE2}
 )
 
+add_executable(fboss2_host_query_benchmark
+  fboss/cli/fboss2/CmdGlobalOptions.cpp
+  fboss/cli/fboss2/oss/CmdGlobalOptions.cpp
+  fboss/cli/fboss2/test/HostQueryExecutorBenchmark.cpp
+  fboss/cli/fboss2/utils/CmdClientUtils.cpp
+  fboss/cli/fboss2/utils/CmdUtils.cpp
+  fboss/cli/fboss2/utils/HostQueryExecutor.cpp
+  fboss/cli/fboss2/utils/PrbsUtils.cpp
+  fboss/cli/fboss2/utils/oss/CmdClientUtils.cpp
+  fboss/cli/fboss2/utils/oss/CmdUtils.cpp
+)
+
+target_link_libraries(fboss2_host_query_benchmark
+  CLI11::CLI11
+  ctrl_cpp2
+  qsfp_cpp2
+  phy_cpp2
+  cli_model
+  Folly::folly
+  Folly::follybenchmark
+  FBThrift::thriftcpp2
+  ${RE2}
+)
+
 add_library(tabulate
   fboss/cli/fboss2/tabulate/asciidoc_exporter.hpp
   fboss/cli/fboss2/tabulate/cell.hpp
@@ -12,3 +12,36 @@ target_link_libraries(fsdb_oper_metadata_tracker
   fsdb_common_cpp2
   fsdb_oper_cpp2
 )
+
+add_library(fsdb_subscription_path_index
+  fboss/fsdb/server/SubscriptionPathIndex.cpp
+)
+
+target_link_libraries(fsdb_subscription_path_index
+  Folly::folly
+  fsdb_common_cpp2
+  fsdb_oper_cpp2
+  ${RE2}
+)
+
+add_executable(fsdb_subscription_path_index_test
+  fboss/fsdb/server/test/SubscriptionPathIndexTest.cpp
+)
+
+target_link_libraries(fsdb_subscription_path_index_test
+  fsdb_subscription_path_index
+  ${GTEST}
+  ${LIBGMOCK_LIBRARIES}
+)
+
+gtest_discover_tests(fsdb_subscription_path_index_test)
+
+add_executable(fsdb_subscription_path_index_benchmark
+  fboss/fsdb/server/test/SubscriptionPathIndexBenchmark.cpp
+)
+
+target_link_libraries(fsdb_subscription_path_index_benchmark
+  fsdb_subscription_path_index
+  Folly::folly
+  Folly::follybenchmark
+)
@@ -26,8 +26,10 @@ target_link_libraries(fan_service_lib
   common_file_utils
   platform_utils
   fan_config_structs_types_cpp2
+  sensor_shm_table
   Folly::folly
   FBThrift::thriftcpp2
+  fb303::fb303
   qsfp_cache
   fsdb_stream_client
   fsdb_pub_sub
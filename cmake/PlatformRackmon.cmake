@@ -46,6 +46,7 @@ target_link_libraries(rackmon
 add_executable(rackmon_test
   fboss/platform/rackmon/tests/DeviceTest.cpp
   fboss/platform/rackmon/tests/TempDir.h
+  fboss/platform/rackmon/tests/SimulatedUARTDevice.h
   fboss/platform/rackmon/tests/ModbusCmdsTest.cpp
   fboss/platform/rackmon/tests/ModbusDeviceTest.cpp
   fboss/platform/rackmon/tests/ModbusTest.cpp
@@ -74,3 +75,17 @@ target_include_directories(rackmon_test PRIVATE
 )
 
 target_compile_definitions(rackmon_test PRIVATE __TEST__=1)
+
+add_executable(rackmon_poll_benchmark
+  fboss/platform/rackmon/tests/RackmonPollBenchmark.cpp
+)
+
+target_link_libraries(rackmon_poll_benchmark
+  rackmon_lib
+)
+
+target_include_directories(rackmon_poll_benchmark PRIVATE
+  fboss/platform/rackmon
+)
+
+target_compile_definitions(rackmon_poll_benchmark PRIVATE __TEST__=1)
@@ -3,6 +3,16 @@
 # In general, libraries and binaries in fboss/foo/bar are built by
 # cmake/FooBar.cmake
 
+add_library(sensor_shm_table
+  fboss/platform/sensor_service/SensorShmTable.cpp
+)
+
+target_link_libraries(sensor_shm_table
+  sensor_service_cpp2
+  Folly::folly
+  rt
+)
+
 add_library(sensor_service_lib
   fboss/platform/sensor_service/GetSensorConfig.cpp
   fboss/platform/sensor_service/FsdbSyncer.cpp
@@ -22,6 +32,7 @@ target_link_libraries(sensor_service_lib
   platform_utils
   sensor_service_cpp2
   sensor_config_cpp2
+  sensor_shm_table
   Folly::folly
   FBThrift::thriftcpp2
   fsdb_stream_client
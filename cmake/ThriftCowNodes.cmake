@@ -6,11 +6,9 @@
 
 add_library(
   thrift_cow_serializer
-  fboss/thrift_cow/nodes/Serializer.h
+  fboss/thrift_cow/nodes/Serializer.cpp
 )
 
-set_target_properties(thrift_cow_serializer PROPERTIES LINKER_LANGUAGE CXX)
-
 target_link_libraries(thrift_cow_serializer
   fsdb_oper_cpp2
   Folly::folly
@@ -19,6 +17,7 @@ target_link_libraries(thrift_cow_serializer
 
 add_library(
   thrift_cow_nodes
+  fboss/thrift_cow/nodes/Hamt.h
   fboss/thrift_cow/nodes/ThriftListNode-inl.h
   fboss/thrift_cow/nodes/ThriftMapNode-inl.h
   fboss/thrift_cow/nodes/ThriftPrimitiveNode-inl.h
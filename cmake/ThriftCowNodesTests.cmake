@@ -14,6 +14,7 @@ add_fbthrift_cpp_library(
 )
 
 add_executable(thrift_node_tests
+  fboss/thrift_cow/nodes/tests/HamtTests.cpp
   fboss/thrift_cow/nodes/tests/ThriftStructNodeTests.cpp
 )
 
@@ -32,3 +33,26 @@ target_link_libraries(thrift_node_tests
 )
 
 gtest_discover_tests(thrift_node_tests)
+
+add_executable(thrift_cow_hamt_benchmark
+  fboss/thrift_cow/nodes/tests/HamtBenchmark.cpp
+)
+
+target_link_libraries(thrift_cow_hamt_benchmark
+    thrift_cow_nodes
+    Folly::folly
+    Folly::follybenchmark
+)
+
+add_executable(thrift_cow_encode_benchmark
+  fboss/thrift_cow/nodes/tests/EncodeBenchmark.cpp
+)
+
+target_link_libraries(thrift_cow_encode_benchmark
+    thrift_cow_test_cpp2
+    switch_config_cpp2
+    thrift_cow_nodes
+    thrift_cow_serializer
+    Folly::folly
+    Folly::follybenchmark
+)
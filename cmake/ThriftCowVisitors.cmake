@@ -9,6 +9,7 @@ add_library(
   fboss/thrift_cow/visitors/DeltaVisitor.h
   fboss/thrift_cow/visitors/ExtendedPathVisitor.h
   fboss/thrift_cow/visitors/ExtendedPathVisitor.h
+  fboss/thrift_cow/visitors/ParallelDeltaVisitor.h
   fboss/thrift_cow/visitors/PathVisitor.h
   fboss/thrift_cow/visitors/RecurseVisitor.h
 )
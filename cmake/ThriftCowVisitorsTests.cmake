@@ -24,3 +24,17 @@ target_link_libraries(thrift_cow_visitor_tests
 )
 
 gtest_discover_tests(thrift_node_tests)
+
+add_executable(thrift_cow_delta_visitor_benchmark
+  fboss/thrift_cow/visitors/tests/DeltaVisitorBenchmark.cpp
+)
+
+target_link_libraries(thrift_cow_delta_visitor_benchmark
+    switch_config_cpp2
+    thrift_cow_nodes
+    thrift_cow_test_cpp2
+    thrift_cow_visitors
+    Folly::folly
+    Folly::follybenchmark
+    FBThrift::thriftcpp2
+)
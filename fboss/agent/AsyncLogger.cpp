@@ -15,10 +15,13 @@
 #include <iostream>
 
 #include "fboss/agent/AsyncLogger.h"
+#include "fboss/agent/FbossError.h"
 #include "fboss/agent/SysError.h"
 
 #include <fb303/ServiceData.h>
 #include <folly/FileUtil.h>
+#include <folly/lang/Align.h>
+#include <folly/logging/xlog.h>
 #include <gflags/gflags.h>
 
 DEFINE_bool(
@@ -26,6 +29,27 @@ DEFINE_bool(
     false,
     "Flag to indicate whether to disable async logging and directly write into the file");
 
+DEFINE_bool(
+    async_logger_nonblocking,
+    false,
+    "Append logs to a ring of buffers without taking any lock, so that "
+    "threads logging never wait on the log file being written. See "
+    "--async_logger_overflow_policy for what happens when all buffers fill up");
+
+DEFINE_int32(
+    async_logger_num_buffers,
+    8,
+    "Number of buffers in --async_logger_nonblocking mode, each of "
+    "AsyncLogger::kBufferSize bytes");
+
+DEFINE_string(
+    async_logger_overflow_policy,
+    "drop",
+    "What to do in --async_logger_nonblocking mode when all buffers are "
+    "waiting to be flushed: drop - drop the log and count it, "
+    "wait - spin until a buffer is flushed. The SAI replayer log always "
+    "waits, as it cannot be replayed with records missing");
+
 enum BufferToWrite { BUFFER0, BUFFER1 };
 
 static std::string exitFilePath;
@@ -38,11 +62,71 @@ static std::mutex bootTypeLatch_;
 
 namespace {
 
+/*
+ * Buffer of the ring used in --async_logger_nonblocking mode.
+ *
+ * Appending reserves space by bumping reserved, copies the log and then
+ * bumps committed. The first append that doesn't fit (and the flush thread
+ * on timeout, by reserving more than the buffer size) seals the buffer:
+ * it records the bytes in use and marks it pending, handing the buffer
+ * over to the flush thread once committed catches up with used. The head
+ * then moves on to the next buffer, if that one was flushed already.
+ *
+ * Buffers other than the head are kept closed, so that appends racing
+ * with the head moving on can't land in a buffer flushed after a later
+ * append from the same thread.
+ */
+struct alignas(folly::hardware_destructive_interference_size) RingBuffer {
+  char* data{nullptr};
+  std::atomic<uint64_t> reserved{0};
+  std::atomic<uint64_t> committed{0};
+  // Only valid once pending is set
+  uint64_t used{0};
+  std::atomic<bool> pending{false};
+};
+
+} // namespace
+
+// Reserved bytes of closed buffers, any append fails to fit
+static constexpr uint64_t kRingBufferClosed = uint64_t(1) << 62;
+
+// Statics for the same reason as the double buffer, see kBufferSize
+static RingBuffer* ring = nullptr;
+static uint32_t ringSize = 0;
+static bool ringEnabled = false;
+// Buffer being appended to, and the next one to flush
+static std::atomic<uint64_t> ringHead{0};
+static std::atomic<uint64_t> ringTail{0};
+
+namespace {
+
 constexpr auto kBuildRevision = "build_revision";
 constexpr auto kSdkVersion = "SDK Version";
 
+void writeRingOnTerminate() {
+  std::ofstream logfile;
+  logfile.open(exitFilePath, std::ofstream::app);
+  uint64_t bytes = 0;
+  auto head = ringHead.load();
+  for (auto i = ringTail.load(); i <= head; ++i) {
+    auto& buffer = ring[i % ringSize];
+    // Appends still copying can't be told apart, so write whatever was
+    // committed.
+    auto size = std::min<uint64_t>(
+        buffer.committed.load(), facebook::fboss::AsyncLogger::kBufferSize);
+    logfile.write(buffer.data, size);
+    bytes += size;
+  }
+  if (bytes > 0) {
+    std::cerr << "Async logger exit with " << bytes
+              << " bytes written to file " << std::endl;
+  }
+}
+
 void terminateHandler() {
-  if (offset > 0) {
+  if (ringEnabled) {
+    writeRingOnTerminate();
+  } else if (offset > 0) {
     // Use standard library instead of folly because in unclean exit, folly
     // library could be inaccessible so there's a higher chance of writing into
     // file using standard library.
@@ -72,6 +156,16 @@ void terminateHandler() {
 
 bool isWarmBoot;
 
+std::string counterPrefix(facebook::fboss::AsyncLogger::LoggerSrcType srcType) {
+  switch (srcType) {
+    case facebook::fboss::AsyncLogger::BCM_CINTER:
+      return "async_logger.bcm_cinter";
+    case facebook::fboss::AsyncLogger::SAI_REPLAYER:
+      return "async_logger.sai_replayer";
+  }
+  return "async_logger";
+}
+
 } // namespace
 
 namespace facebook::fboss {
@@ -86,6 +180,44 @@ AsyncLogger::AsyncLogger(
     logBuffer_ = buffer0.data();
     flushBuffer_ = buffer1.data();
 
+    ringEnabled = FLAGS_async_logger_nonblocking;
+    if (FLAGS_async_logger_nonblocking) {
+      nonBlocking_ = true;
+      if (FLAGS_async_logger_overflow_policy == "wait") {
+        overflowPolicy_ = OverflowPolicy::WAIT;
+      } else if (FLAGS_async_logger_overflow_policy != "drop") {
+        throw FbossError(
+            "Invalid --async_logger_overflow_policy ",
+            FLAGS_async_logger_overflow_policy);
+      }
+      // A replayer log with gaps cannot be replayed, never drop its records
+      if (srcType_ == SAI_REPLAYER &&
+          overflowPolicy_ == OverflowPolicy::DROP) {
+        XLOG(WARN) << "SAI replayer logs are never dropped, using the "
+                      << "wait overflow policy for them";
+        overflowPolicy_ = OverflowPolicy::WAIT;
+      }
+      if (FLAGS_async_logger_num_buffers < 2) {
+        throw FbossError("--async_logger_num_buffers needs to be at least 2");
+      }
+      // Like the double buffer, the ring outlives the logger so that the
+      // terminate handler can write it out. It is only ever grown.
+      if (ringSize < static_cast<uint32_t>(FLAGS_async_logger_num_buffers)) {
+        ring = new RingBuffer[FLAGS_async_logger_num_buffers];
+        ringSize = FLAGS_async_logger_num_buffers;
+        for (uint32_t i = 0; i < ringSize; ++i) {
+          ring[i].data = new char[kBufferSize];
+        }
+      }
+      for (uint32_t i = 0; i < ringSize; ++i) {
+        ring[i].reserved = i ? kRingBufferClosed : 0;
+        ring[i].committed = 0;
+        ring[i].pending = false;
+      }
+      ringHead = 0;
+      ringTail = 0;
+    }
+
     exitFilePath = filePath;
 
     logTimeout_ = std::chrono::milliseconds(logTimeout);
@@ -128,15 +260,7 @@ void AsyncLogger::worker_thread() {
 
     // Write content in swap buffer to file
     if (currSize > 0) {
-      flushCount_++;
-      auto bytesWritten = logFile_.withWLock([&](auto& lockedFile) {
-        return folly::writeFull(lockedFile.fd(), writeBuffer, currSize);
-      });
-
-      if (bytesWritten < 0) {
-        throw SysError(
-            errno, "error writing ", currSize, " bytes to log file.");
-      }
+      writeToFile(writeBuffer, currSize);
     }
 
     memset(writeBuffer, 0, bufferSize_);
@@ -151,14 +275,207 @@ void AsyncLogger::worker_thread() {
   }
 }
 
-void AsyncLogger::startFlushThread() {
+void AsyncLogger::writeToFile(const char* data, size_t size) {
+  flushCount_++;
+  auto start = std::chrono::steady_clock::now();
+  auto bytesWritten = logFile_.withWLock([&](auto& lockedFile) {
+    return folly::writeFull(lockedFile.fd(), data, size);
+  });
+
+  if (bytesWritten < 0) {
+    throw SysError(errno, "error writing ", size, " bytes to log file.");
+  }
+
+  auto prefix = counterPrefix(srcType_);
+  fb303::fbData->addStatValue(prefix + ".bytes", size, fb303::SUM);
+  fb303::fbData->addStatValue(
+      prefix + ".flush_latency_us",
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - start)
+          .count(),
+      fb303::AVG);
+}
+
+void AsyncLogger::ringWorkerThread() {
+  while (enableLogging_) {
+    bool timedOut;
+    bool flushRequested;
+    {
+      std::unique_lock<std::mutex> lock(latch_);
+      timedOut = !cv_.wait_for(lock, logTimeout_, [this] {
+        return this->forceFlush_ || ring[ringTail % ringSize].pending;
+      });
+      flushRequested = forceFlush_;
+    }
+
+    // Hand over whatever got appended since the last flush, full buffers
+    // get sealed by the appends that don't fit
+    if (timedOut || flushRequested) {
+      sealRingHead();
+    }
+    flushRing();
+
+    // Export drops from here rather than on the append path
+    auto drops = dropCount_.load(std::memory_order_relaxed);
+    if (drops != exportedDropCount_) {
+      fb303::fbData->addStatValue(
+          counterPrefix(srcType_) + ".drops",
+          drops - exportedDropCount_,
+          fb303::SUM);
+      exportedDropCount_ = drops;
+    }
+
+    // Notify force flush that write completes. A request coming in after
+    // the head got sealed is handled on the next iteration.
+    if (flushRequested) {
+      forceFlush_ = false;
+      promise_.set_value(0);
+      promise_ = std::promise<int>();
+    }
+  }
+}
+
+namespace {
+
+void advanceRingHead(uint64_t head) {
+  if (ringHead.compare_exchange_strong(head, head + 1)) {
+    ring[(head + 1) % ringSize].reserved.store(0, std::memory_order_release);
+  }
+}
+
+void sealRingBuffer(uint64_t head, uint64_t used) {
+  auto& buffer = ring[head % ringSize];
+  buffer.used = used;
+  // Pairs with the flush thread clearing pending on the next buffer and
+  // then checking this one, so that one of us moves the head along.
+  buffer.pending.store(true, std::memory_order_seq_cst);
+  if (!ring[(head + 1) % ringSize].pending.load(std::memory_order_seq_cst)) {
+    advanceRingHead(head);
+  }
+}
+
+} // namespace
+
+void AsyncLogger::sealRingHead() {
+  auto head = ringHead.load();
+  auto& buffer = ring[head % ringSize];
+  if (!buffer.reserved.load()) {
+    return;
+  }
+  // Reserve the rest of the buffer, so that later appends move on
+  auto used = buffer.reserved.fetch_add(kBufferSize + 1);
+  if (used <= kBufferSize) {
+    sealRingBuffer(head, used);
+  }
+}
+
+void AsyncLogger::flushRing() {
+  while (ring[ringTail % ringSize].pending) {
+    auto& buffer = ring[ringTail % ringSize];
+    // Wait for appends still copying into the buffer
+    while (buffer.committed.load(std::memory_order_acquire) < buffer.used) {
+      std::this_thread::yield();
+    }
+    if (buffer.used > 0) {
+      writeToFile(buffer.data, buffer.used);
+    }
+
+    // Closed until it becomes the head again
+    buffer.used = 0;
+    buffer.committed = 0;
+    buffer.reserved.store(kRingBufferClosed, std::memory_order_release);
+    buffer.pending.store(false, std::memory_order_seq_cst);
+    ++ringTail;
+
+    // The head may be sealed, waiting on this buffer to be flushed
+    auto head = ringHead.load(std::memory_order_seq_cst);
+    if (ring[head % ringSize].pending.load(std::memory_order_seq_cst) &&
+        !ring[(head + 1) % ringSize].pending.load(std::memory_order_seq_cst)) {
+      advanceRingHead(head);
+    }
+  }
+}
+
+void AsyncLogger::notifyRingWorker() {
+  // The flush thread checks for pending buffers under the latch before
+  // waiting, taking it here makes sure the notification isn't lost in
+  // between.
+  {
+    std::lock_guard<std::mutex> lock(latch_);
+  }
+  cv_.notify_one();
+}
+
+void AsyncLogger::writeBehindRing(
+    uint64_t head,
+    const char* logRecord,
+    size_t logSize) {
+  // Logs appended earlier are in the sealed head or the buffers before it
+  while (ringTail.load(std::memory_order_acquire) <= head) {
+    std::this_thread::yield();
+  }
+  writeToFile(logRecord, logSize);
+}
+
+void AsyncLogger::appendToRing(const char* logRecord, size_t logSize) {
+  if (logSize == 0) {
+    return;
+  }
+  if (logSize > kBufferSize && overflowPolicy_ == OverflowPolicy::DROP) {
+    // Can never fit
+    XLOG_EVERY_MS(ERR, 1000) << "Dropping log of " << logSize
+                             << " bytes, larger than a buffer";
+    dropCount_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  while (true) {
+    auto head = ringHead.load(std::memory_order_acquire);
+    auto& buffer = ring[head % ringSize];
+    auto offset = buffer.reserved.fetch_add(logSize);
+    if (offset + logSize <= kBufferSize) {
+      memcpy(buffer.data + offset, logRecord, logSize);
+      buffer.committed.fetch_add(logSize, std::memory_order_release);
+      return;
+    }
+    if (offset <= kBufferSize) {
+      // First append not fitting, hand the buffer over to the flush thread
+      sealRingBuffer(head, offset);
+      notifyRingWorker();
+    }
+    if (logSize > kBufferSize &&
+        (offset <= kBufferSize ||
+         ringHead.load(std::memory_order_acquire) != head)) {
+      // Can never fit, write it out once the sealed head is flushed
+      writeBehindRing(head, logRecord, logSize);
+      return;
+    }
+    if (ringHead.load(std::memory_order_acquire) != head ||
+        !ring[(head + 1) % ringSize].pending.load(std::memory_order_acquire)) {
+      // The head moved on, or is about to
+      std::this_thread::yield();
+      continue;
+    }
+    // Every buffer is waiting to be flushed
+    if (overflowPolicy_ == OverflowPolicy::DROP) {
+      dropCount_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    std::this_thread::yield();
+  }
+}
+
+void AsyncLogger::startFlushThread(bool writeBootHeader) {
   enableLogging_ = true;
   if (!FLAGS_disable_async_logger) {
-    flushThread_ = new std::thread(&AsyncLogger::worker_thread, this);
+    flushThread_ = nonBlocking_
+        ? new std::thread(&AsyncLogger::ringWorkerThread, this)
+        : new std::thread(&AsyncLogger::worker_thread, this);
   }
   // Write new boot header and the current time whenever a cold/warm boot
   // happens
-  writeNewBootHeader();
+  if (writeBootHeader) {
+    writeNewBootHeader();
+  }
 }
 
 void AsyncLogger::stopFlushThread() {
@@ -197,6 +514,11 @@ void AsyncLogger::appendLog(const char* logRecord, size_t logSize) {
     return;
   }
 
+  if (nonBlocking_) {
+    appendToRing(logRecord, logSize);
+    return;
+  }
+
   // Acquire the lock and check if there's enough space in the buffer
   latch_.lock();
 
@@ -266,7 +588,7 @@ void AsyncLogger::openLogFile(std::string& filePath) {
              << filePath;
 }
 
-void AsyncLogger::writeNewBootHeader() {
+std::string AsyncLogger::getBootHeader() {
   // Log current time and boot type
   auto now = std::chrono::system_clock::now();
   auto timer = std::chrono::system_clock::to_time_t(now);
@@ -277,8 +599,6 @@ void AsyncLogger::writeNewBootHeader() {
   std::ostringstream oss;
   oss << "// Start of a " << bootType << " "
       << std::put_time(&tm, "%Y-%m-%d %T") << std::endl;
-  auto ossString = oss.str();
-  appendLog(ossString.c_str(), ossString.size());
 
   // Log commit ID and SDK version
   std::string commitId;
@@ -291,9 +611,14 @@ void AsyncLogger::writeNewBootHeader() {
       std::remove(sdkVersion.begin(), sdkVersion.end(), '\n'),
       sdkVersion.end());
 
-  std::string agentVersion = folly::to<std::string>(
-      "// Commit id : ", commitId, "\n", "// SDK version : ", sdkVersion, "\n");
-  appendLog(agentVersion.c_str(), agentVersion.size());
+  oss << "// Commit id : " << commitId << "\n"
+      << "// SDK version : " << sdkVersion << "\n";
+  return oss.str();
+}
+
+void AsyncLogger::writeNewBootHeader() {
+  auto header = getBootHeader();
+  appendLog(header.c_str(), header.size());
 }
 
 } // namespace facebook::fboss
@@ -47,7 +47,11 @@ class AsyncLogger {
    */
   static auto constexpr kBufferSize = 409600;
 
-  void startFlushThread();
+  /*
+   * Loggers not writing plain text can skip the boot header comment lines
+   * and log getBootHeader() in their own format instead.
+   */
+  void startFlushThread(bool writeBootHeader = true);
   void stopFlushThread();
   void forceFlush();
 
@@ -55,16 +59,49 @@ class AsyncLogger {
 
   static void setBootType(bool canWarmBoot);
 
+  // Comment lines with the boot type, time, commit id and SDK version
+  static std::string getBootHeader();
+
+  /*
+   * What appendLog does in --async_logger_nonblocking mode when all buffers
+   * are waiting to be flushed.
+   */
+  enum class OverflowPolicy {
+    // Drop the log record, counting it in the drops stat
+    DROP,
+    // Spin until the flush thread frees up a buffer, never losing records.
+    // Records larger than a buffer get written out by the appending thread
+    // once everything before them is flushed.
+    WAIT,
+  };
+
   // Expose these variables for testing purpose
   uint32_t getFlushCount() {
     return flushCount_;
   }
+  uint64_t getDropCount() {
+    return dropCount_;
+  }
+  // Flushes block on writing the log file while this is held
+  auto lockLogFileForTesting() {
+    return logFile_.wlock();
+  }
 
  private:
   std::atomic_uint32_t flushCount_{0};
+  std::atomic_uint64_t dropCount_{0};
   void worker_thread();
   void openLogFile(std::string& file_path);
   void writeNewBootHeader();
+  void writeToFile(const char* data, size_t size);
+
+  // --async_logger_nonblocking mode, see AsyncLogger.cpp
+  void appendToRing(const char* logRecord, size_t logSize);
+  void ringWorkerThread();
+  void sealRingHead();
+  void flushRing();
+  void notifyRingWorker();
+  void writeBehindRing(uint64_t head, const char* logRecord, size_t logSize);
 
   std::atomic_bool forceFlush_{false};
   bool fullFlush_{false};
@@ -76,6 +113,10 @@ class AsyncLogger {
   char* flushBuffer_;
 
   LoggerSrcType srcType_;
+  bool nonBlocking_{false};
+  OverflowPolicy overflowPolicy_{OverflowPolicy::DROP};
+  // Drops already exported to fb303
+  uint64_t exportedDropCount_{0};
 
   std::promise<int> promise_;
   std::future<int> future_;
@@ -0,0 +1,111 @@
+// Copyright 2004-present Facebook. All Rights Reserved.
+
+#include "fboss/agent/FsdbStatePathDeltaConverter.h"
+#include "fboss/agent/FsdbThriftDeltaBuilder.h"
+#include "fboss/agent/state/SwitchState.h"
+#include "fboss/agent/state/VlanMapDelta.h"
+
+#include <folly/Conv.h>
+
+namespace facebook::fboss {
+
+namespace {
+
+// Vlan attributes, with the neighbor and MAC tables left out as those are
+// converted per entry
+state::VlanFields vlanFieldsWithoutTables(const Vlan& vlan) {
+  auto fields = *vlan.getFields();
+  fields.arpTable = std::make_shared<ArpTable>();
+  fields.ndpTable = std::make_shared<NdpTable>();
+  fields.macTable = std::make_shared<MacTable>();
+  return fields.toThrift();
+}
+
+} // namespace
+
+FsdbStatePathDeltaConverter::FsdbStatePathDeltaConverter(
+    std::vector<std::string> switchStatePath)
+    : switchStatePath_(std::move(switchStatePath)) {}
+
+std::vector<fsdb::OperDeltaUnit> FsdbStatePathDeltaConverter::computeDeltas(
+    const StateDelta& stateDelta) const {
+  const auto& oldState = stateDelta.oldState();
+  const auto& newState = stateDelta.newState();
+  if (oldState->getVlans() == newState->getVlans()) {
+    return nodeConverter_.computeDeltas(stateDelta);
+  }
+
+  // Have the node converter see everything but the vlans
+  auto withOldVlans = newState->clone();
+  withOldVlans->resetVlans(oldState->getVlans());
+  auto deltas =
+      nodeConverter_.computeDeltas(StateDelta(oldState, withOldVlans));
+  processVlanMapDelta(deltas, stateDelta.getVlansDelta());
+  return deltas;
+}
+
+void FsdbStatePathDeltaConverter::processVlanMapDelta(
+    std::vector<fsdb::OperDeltaUnit>& deltas,
+    const VlanMapDelta& vlanMapDelta) const {
+  for (const auto& vlanDelta : vlanMapDelta) {
+    const auto& oldVlan = vlanDelta.getOld();
+    const auto& newVlan = vlanDelta.getNew();
+    auto vlanId = oldVlan ? oldVlan->getID() : newVlan->getID();
+    auto path = switchStatePath_;
+    path.emplace_back("vlanMap");
+    path.push_back(folly::to<std::string>(static_cast<int16_t>(vlanId)));
+
+    if (!oldVlan || !newVlan) {
+      addNodeDelta(deltas, std::move(path), oldVlan, newVlan);
+      continue;
+    }
+    FsdbThriftDeltaBuilder(path, deltas, true /* withOldState */)
+        .diff<apache::thrift::type_class::structure>(
+            vlanFieldsWithoutTables(*oldVlan),
+            vlanFieldsWithoutTables(*newVlan));
+
+    path.emplace_back("arpTable");
+    processEntryMapDelta(deltas, vlanDelta.getArpDelta(), path);
+    path.back() = "ndpTable";
+    processEntryMapDelta(deltas, vlanDelta.getNdpDelta(), path);
+    path.back() = "macTable";
+    processEntryMapDelta(deltas, vlanDelta.getMacDelta(), path);
+  }
+}
+
+template <typename Map>
+void FsdbStatePathDeltaConverter::processEntryMapDelta(
+    std::vector<fsdb::OperDeltaUnit>& deltas,
+    const NodeMapDelta<Map>& mapDelta,
+    const std::vector<std::string>& basePath) const {
+  for (const auto& entryDelta : mapDelta) {
+    const auto& oldEntry = entryDelta.getOld();
+    const auto& newEntry = entryDelta.getNew();
+    auto path = basePath;
+    path.push_back(folly::to<std::string>(
+        Map::getNodeThriftKey(oldEntry ? oldEntry : newEntry)));
+    addNodeDelta(deltas, std::move(path), oldEntry, newEntry);
+  }
+}
+
+template <typename Node>
+void FsdbStatePathDeltaConverter::addNodeDelta(
+    std::vector<fsdb::OperDeltaUnit>& deltas,
+    std::vector<std::string> path,
+    const std::shared_ptr<Node>& oldNode,
+    const std::shared_ptr<Node>& newNode) const {
+  using TC = apache::thrift::type_class::structure;
+  fsdb::OperDeltaUnit unit;
+  unit.path()->raw() = std::move(path);
+  if (oldNode) {
+    unit.oldState() = thrift_cow::serialize<TC>(
+        FsdbThriftDeltaBuilder::kProtocol, oldNode->getFields()->toThrift());
+  }
+  if (newNode) {
+    unit.newState() = thrift_cow::serialize<TC>(
+        FsdbThriftDeltaBuilder::kProtocol, newNode->getFields()->toThrift());
+  }
+  deltas.push_back(std::move(unit));
+}
+
+} // namespace facebook::fboss
@@ -0,0 +1,55 @@
+// Copyright 2004-present Facebook. All Rights Reserved.
+
+#pragma once
+
+#include "fboss/agent/FsdbStateDeltaConverter.h"
+#include "fboss/agent/state/StateDelta.h"
+#include "fboss/fsdb/if/gen-cpp2/fsdb_oper_types.h"
+
+#include <string>
+#include <vector>
+
+namespace facebook::fboss {
+
+/*
+ * Converts a StateDelta into fsdb deltas at the granularity of the nodes
+ * that changed, instead of re-encoding whole subtrees of SwitchState.
+ *
+ * Vlans are where this matters: with tens of thousands of neighbors, a
+ * single ARP, NDP or MAC entry changing would otherwise get the whole Vlan
+ * encoded. Here, only the changed entries are encoded, each under its own
+ * path, and vlan attributes outside of these tables are diffed per leaf.
+ * Changes to the rest of SwitchState are left to FsdbStateDeltaConverter.
+ */
+class FsdbStatePathDeltaConverter {
+ public:
+  explicit FsdbStatePathDeltaConverter(
+      std::vector<std::string> switchStatePath);
+
+  std::vector<fsdb::OperDeltaUnit> computeDeltas(
+      const StateDelta& stateDelta) const;
+
+ private:
+  void processVlanMapDelta(
+      std::vector<fsdb::OperDeltaUnit>& deltas,
+      const VlanMapDelta& vlanMapDelta) const;
+
+  // creates a delta for each entry that changed in the table
+  template <typename Map>
+  void processEntryMapDelta(
+      std::vector<fsdb::OperDeltaUnit>& deltas,
+      const NodeMapDelta<Map>& mapDelta,
+      const std::vector<std::string>& basePath) const;
+
+  template <typename Node>
+  void addNodeDelta(
+      std::vector<fsdb::OperDeltaUnit>& deltas,
+      std::vector<std::string> path,
+      const std::shared_ptr<Node>& oldNode,
+      const std::shared_ptr<Node>& newNode) const;
+
+  const std::vector<std::string> switchStatePath_;
+  FsdbStateDeltaConverter nodeConverter_;
+};
+
+} // namespace facebook::fboss
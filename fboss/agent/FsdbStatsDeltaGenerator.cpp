@@ -0,0 +1,40 @@
+// Copyright 2004-present Facebook. All Rights Reserved.
+
+#include "fboss/agent/FsdbStatsDeltaGenerator.h"
+
+#include "fboss/agent/FsdbThriftDeltaBuilder.h"
+#include "fboss/agent/gen-cpp2/agent_stats_fatal_types.h"
+
+namespace facebook::fboss {
+
+FsdbStatsDeltaGenerator::FsdbStatsDeltaGenerator(
+    std::vector<std::string> basePath,
+    std::chrono::seconds fullSyncInterval)
+    : basePath_(std::move(basePath)), fullSyncInterval_(fullSyncInterval) {}
+
+std::vector<fsdb::OperDeltaUnit> FsdbStatsDeltaGenerator::computeDeltas(
+    const AgentStats& stats) {
+  std::vector<fsdb::OperDeltaUnit> deltas;
+  auto now = std::chrono::steady_clock::now();
+  if (!lastPublished_ || now - lastFullSyncAt_ >= fullSyncInterval_) {
+    deltas.push_back(fullSyncDelta(stats));
+    lastFullSyncAt_ = now;
+  } else {
+    FsdbThriftDeltaBuilder(basePath_, deltas)
+        .diff<apache::thrift::type_class::structure>(*lastPublished_, stats);
+  }
+  lastPublished_ = stats;
+  return deltas;
+}
+
+fsdb::OperDeltaUnit FsdbStatsDeltaGenerator::fullSyncDelta(
+    const AgentStats& stats) const {
+  fsdb::OperDeltaUnit unit;
+  unit.path()->raw() = basePath_;
+  unit.newState() =
+      thrift_cow::serialize<apache::thrift::type_class::structure>(
+          FsdbThriftDeltaBuilder::kProtocol, stats);
+  return unit;
+}
+
+} // namespace facebook::fboss
@@ -0,0 +1,45 @@
+// Copyright 2004-present Facebook. All Rights Reserved.
+
+#pragma once
+
+#include "fboss/agent/gen-cpp2/agent_stats_types.h"
+#include "fboss/fsdb/if/gen-cpp2/fsdb_oper_types.h"
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace facebook::fboss {
+
+/*
+ * Turns successive AgentStats snapshots into fsdb deltas, so that only
+ * counters that changed since the last publish get encoded and sent.
+ *
+ * The first snapshot, and then one every fullSyncInterval, gets
+ * published whole as a single delta replacing the stats tree. This
+ * bounds how long subscribers can stay out of sync if a delta gets lost.
+ */
+class FsdbStatsDeltaGenerator {
+ public:
+  FsdbStatsDeltaGenerator(
+      std::vector<std::string> basePath,
+      std::chrono::seconds fullSyncInterval);
+
+  std::vector<fsdb::OperDeltaUnit> computeDeltas(const AgentStats& stats);
+
+  // Have the next snapshot published whole, e.g. after reconnecting
+  void reset() {
+    lastPublished_.reset();
+  }
+
+ private:
+  fsdb::OperDeltaUnit fullSyncDelta(const AgentStats& stats) const;
+
+  const std::vector<std::string> basePath_;
+  const std::chrono::seconds fullSyncInterval_;
+  std::optional<AgentStats> lastPublished_;
+  std::chrono::steady_clock::time_point lastFullSyncAt_;
+};
+
+} // namespace facebook::fboss
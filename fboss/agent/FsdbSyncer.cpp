@@ -10,10 +10,30 @@
 #include <thrift/lib/cpp2/protocol/Serializer.h>
 #include <optional>
 
+DEFINE_bool(
+    publish_stats_deltas_to_fsdb,
+    false,
+    "Publish only the stats that changed since the last publish to fsdb, "
+    "rather than full stats snapshots");
+DEFINE_int32(
+    fsdbStatsFullSyncIntervalSeconds,
+    300,
+    "Interval at which full stats snapshots are published to fsdb, "
+    "when publishing stats deltas");
+DEFINE_bool(
+    publish_state_path_deltas_to_fsdb,
+    false,
+    "Publish SwitchState changes to fsdb as deltas of the individual "
+    "neighbor and MAC entries that changed, rather than of whole vlans");
+
 namespace facebook::fboss {
 FsdbSyncer::FsdbSyncer(SwSwitch* sw)
     : sw_(sw),
-      fsdbPubSubMgr_(std::make_unique<fsdb::FsdbPubSubManager>("agent")) {
+      fsdbPubSubMgr_(std::make_unique<fsdb::FsdbPubSubManager>("agent")),
+      pathDeltaConverter_(getAgentSwitchStatePath()),
+      statsDeltaGenerator_(
+          getAgentStatsPath(),
+          std::chrono::seconds(FLAGS_fsdbStatsFullSyncIntervalSeconds)) {
   if (FLAGS_publish_state_to_fsdb) {
     fsdbPubSubMgr_->createStateDeltaPublisher(
         getAgentStatePath(), [this](auto oldState, auto newState) {
@@ -21,10 +41,16 @@ FsdbSyncer::FsdbSyncer(SwSwitch* sw)
         });
   }
   if (FLAGS_publish_stats_to_fsdb) {
-    fsdbPubSubMgr_->createStatPathPublisher(
-        getAgentStatsPath(), [this](auto oldState, auto newState) {
-          fsdbStatPublisherStateChanged(oldState, newState);
-        });
+    auto stateChangeCb = [this](auto oldState, auto newState) {
+      fsdbStatPublisherStateChanged(oldState, newState);
+    };
+    if (FLAGS_publish_stats_deltas_to_fsdb) {
+      fsdbPubSubMgr_->createStatDeltaPublisher(
+          getAgentStatsPath(), std::move(stateChangeCb));
+    } else {
+      fsdbPubSubMgr_->createStatPathPublisher(
+          getAgentStatsPath(), std::move(stateChangeCb));
+    }
   }
   sw_->registerStateObserver(this, "FsdbSyncer");
 }
@@ -51,7 +77,10 @@ void FsdbSyncer::stateUpdated(const StateDelta& stateDelta) {
     return;
   }
 
-  publishDeltas(deltaConverter_.computeDeltas(stateDelta));
+  publishDeltas(
+      FLAGS_publish_state_path_deltas_to_fsdb
+          ? pathDeltaConverter_.computeDeltas(stateDelta)
+          : deltaConverter_.computeDeltas(stateDelta));
 }
 
 void FsdbSyncer::cfgUpdated(
@@ -71,6 +100,13 @@ void FsdbSyncer::statsUpdated(const AgentStats& stats) {
   if (!readyForStatPublishing_.load()) {
     return;
   }
+  if (FLAGS_publish_stats_deltas_to_fsdb) {
+    if (statsFullSyncPending_.exchange(false)) {
+      statsDeltaGenerator_.reset();
+    }
+    publishStatDeltas(statsDeltaGenerator_.computeDeltas(stats));
+    return;
+  }
   fsdb::OperState stateUnit;
   stateUnit.contents() =
       apache::thrift::BinarySerializer::serialize<std::string>(stats);
@@ -85,6 +121,17 @@ void FsdbSyncer::publishDeltas(std::vector<fsdb::OperDeltaUnit>&& deltas) {
   fsdbPubSubMgr_->publishState(std::move(delta));
 }
 
+void FsdbSyncer::publishStatDeltas(
+    std::vector<fsdb::OperDeltaUnit>&& deltas) {
+  if (deltas.empty()) {
+    return;
+  }
+  fsdb::OperDelta delta;
+  delta.changes() = std::move(deltas);
+  delta.protocol() = fsdb::OperProtocol::BINARY;
+  fsdbPubSubMgr_->publishStat(std::move(delta));
+}
+
 void FsdbSyncer::fsdbStatePublisherStateChanged(
     fsdb::FsdbStreamClient::State oldState,
     fsdb::FsdbStreamClient::State newState) {
@@ -94,7 +141,8 @@ void FsdbSyncer::fsdbStatePublisherStateChanged(
     sw_->getUpdateEvb()->runInEventBaseThreadAndWait([this] {
       auto switchStateDelta = deltaConverter_.createSwitchStateDelta(
           std::optional<state::SwitchState>(),
-          std::make_optional(sw_->getState()->toThrift()));
+          std::make_optional(
+              sw_->getState()->toThrift(sw_->getStateToThriftExecutor())));
       auto configDelta = deltaConverter_.createConfigDelta(
           std::optional<cfg::SwitchConfig>(),
           std::make_optional(sw_->getConfig()));
@@ -116,7 +164,9 @@ void FsdbSyncer::fsdbStatPublisherStateChanged(
   CHECK(oldState != newState);
   if (newState == fsdb::FsdbStreamClient::State::CONNECTED) {
     // Stats sync at regular intervals, so let the sync
-    // happen in that sequence after a connection.
+    // happen in that sequence after a connection. Starting with a full
+    // snapshot when publishing deltas.
+    statsFullSyncPending_.store(true);
     readyForStatPublishing_.store(true);
   } else {
     readyForStatPublishing_.store(false);
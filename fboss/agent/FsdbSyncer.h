@@ -3,6 +3,8 @@
 #pragma once
 
 #include "fboss/agent/FsdbStateDeltaConverter.h"
+#include "fboss/agent/FsdbStatePathDeltaConverter.h"
+#include "fboss/agent/FsdbStatsDeltaGenerator.h"
 #include "fboss/agent/StateObserver.h"
 #include "fboss/agent/gen-cpp2/agent_stats_types.h"
 #include "fboss/fsdb/client/FsdbPubSubManager.h"
@@ -51,12 +53,18 @@ class FsdbSyncer : public StateObserver {
       fsdb::FsdbStreamClient::State newState);
 
   void publishDeltas(std::vector<fsdb::OperDeltaUnit>&& deltas);
+  void publishStatDeltas(std::vector<fsdb::OperDeltaUnit>&& deltas);
 
   SwSwitch* sw_;
   std::unique_ptr<fsdb::FsdbPubSubManager> fsdbPubSubMgr_;
   std::atomic<bool> readyForStatePublishing_{false};
   std::atomic<bool> readyForStatPublishing_{false};
   FsdbStateDeltaConverter deltaConverter_;
+  // Only used with --publish_state_path_deltas_to_fsdb
+  FsdbStatePathDeltaConverter pathDeltaConverter_;
+  // Only used with --publish_stats_deltas_to_fsdb
+  FsdbStatsDeltaGenerator statsDeltaGenerator_;
+  std::atomic<bool> statsFullSyncPending_{true};
 };
 
 } // namespace facebook::fboss
@@ -0,0 +1,118 @@
+// Copyright 2004-present Facebook. All Rights Reserved.
+
+#pragma once
+
+#include "fboss/fsdb/if/gen-cpp2/fsdb_oper_types.h"
+#include "fboss/thrift_cow/nodes/Serializer.h"
+
+#include <folly/Conv.h>
+#include <thrift/lib/cpp2/reflection/reflection.h>
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace facebook::fboss {
+
+/*
+ * Appends a delta for every leaf that differs between two versions of a
+ * thrift object. Unlike fsdb's ThriftDeltaVisitor, parents of changed
+ * leaves get no delta of their own, and unchanged values are never
+ * copied or encoded. Changed values only carry their new state unless
+ * withOldState is set, while removed ones carry their old state.
+ */
+class FsdbThriftDeltaBuilder {
+ public:
+  static constexpr auto kProtocol = fsdb::OperProtocol::BINARY;
+
+  FsdbThriftDeltaBuilder(
+      const std::vector<std::string>& basePath,
+      std::vector<fsdb::OperDeltaUnit>& deltas,
+      bool withOldState = false)
+      : path_(basePath), deltas_(deltas), withOldState_(withOldState) {}
+
+  template <typename TC, typename T>
+  void diff(const T& oldVal, const T& newVal) {
+    if constexpr (std::is_same_v<TC, apache::thrift::type_class::structure>) {
+      diffStruct(oldVal, newVal);
+    } else if constexpr (IsMap<TC>::value) {
+      diffMap<typename IsMap<TC>::mapped_type_class>(oldVal, newVal);
+    } else if (oldVal != newVal) {
+      // primitives, and lists and sets, which get replaced whole
+      emit<TC>(withOldState_ ? &oldVal : nullptr, &newVal);
+    }
+  }
+
+ private:
+  template <typename TC>
+  struct IsMap : std::false_type {};
+
+  template <typename KeyTypeClass, typename MappedTypeClass>
+  struct IsMap<apache::thrift::type_class::map<KeyTypeClass, MappedTypeClass>>
+      : std::true_type {
+    using mapped_type_class = MappedTypeClass;
+  };
+
+  template <typename T>
+  void diffStruct(const T& oldVal, const T& newVal) {
+    using Members = typename apache::thrift::reflect_struct<T>::members;
+    fatal::foreach<Members>([&](auto indexed) {
+      using member = decltype(fatal::tag_type(indexed));
+      using name = typename member::name;
+      using tc = typename member::type_class;
+      using getter = typename member::getter;
+
+      path_.emplace_back(fatal::z_data<name>(), fatal::size<name>::value);
+      if (member::optional::value == apache::thrift::optionality::optional &&
+          member::is_set(oldVal) != member::is_set(newVal)) {
+        if (member::is_set(newVal)) {
+          emit<tc>(nullptr, &getter{}(newVal));
+        } else {
+          emit<tc>(&getter{}(oldVal), nullptr);
+        }
+      } else {
+        diff<tc>(getter{}(oldVal), getter{}(newVal));
+      }
+      path_.pop_back();
+    });
+  }
+
+  template <typename MappedTypeClass, typename T>
+  void diffMap(const T& oldVal, const T& newVal) {
+    for (const auto& [key, val] : oldVal) {
+      if (newVal.find(key) == newVal.end()) {
+        path_.push_back(folly::to<std::string>(key));
+        emit<MappedTypeClass>(&val, nullptr);
+        path_.pop_back();
+      }
+    }
+    for (const auto& [key, val] : newVal) {
+      path_.push_back(folly::to<std::string>(key));
+      if (auto it = oldVal.find(key); it != oldVal.end()) {
+        diff<MappedTypeClass>(it->second, val);
+      } else {
+        emit<MappedTypeClass>(nullptr, &val);
+      }
+      path_.pop_back();
+    }
+  }
+
+  template <typename TC, typename T>
+  void emit(const T* oldVal, const T* newVal) {
+    fsdb::OperDeltaUnit unit;
+    unit.path()->raw() = path_;
+    if (oldVal) {
+      unit.oldState() = thrift_cow::serialize<TC>(kProtocol, *oldVal);
+    }
+    if (newVal) {
+      unit.newState() = thrift_cow::serialize<TC>(kProtocol, *newVal);
+    }
+    deltas_.push_back(std::move(unit));
+  }
+
+  std::vector<std::string> path_;
+  std::vector<fsdb::OperDeltaUnit>& deltas_;
+  const bool withOldState_;
+};
+
+} // namespace facebook::fboss
@@ -88,13 +88,8 @@ void MKAServiceManager::handlePacket(std::unique_ptr<RxPacket> packet) {
       return;
     }
   }
-  folly::IOBuf* buf = packet->buf();
-  TPacket pktToSend;
-  pktToSend.buf() = buf->moveToFbString().toStdString();
-  pktToSend.timestamp() = time(nullptr);
-  pktToSend.l2Port() = std::move(l2Port);
-  size_t len = pktToSend.buf()->size();
-  if (len != stream_->send(std::move(pktToSend))) {
+  size_t len = packet->buf()->computeChainDataLength();
+  if (len != stream_->send(l2Port, *packet->buf())) {
     CHECK_STATS(stats, stats->MKAServiceSendFailue());
     XLOG(ERR) << "Failed to send MkPdu packet received on Port:'"
               << packet->getSrcPort() << "' to mka_service";
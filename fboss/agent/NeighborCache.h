@@ -11,6 +11,7 @@
 
 #include "fboss/agent/NeighborCacheEntry.h"
 #include "fboss/agent/NeighborCacheImpl-defs.h"
+#include "fboss/agent/NeighborCacheTimerWheel.h"
 #include "fboss/agent/SwSwitch.h"
 #include "fboss/agent/state/PortDescriptor.h"
 
@@ -37,8 +38,9 @@ namespace facebook::fboss {
  * extended for ARP/NDP specific caches.
  */
 template <typename NTable>
-class NeighborCache {
+class NeighborCache : private NeighborCacheTimerWheel::Client {
   friend class NeighborCacheEntry<NTable>;
+  friend class NeighborCacheImpl<NTable>;
 
  public:
   typedef typename NTable::Entry::AddressType AddressType;
@@ -113,7 +115,8 @@ class NeighborCache {
       std::chrono::seconds timeout,
       uint32_t maxNeighborProbes,
       std::chrono::seconds staleEntryInterval)
-      : sw_(sw),
+      : Client(sw->getNeighborCacheTimerWheel()),
+        sw_(sw),
         timeout_(timeout),
         maxNeighborProbes_(maxNeighborProbes),
         staleEntryInterval_(staleEntryInterval),
@@ -215,6 +218,18 @@ class NeighborCache {
     return impl_->processEntry(ip);
   }
 
+  // Called by the timer wheel once the entries expiring on a tick have
+  // been processed, or the pending neighbor table updates are due
+  void timeoutsExpired() noexcept override {
+    std::lock_guard<std::mutex> g(cacheLock_);
+    impl_->commitPendingUpdates();
+  }
+
+  // Whether a probe may be sent out of the cache's interface right now
+  bool consumeProbeToken() {
+    return sw_->getNeighborCacheTimerWheel()->consumeProbeToken(getIntfID());
+  }
+
   // Has the entry corresponding to ip has been hit in hw
   bool isHit(AddressType ip) {
     return sw_->getAndClearNeighborHit(RouterID(0), ip);
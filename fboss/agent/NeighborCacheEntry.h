@@ -11,6 +11,7 @@
 
 #include "fboss/agent/AddressUtil.h"
 #include "fboss/agent/FbossError.h"
+#include "fboss/agent/NeighborCacheTimerWheel.h"
 #include "fboss/agent/SwSwitch.h"
 #include "fboss/agent/state/NeighborEntry.h"
 #include "fboss/agent/state/PortDescriptor.h"
@@ -55,6 +56,8 @@
  * its next update. When that timeout expires, the state machine is run and the
  * next update is scheduled. If the entry ever transitions to the EXPIRED state,
  * we do not schedule another update and the cache will flush the entry.
+ * Timeouts are scheduled on the NeighborCacheTimerWheel shared by all caches,
+ * which lets the cache flush the entries expiring together in one go.
  *
  * There is no locking in this class. Instead, the class relies on the
  * synchronization provided by NeighborCache, which should lock around all calls
@@ -78,7 +81,7 @@ template <typename NTable>
 class NeighborCache;
 
 template <typename NTable>
-class NeighborCacheEntry : private folly::AsyncTimeout {
+class NeighborCacheEntry : private NeighborCacheTimerWheel::Callback {
  public:
   typedef typename NTable::Entry::AddressType AddressType;
   typedef NeighborCache<NTable> Cache;
@@ -89,7 +92,7 @@ class NeighborCacheEntry : private folly::AsyncTimeout {
       folly::EventBase* evb,
       Cache* cache,
       NeighborEntryState state)
-      : AsyncTimeout(evb),
+      : Callback(cache->getSw()->getNeighborCacheTimerWheel(), cache),
         fields_(fields),
         cache_(cache),
         evb_(evb),
@@ -234,8 +237,8 @@ class NeighborCacheEntry : private folly::AsyncTimeout {
   }
 
   /*
-   * Schedules an update on the evb_. This is done synchronously so that we
-   * can have a destructor guard around both running the state machine and
+   * Schedules an update on the timer wheel. This is done synchronously so that
+   * we can have a destructor guard around both running the state machine and
    * scheduling the next update in timeoutExpired.
    */
   void scheduleNextUpdate() {
@@ -324,6 +327,12 @@ class NeighborCacheEntry : private folly::AsyncTimeout {
     DCHECK(isProbing());
     XLOG(DBG4) << "Probing for " << getIP() << " (" << probesLeft_ << " left)";
     if (hasProbesLeft()) {
+      if (!cache_->consumeProbeToken()) {
+        // The interface is out of probes for now. Try again on the next
+        // update, without using up one of the entry's probes.
+        XLOG(DBG4) << "Deferring probe for " << getIP();
+        return;
+      }
       if (state_ == NeighborEntryState::INCOMPLETE) {
         /* entry is INCOMPLETE, issue multicast probe */
         cache_->probeFor(getIP());
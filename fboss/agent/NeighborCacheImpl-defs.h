@@ -14,10 +14,12 @@
 #include <folly/futures/Future.h>
 #include <folly/io/async/EventBase.h>
 #include <folly/logging/xlog.h>
+#include <algorithm>
 #include <list>
 #include "fboss/agent/ArpHandler.h"
 #include "fboss/agent/IPv6Handler.h"
 #include "fboss/agent/NeighborCacheImpl.h"
+#include "fboss/agent/SwitchStats.h"
 #include "fboss/agent/state/ArpTable.h"
 #include "fboss/agent/state/NdpTable.h"
 #include "fboss/agent/state/NeighborEntry.h"
@@ -61,91 +63,158 @@ bool checkVlanAndIntf(
 } // namespace ncachehelpers
 
 template <typename NTable>
-void NeighborCacheImpl<NTable>::programEntry(Entry* entry) {
-  CHECK(!entry->isPending());
+bool NeighborCacheImpl<NTable>::programEntryInSwitchState(
+    std::shared_ptr<SwitchState>* state,
+    const EntryFields& fields,
+    VlanID vlanID) {
+  if (!ncachehelpers::checkVlanAndIntf<NTable>(*state, fields, vlanID)) {
+    // Either the vlan or intf is no longer valid.
+    return false;
+  }
 
-  auto fields = entry->getFields();
-  auto vlanID = vlanID_;
-  auto updateFn = [fields, vlanID](const std::shared_ptr<SwitchState>& state)
-      -> std::shared_ptr<SwitchState> {
-    if (!ncachehelpers::checkVlanAndIntf<NTable>(state, fields, vlanID)) {
-      // Either the vlan or intf is no longer valid.
-      return nullptr;
+  auto vlan = (*state)->getVlans()->getVlanIf(vlanID).get();
+  auto* table = vlan->template getNeighborTable<NTable>().get();
+  auto node = table->getNodeIf(fields.ip);
+
+  if (!node) {
+    table = table->modify(&vlan, state);
+    table->addEntry(fields);
+    XLOG(DBG2) << "Adding entry for " << fields.ip << " --> " << fields.mac
+               << " on interface " << fields.interfaceID << " for vlan "
+               << vlanID;
+  } else {
+    if (node->getMac() == fields.mac && node->getPort() == fields.port &&
+        node->getIntfID() == fields.interfaceID &&
+        node->getState() == fields.state && !node->isPending()) {
+      // This entry was already updated while we were waiting on the lock.
+      return false;
     }
+    table = table->modify(&vlan, state);
+    table->updateEntry(fields);
+    XLOG(DBG2) << "Converting pending entry for " << fields.ip << " --> "
+               << fields.mac << " on interface " << fields.interfaceID
+               << " for vlan " << vlanID;
+  }
+  return true;
+}
 
-    auto vlan = state->getVlans()->getVlanIf(vlanID).get();
-    std::shared_ptr<SwitchState> newState{state};
-    auto* table = vlan->template getNeighborTable<NTable>().get();
-    auto node = table->getNodeIf(fields.ip);
-
-    if (!node) {
-      table = table->modify(&vlan, &newState);
-      table->addEntry(fields);
-      XLOG(DBG2) << "Adding entry for " << fields.ip << " --> " << fields.mac
-                 << " on interface " << fields.interfaceID << " for vlan "
-                 << vlanID;
-    } else {
-      if (node->getMac() == fields.mac && node->getPort() == fields.port &&
-          node->getIntfID() == fields.interfaceID &&
-          node->getState() == fields.state && !node->isPending()) {
-        // This entry was already updated while we were waiting on the lock.
-        return nullptr;
-      }
-      table = table->modify(&vlan, &newState);
-      table->updateEntry(fields);
-      XLOG(DBG2) << "Converting pending entry for " << fields.ip << " --> "
-                 << fields.mac << " on interface " << fields.interfaceID
-                 << " for vlan " << vlanID;
-    }
-    return newState;
-  };
+template <typename NTable>
+bool NeighborCacheImpl<NTable>::programPendingEntryInSwitchState(
+    std::shared_ptr<SwitchState>* state,
+    const EntryFields& fields,
+    VlanID vlanID,
+    bool force) {
+  if (!ncachehelpers::checkVlanAndIntf<NTable>(*state, fields, vlanID)) {
+    // Either the vlan or intf is no longer valid.
+    return false;
+  }
+
+  auto vlan = (*state)->getVlans()->getVlanIf(vlanID).get();
+  auto* table = vlan->template getNeighborTable<NTable>().get();
+  auto node = table->getNodeIf(fields.ip);
+  if (node && !force) {
+    // don't replace an existing entry with a pending one unless
+    // explicitly allowed
+    return false;
+  }
 
-  sw_->updateState(
-      folly::to<std::string>("add neighbor ", fields.ip), std::move(updateFn));
+  table = table->modify(&vlan, state);
+  if (node) {
+    table->removeEntry(fields.ip);
+  }
+  table->addPendingEntry(fields.ip, fields.interfaceID);
+
+  XLOG(DBG4) << "Adding pending entry for " << fields.ip << " on interface "
+             << fields.interfaceID << " for vlan " << vlanID;
+  return true;
+}
+
+template <typename NTable>
+void NeighborCacheImpl<NTable>::programEntry(Entry* entry) {
+  CHECK(!entry->isPending());
+  queueUpdate({PendingUpdate::Type::PROGRAM, entry->getFields()});
 }
 
 template <typename NTable>
 void NeighborCacheImpl<NTable>::programPendingEntry(Entry* entry, bool force) {
   CHECK(entry->isPending());
+  queueUpdate(
+      {PendingUpdate::Type::PROGRAM_PENDING, entry->getFields(), force});
+}
 
-  auto fields = entry->getFields();
+template <typename NTable>
+void NeighborCacheImpl<NTable>::queueUpdate(PendingUpdate update) {
+  pendingUpdates_.push_back(std::move(update));
+  if (FLAGS_neighbor_update_batch_interval_ms <= 0 ||
+      pendingUpdates_.size() >=
+          std::max(FLAGS_neighbor_update_batch_size, 1)) {
+    commitPendingUpdates();
+  } else if (!batchTimer_.isScheduled()) {
+    batchTimer_.scheduleTimeout(
+        std::chrono::milliseconds(FLAGS_neighbor_update_batch_interval_ms));
+  }
+}
+
+template <typename NTable>
+void NeighborCacheImpl<NTable>::commitPendingUpdates() {
+  batchTimer_.cancelTimeout();
+  if (pendingUpdates_.empty()) {
+    return;
+  }
+
+  auto numUpdates = pendingUpdates_.size();
+  // Pending entries must be seen by the hw even if resolved right after,
+  // see updateStateNoCoalescing
+  auto hasPendingEntries = std::any_of(
+      pendingUpdates_.begin(), pendingUpdates_.end(), [](const auto& update) {
+        return update.type == PendingUpdate::Type::PROGRAM_PENDING;
+      });
   auto vlanID = vlanID_;
-  auto updateFn =
-      [fields, vlanID, force](const std::shared_ptr<SwitchState>& state)
+  auto updateFn = [updates = std::move(pendingUpdates_),
+                   vlanID](const std::shared_ptr<SwitchState>& state)
       -> std::shared_ptr<SwitchState> {
-    if (!ncachehelpers::checkVlanAndIntf<NTable>(state, fields, vlanID)) {
-      // Either the vlan or intf is no longer valid.
-      return nullptr;
-    }
-
-    auto vlan = state->getVlans()->getVlanIf(vlanID).get();
     std::shared_ptr<SwitchState> newState{state};
-    auto* table = vlan->template getNeighborTable<NTable>().get();
-    auto node = table->getNodeIf(fields.ip);
-    table = table->modify(&vlan, &newState);
-
-    if (node) {
-      if (!force) {
-        // don't replace an existing entry with a pending one unless
-        // explicitly allowed
-        return nullptr;
+    bool changed{false};
+    for (const auto& update : updates) {
+      switch (update.type) {
+        case PendingUpdate::Type::PROGRAM:
+          changed |=
+              programEntryInSwitchState(&newState, update.fields, vlanID);
+          break;
+        case PendingUpdate::Type::PROGRAM_PENDING:
+          changed |= programPendingEntryInSwitchState(
+              &newState, update.fields, vlanID, update.force);
+          break;
+        case PendingUpdate::Type::FLUSH:
+          changed |=
+              flushEntryFromSwitchState(&newState, update.fields.ip, vlanID);
+          break;
       }
-      table->removeEntry(fields.ip);
     }
-    table->addPendingEntry(fields.ip, fields.interfaceID);
-
-    XLOG(DBG4) << "Adding pending entry for " << fields.ip << " on interface "
-               << fields.interfaceID << " for vlan " << vlanID;
-    return newState;
+    return changed ? newState : nullptr;
   };
+  pendingUpdates_.clear();
 
-  sw_->updateStateNoCoalescing(
-      folly::to<std::string>("add pending entry ", fields.ip),
-      std::move(updateFn));
+  sw_->stats()->neighborUpdateBatch(numUpdates);
+  auto name = folly::to<std::string>(
+      "neighbor table update: ", numUpdates, " entries for vlan ", vlanID);
+  if (hasPendingEntries) {
+    sw_->updateStateNoCoalescing(name, std::move(updateFn));
+  } else {
+    sw_->updateState(name, std::move(updateFn));
+  }
 }
 
 template <typename NTable>
-NeighborCacheImpl<NTable>::~NeighborCacheImpl() {}
+NeighborCacheImpl<NTable>::~NeighborCacheImpl() {
+  batchTimer_.cancelTimeout();
+  // Caches go away along with their vlan, or when shutting down, so there
+  // is no neighbor table left to commit queued updates to
+  if (!pendingUpdates_.empty()) {
+    XLOG(INFO) << "Dropping " << pendingUpdates_.size()
+               << " uncommitted neighbor table updates for vlan " << vlanID_;
+  }
+}
 
 template <typename NTable>
 void NeighborCacheImpl<NTable>::repopulate(std::shared_ptr<NTable> table) {
@@ -201,6 +270,8 @@ void NeighborCacheImpl<NTable>::updateEntryClassID(
 
   if (entry) {
     entry->updateClassID(classID);
+    // Program the entry before updating its classID
+    commitPendingUpdates();
 
     auto updateClassIDFn =
         [this, ip, classID](const std::shared_ptr<SwitchState>& state) {
@@ -278,7 +349,12 @@ void NeighborCacheImpl<NTable>::processEntry(AddressType ip) {
   if (entry) {
     entry->process();
     if (entry->getState() == NeighborEntryState::EXPIRED) {
-      flushEntry(ip);
+      // Entries expiring on the same timer wheel tick get flushed from the
+      // SwitchState together, once NeighborCache::timeoutsExpired commits
+      // the pending updates
+      pendingUpdates_.push_back(
+          {PendingUpdate::Type::FLUSH, entry->getFields()});
+      removeEntry(ip);
     }
   }
 }
@@ -314,8 +390,12 @@ bool NeighborCacheImpl<NTable>::removeEntry(AddressType ip) {
 template <typename NTable>
 bool NeighborCacheImpl<NTable>::flushEntryFromSwitchState(
     std::shared_ptr<SwitchState>* state,
-    AddressType ip) {
-  auto* vlan = (*state)->getVlans()->getVlan(vlanID_).get();
+    AddressType ip,
+    VlanID vlanID) {
+  auto* vlan = (*state)->getVlans()->getVlanIf(vlanID).get();
+  if (!vlan) {
+    return false;
+  }
   auto* table = vlan->template getNeighborTable<NTable>().get();
   const auto& entry = table->getNodeIf(ip);
   if (!entry) {
@@ -336,34 +416,42 @@ bool NeighborCacheImpl<NTable>::flushEntryBlocking(AddressType ip) {
 
 template <typename NTable>
 void NeighborCacheImpl<NTable>::flushEntry(AddressType ip, bool* flushed) {
-  // remove from cache
-  if (!removeEntry(ip)) {
+  auto entry = getCacheEntry(ip);
+  if (!entry) {
     if (flushed) {
       *flushed = false;
     }
     return;
   }
 
+  auto fields = entry->getFields();
+  // remove from cache
+  removeEntry(ip);
+
+  if (!flushed) {
+    queueUpdate({PendingUpdate::Type::FLUSH, fields});
+    return;
+  }
+
+  // Updates pending for the entry must not get applied after the flush
+  commitPendingUpdates();
+
   // flush from SwitchState
-  auto updateFn = [this, ip, flushed](const std::shared_ptr<SwitchState>& state)
+  auto vlanID = vlanID_;
+  auto updateFn = [ip, vlanID, flushed](
+                      const std::shared_ptr<SwitchState>& state)
       -> std::shared_ptr<SwitchState> {
     std::shared_ptr<SwitchState> newState{state};
-    if (flushEntryFromSwitchState(&newState, ip)) {
-      if (flushed) {
-        *flushed = true;
-      }
+    if (flushEntryFromSwitchState(&newState, ip, vlanID)) {
+      *flushed = true;
       return newState;
     }
     return nullptr;
   };
 
-  if (flushed) {
-    // need a blocking state update if the caller wants to know if an entry
-    // was actually flushed
-    sw_->updateStateBlocking("flush neighbor entry", std::move(updateFn));
-  } else {
-    sw_->updateState("remove neighbor entry: " + ip.str(), std::move(updateFn));
-  }
+  // need a blocking state update if the caller wants to know if an entry
+  // was actually flushed
+  sw_->updateStateBlocking("flush neighbor entry", std::move(updateFn));
 }
 
 template <typename NTable>
@@ -407,8 +495,12 @@ void NeighborCacheImpl<NTable>::portFlushEntries(PortDescriptor port) {
 
   for (const auto& ip : entriesToFlush) {
     XLOG(DBG2) << "Flush neighbor entry " << ip.str() << " on port " << port;
-    flushEntry(ip);
+    pendingUpdates_.push_back(
+        {PendingUpdate::Type::FLUSH, getCacheEntry(ip)->getFields()});
+    removeEntry(ip);
   }
+  // Entries of a port going down are flushed together, right away
+  commitPendingUpdates();
 }
 
 template <typename NTable>
@@ -11,6 +11,7 @@
 
 #include "fboss/agent/FbossError.h"
 #include "fboss/agent/NeighborCacheEntry.h"
+#include "fboss/agent/NeighborCacheTimerWheel.h"
 #include "fboss/agent/SwSwitch.h"
 #include "fboss/agent/state/NeighborEntry.h"
 #include "fboss/agent/state/PortDescriptor.h"
@@ -18,9 +19,14 @@
 
 #include <folly/IPAddress.h>
 #include <folly/Random.h>
+#include <gflags/gflags.h>
 #include <list>
 #include <optional>
 #include <string>
+#include <vector>
+
+DECLARE_int32(neighbor_update_batch_interval_ms);
+DECLARE_int32(neighbor_update_batch_size);
 
 namespace facebook::fboss {
 
@@ -35,6 +41,12 @@ class NeighborCache;
  * information and manage the logic for NDP-like expiration and unreachable
  * neighbor detection.
  *
+ * Changes to the neighbor table of the VLAN get committed to the SwitchState
+ * in batches: they accumulate for up to --neighbor_update_batch_interval_ms,
+ * or until there are --neighbor_update_batch_size of them, and then all go in
+ * a single state update. With a zero interval, changes are committed as they
+ * happen, except for those of entries expiring together on the timer wheel.
+ *
  * All calls into this should have acquired a cache level lock through
  * NeighborCache so only one thread should ever be operating on the
  * cache at a given time.
@@ -64,7 +76,8 @@ class NeighborCacheImpl {
         vlanID_(vlanID),
         vlanName_(vlanName),
         intfID_(intfID),
-        evb_(sw->getNeighborCacheEvb()) {}
+        evb_(sw->getNeighborCacheEvb()),
+        batchTimer_(sw->getNeighborCacheTimerWheel(), cache) {}
 
   // Methods useful for subclasses
   void setPendingEntry(AddressType ip, bool force = false);
@@ -127,19 +140,62 @@ class NeighborCacheImpl {
   std::optional<NeighborEntryThrift> getCacheData(AddressType ip) const;
 
  private:
+  /*
+   * A change to the neighbor table waiting in pendingUpdates_ to be
+   * committed to the SwitchState. Only the ip of fields is of use to FLUSH.
+   */
+  struct PendingUpdate {
+    enum class Type { PROGRAM, PROGRAM_PENDING, FLUSH };
+
+    Type type;
+    EntryFields fields;
+    bool force{false};
+  };
+
+  /*
+   * Goes off once the oldest pending update has waited for the batch
+   * interval. The timer wheel then calls NeighborCache::timeoutsExpired,
+   * which commits the pending updates.
+   */
+  class BatchTimer : public NeighborCacheTimerWheel::Callback {
+   public:
+    using Callback::Callback;
+
+   private:
+    void timeoutExpired() noexcept override {}
+  };
+
   // These are used to program entries into the SwitchState
   void programEntry(Entry* entry);
   void programPendingEntry(Entry* entry, bool force = false);
 
   void processEntry(AddressType ip);
 
+  // Adds update to the pending batch, committing the batch if full
+  void queueUpdate(PendingUpdate update);
+
+  // Commits all pending updates to the SwitchState in a single update
+  void commitPendingUpdates();
+
   // Pass in a non-null flushed if you care whether an entry
   // was actually flushed from the switch state
   void flushEntry(AddressType ip, bool* flushed = nullptr);
 
-  bool flushEntryFromSwitchState(
+  // Apply a single change to the neighbor table in *state, returning
+  // whether it changed anything
+  static bool programEntryInSwitchState(
+      std::shared_ptr<SwitchState>* state,
+      const EntryFields& fields,
+      VlanID vlanID);
+  static bool programPendingEntryInSwitchState(
+      std::shared_ptr<SwitchState>* state,
+      const EntryFields& fields,
+      VlanID vlanID,
+      bool force);
+  static bool flushEntryFromSwitchState(
       std::shared_ptr<SwitchState>* state,
-      AddressType ip);
+      AddressType ip,
+      VlanID vlanID);
 
   Entry* getCacheEntry(AddressType ip) const;
   void setCacheEntry(std::shared_ptr<Entry> entry);
@@ -163,6 +219,11 @@ class NeighborCacheImpl {
 
   // Map of all entries
   std::unordered_map<AddressType, std::shared_ptr<Entry>> entries_;
+
+  // Changes to the neighbor table yet to be committed, in the order they
+  // happened
+  std::vector<PendingUpdate> pendingUpdates_;
+  BatchTimer batchTimer_;
 };
 
 } // namespace facebook::fboss
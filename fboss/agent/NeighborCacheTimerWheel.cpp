@@ -0,0 +1,191 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/agent/NeighborCacheTimerWheel.h"
+
+#include <algorithm>
+
+namespace facebook::fboss {
+
+NeighborCacheTimerWheel::Client::~Client() {
+  if (pending_) {
+    auto& clients = wheel_->pendingClients_;
+    clients.erase(std::find(clients.begin(), clients.end(), this));
+  }
+}
+
+void NeighborCacheTimerWheel::Callback::scheduleTimeout(
+    std::chrono::milliseconds timeout) {
+  wheel_->schedule(this, timeout);
+}
+
+void NeighborCacheTimerWheel::Callback::cancelTimeout() {
+  if (isScheduled()) {
+    wheel_->cancel(this);
+  }
+}
+
+NeighborCacheTimerWheel::NeighborCacheTimerWheel(
+    folly::EventBase* evb,
+    std::chrono::milliseconds tickInterval,
+    uint32_t probesPerSecPerIntf)
+    : AsyncTimeout(evb),
+      tickInterval_(std::max(tickInterval, std::chrono::milliseconds(1))),
+      probesPerSecPerIntf_(probesPerSecPerIntf),
+      start_(std::chrono::steady_clock::now()) {}
+
+NeighborCacheTimerWheel::~NeighborCacheTimerWheel() {
+  // Unschedule timers outliving the wheel, so that they no longer call
+  // into it
+  for (auto& level : slots_) {
+    for (auto& slot : level) {
+      slot.clear();
+    }
+  }
+}
+
+bool NeighborCacheTimerWheel::consumeProbeToken(InterfaceID intf) {
+  if (!probesPerSecPerIntf_) {
+    return true;
+  }
+  // Buckets start full, so the first burst of probes goes out right away
+  return probeBuckets_[intf].consume(
+      1, probesPerSecPerIntf_, probesPerSecPerIntf_);
+}
+
+std::chrono::steady_clock::duration NeighborCacheTimerWheel::elapsed() const {
+  return std::chrono::steady_clock::now() - start_;
+}
+
+void NeighborCacheTimerWheel::schedule(
+    Callback* callback,
+    std::chrono::milliseconds timeout) {
+  cancel(callback);
+
+  auto elapsedTime = elapsed();
+  uint64_t now = elapsedTime / tickInterval_;
+  if (!numScheduled_ && !ticking_) {
+    // Nothing left to expire on the ticks the wheel was idle for
+    curTick_ = std::max(curTick_, now);
+  }
+  // Round up, so that the timer never fires early
+  auto due = (elapsedTime + timeout + tickInterval_ -
+              std::chrono::steady_clock::duration(1)) /
+      tickInterval_;
+  callback->expireTick_ = std::max<uint64_t>(due, curTick_ + 1);
+  insert(callback);
+  ++numScheduled_;
+
+  if (!ticking_ && !AsyncTimeout::isScheduled()) {
+    scheduleTick();
+  }
+}
+
+void NeighborCacheTimerWheel::cancel(Callback* callback) {
+  if (callback->is_linked()) {
+    callback->unlink();
+    --numScheduled_;
+  }
+}
+
+void NeighborCacheTimerWheel::insert(Callback* callback) {
+  auto ticks = callback->expireTick_ > curTick_
+      ? callback->expireTick_ - curTick_
+      : 0;
+  int level = 0;
+  while (level < kNumLevels - 1 &&
+         ticks >= (uint64_t(1) << (kBitsPerLevel * (level + 1)))) {
+    ++level;
+  }
+  auto maxTicks = (uint64_t(1) << (kBitsPerLevel * kNumLevels)) - 1;
+  if (ticks > maxTicks) {
+    // Beyond the span of the wheel, which is months even with 1ms ticks
+    callback->expireTick_ = curTick_ + maxTicks;
+  }
+  auto slot =
+      (callback->expireTick_ >> (kBitsPerLevel * level)) & (kSlotsPerLevel - 1);
+  slots_[level][slot].push_back(*callback);
+}
+
+void NeighborCacheTimerWheel::cascade(int level) {
+  auto slot = (curTick_ >> (kBitsPerLevel * level)) & (kSlotsPerLevel - 1);
+  CallbackList callbacks;
+  callbacks.swap(slots_[level][slot]);
+  while (!callbacks.empty()) {
+    auto& callback = callbacks.front();
+    callbacks.pop_front();
+    insert(&callback);
+  }
+}
+
+void NeighborCacheTimerWheel::expireCurrentSlot() {
+  CallbackList expired;
+  expired.swap(slots_[0][curTick_ & (kSlotsPerLevel - 1)]);
+  while (!expired.empty()) {
+    // Callbacks still in expired unlink themselves if destroyed by the
+    // ones firing before them, so take them out one at a time
+    auto& callback = expired.front();
+    expired.pop_front();
+    --numScheduled_;
+
+    auto client = callback.client_;
+    if (client && !client->pending_) {
+      client->pending_ = true;
+      pendingClients_.push_back(client);
+    }
+    callback.timeoutExpired();
+  }
+}
+
+void NeighborCacheTimerWheel::dispatchClients() {
+  // Clients may get destroyed by the ones before them, taking themselves
+  // out of pendingClients_, so do not hold on to iterators
+  for (size_t i = 0; i < pendingClients_.size(); ++i) {
+    auto client = pendingClients_[i];
+    client->pending_ = false;
+    client->timeoutsExpired();
+  }
+  pendingClients_.clear();
+}
+
+void NeighborCacheTimerWheel::timeoutExpired() noexcept {
+  ticking_ = true;
+  uint64_t now = elapsed() / tickInterval_;
+  while (curTick_ < now && numScheduled_) {
+    ++curTick_;
+    // Cascade from the top, so that timers can make it down several levels
+    // on the same tick
+    for (int level = kNumLevels - 1; level > 0; --level) {
+      auto mask = (uint64_t(1) << (kBitsPerLevel * level)) - 1;
+      if (!(curTick_ & mask)) {
+        cascade(level);
+      }
+    }
+    expireCurrentSlot();
+  }
+  if (!numScheduled_) {
+    curTick_ = std::max(curTick_, now);
+  }
+  dispatchClients();
+  ticking_ = false;
+
+  if (numScheduled_) {
+    scheduleTick();
+  }
+}
+
+void NeighborCacheTimerWheel::scheduleTick() {
+  auto next = tickInterval_ * static_cast<int64_t>(curTick_ + 1);
+  // Round up, as waking up ahead of the tick would only spin
+  auto delay = std::chrono::ceil<std::chrono::milliseconds>(next - elapsed());
+  AsyncTimeout::scheduleTimeout(
+      std::max(delay, std::chrono::milliseconds::zero()));
+}
+
+} // namespace facebook::fboss
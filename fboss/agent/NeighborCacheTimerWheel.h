@@ -0,0 +1,167 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#pragma once
+
+#include "fboss/agent/types.h"
+
+#include <boost/intrusive/list.hpp>
+#include <folly/TokenBucket.h>
+#include <folly/io/async/AsyncTimeout.h>
+#include <array>
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook::fboss {
+
+/*
+ * Hierarchical timing wheel driving the timers of all neighbor cache
+ * entries, across all NeighborCaches.
+ *
+ * Rather than every NeighborCacheEntry arming a timer of its own on the
+ * neighbor cache event base, entries schedule their updates on this wheel,
+ * which ticks off a single AsyncTimeout every tick interval for as long as
+ * it has timers pending. The wheel has kNumLevels levels of kSlotsPerLevel
+ * slots, each level spanning kSlotsPerLevel times the one below it. Timers
+ * get bucketed by the tick they expire on, those further out than the
+ * lowest level spans cascading down a level at a time as the wheel turns,
+ * so scheduling and cancelling a timer is O(1).
+ *
+ * Timers expiring on the same tick are grouped by Client: once all timers
+ * of the tick have fired, every Client with one among them gets told once,
+ * so that it can act on its expired timers as a batch, e.g. with a single
+ * state update.
+ *
+ * The wheel also paces the probes neighbor caches send out of each
+ * interface, with one token bucket per interface.
+ *
+ * As with AsyncTimeout, all calls must be made from the thread running the
+ * event base.
+ */
+class NeighborCacheTimerWheel : private folly::AsyncTimeout {
+ public:
+  class Client {
+   public:
+    explicit Client(NeighborCacheTimerWheel* wheel) : wheel_(wheel) {}
+    virtual ~Client();
+
+   private:
+    // Called once per tick, after all of the client's timers expiring on
+    // the tick have fired
+    virtual void timeoutsExpired() noexcept = 0;
+
+    // Forbidden copy constructor and assignment operator
+    Client(Client const&) = delete;
+    Client& operator=(Client const&) = delete;
+
+    friend class NeighborCacheTimerWheel;
+    NeighborCacheTimerWheel* wheel_;
+    bool pending_{false};
+  };
+
+  /*
+   * A timer on the wheel, with the same interface as AsyncTimeout.
+   */
+  class Callback : public boost::intrusive::list_base_hook<
+                       boost::intrusive::link_mode<
+                           boost::intrusive::auto_unlink>> {
+   public:
+    Callback(NeighborCacheTimerWheel* wheel, Client* client)
+        : wheel_(wheel), client_(client) {}
+    virtual ~Callback() {
+      cancelTimeout();
+    }
+
+    // Reschedules the timer if already scheduled
+    void scheduleTimeout(std::chrono::milliseconds timeout);
+    void cancelTimeout();
+
+    bool isScheduled() const {
+      return is_linked();
+    }
+
+   private:
+    virtual void timeoutExpired() noexcept = 0;
+
+    // Forbidden copy constructor and assignment operator
+    Callback(Callback const&) = delete;
+    Callback& operator=(Callback const&) = delete;
+
+    friend class NeighborCacheTimerWheel;
+    NeighborCacheTimerWheel* wheel_;
+    Client* client_;
+    uint64_t expireTick_{0};
+  };
+
+  /*
+   * probesPerSecPerIntf caps the rate probes go out of each interface at,
+   * with bursts of up to as many probes. Probes are not paced if 0.
+   */
+  NeighborCacheTimerWheel(
+      folly::EventBase* evb,
+      std::chrono::milliseconds tickInterval,
+      uint32_t probesPerSecPerIntf = 0);
+  ~NeighborCacheTimerWheel() override;
+
+  /*
+   * Whether a probe may be sent out of intf now, taking it out of the
+   * interface's budget if so.
+   */
+  bool consumeProbeToken(InterfaceID intf);
+
+  size_t numScheduled() const {
+    return numScheduled_;
+  }
+
+  std::chrono::milliseconds getTickInterval() const {
+    return tickInterval_;
+  }
+
+ private:
+  using CallbackList = boost::intrusive::
+      list<Callback, boost::intrusive::constant_time_size<false>>;
+
+  static constexpr int kBitsPerLevel = 8;
+  static constexpr size_t kSlotsPerLevel = 1 << kBitsPerLevel;
+  static constexpr int kNumLevels = 4;
+
+  void timeoutExpired() noexcept override;
+
+  void schedule(Callback* callback, std::chrono::milliseconds timeout);
+  void cancel(Callback* callback);
+
+  // Puts callback in the slot of its expire tick, relative to curTick_
+  void insert(Callback* callback);
+  // Moves the timers of the current slot of level one level down
+  void cascade(int level);
+  // Fires the timers of the current lowest level slot
+  void expireCurrentSlot();
+  void dispatchClients();
+
+  std::chrono::steady_clock::duration elapsed() const;
+  void scheduleTick();
+
+  std::chrono::milliseconds tickInterval_;
+  uint32_t probesPerSecPerIntf_;
+  std::chrono::steady_clock::time_point start_;
+  // The last tick processed, timers expire on later ones
+  uint64_t curTick_{0};
+  size_t numScheduled_{0};
+  bool ticking_{false};
+  std::array<std::array<CallbackList, kSlotsPerLevel>, kNumLevels> slots_;
+  std::vector<Client*> pendingClients_;
+  std::unordered_map<InterfaceID, folly::DynamicTokenBucket> probeBuckets_;
+
+  // Forbidden copy constructor and assignment operator
+  NeighborCacheTimerWheel(NeighborCacheTimerWheel const&) = delete;
+  NeighborCacheTimerWheel& operator=(NeighborCacheTimerWheel const&) = delete;
+};
+
+} // namespace facebook::fboss
@@ -43,6 +43,18 @@ DEFINE_bool(
     false,
     "Disable neighbor updater in agent");
 
+DEFINE_int32(
+    neighbor_update_batch_interval_ms,
+    0,
+    "Max time neighbor table changes of a vlan are held for, to commit them "
+    "to the switch state in batches. Changes are committed right away if 0");
+
+DEFINE_int32(
+    neighbor_update_batch_size,
+    1024,
+    "Max number of neighbor table changes of a vlan committed to the switch "
+    "state in a single update");
+
 namespace facebook::fboss {
 
 using facebook::fboss::DeltaFunctions::forEachChanged;
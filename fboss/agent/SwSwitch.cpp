@@ -37,6 +37,7 @@
 #include "fboss/agent/MPLSHandler.h"
 #include "fboss/agent/MacTableManager.h"
 #include "fboss/agent/MirrorManager.h"
+#include "fboss/agent/NeighborCacheTimerWheel.h"
 #include "fboss/agent/NeighborUpdater.h"
 #include "fboss/agent/PacketLogger.h"
 #include "fboss/agent/PacketObserver.h"
@@ -84,6 +85,7 @@
 #include <folly/MapUtil.h>
 #include <folly/SocketAddress.h>
 #include <folly/String.h>
+#include <folly/executors/thread_factory/NamedThreadFactory.h>
 #include <folly/logging/xlog.h>
 #include <folly/system/ThreadName.h>
 #include <glog/logging.h>
@@ -139,6 +141,22 @@ DEFINE_int32(
     fsdbStatsStreamIntervalSeconds,
     5,
     "Interval at which stats subscriptions are served");
+
+DEFINE_int32(
+    state_to_thrift_threads,
+    0,
+    "Number of threads to convert the whole switch state to thrift on, for "
+    "warmboot and fsdb full syncs. Converts on the calling thread if 0");
+
+DEFINE_int32(
+    neighbor_timer_tick_ms,
+    10,
+    "Granularity of the timers of neighbor cache entries (ms)");
+
+DEFINE_int32(
+    neighbor_probes_per_sec_per_intf,
+    0,
+    "Max rate of ARP/NDP probes sent out of an interface, 0 for no limit");
 namespace {
 
 /**
@@ -217,6 +235,15 @@ SwSwitch::SwSwitch(std::unique_ptr<Platform> platform)
   // don't exist already.
   utilCreateDir(platform_->getVolatileStateDir());
   utilCreateDir(platform_->getPersistentStateDir());
+  if (FLAGS_state_to_thrift_threads > 0) {
+    stateToThriftExecutor_ = std::make_unique<folly::CPUThreadPoolExecutor>(
+        FLAGS_state_to_thrift_threads,
+        std::make_shared<folly::NamedThreadFactory>("StateToThrift"));
+  }
+  neighborCacheTimerWheel_ = std::make_unique<NeighborCacheTimerWheel>(
+      &neighborCacheEventBase_,
+      std::chrono::milliseconds(FLAGS_neighbor_timer_tick_ms),
+      std::max(FLAGS_neighbor_probes_per_sec_per_intf, 0));
 }
 
 SwSwitch::~SwSwitch() {
@@ -392,7 +419,8 @@ std::tuple<folly::dynamic, state::WarmbootState> SwSwitch::gracefulExitState()
     follySwitchState[kRib] = rib_->unresolvedRoutesFollyDynamic();
   }
   state::WarmbootState thriftSwitchState;
-  *thriftSwitchState.swSwitchState() = getAppliedState()->toThrift();
+  *thriftSwitchState.swSwitchState() =
+      getAppliedState()->toThrift(getStateToThriftExecutor());
   return std::make_tuple(follySwitchState, thriftSwitchState);
 }
 
@@ -542,16 +570,12 @@ void SwSwitch::publishRxPacket(RxPacket* pkt, uint16_t ethertype) {
     pubPkt.reasons.push_back(reason);
   }
 
-  folly::IOBuf buf_copy;
-  pkt->buf()->cloneInto(buf_copy);
-  pubPkt.packetData = buf_copy.moveToFbString();
+  pkt->buf()->cloneInto(pubPkt.packetData);
 }
 
 void SwSwitch::publishTxPacket(TxPacket* pkt, uint16_t ethertype) {
   TxPacketData pubPkt;
-  folly::IOBuf copy_buf;
-  pkt->buf()->cloneInto(copy_buf);
-  pubPkt.packetData = copy_buf.moveToFbString();
+  pkt->buf()->cloneInto(pubPkt.packetData);
 }
 
 void SwSwitch::init(std::unique_ptr<TunManager> tunMgr, SwitchFlags flags) {
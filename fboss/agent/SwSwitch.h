@@ -28,6 +28,7 @@
 #include <folly/Range.h>
 #include <folly/SpinLock.h>
 #include <folly/ThreadLocal.h>
+#include <folly/executors/CPUThreadPoolExecutor.h>
 #include <folly/io/async/EventBase.h>
 #include <optional>
 
@@ -57,6 +58,7 @@ class RxPacket;
 class SwitchState;
 class SwitchStats;
 class StateDelta;
+class NeighborCacheTimerWheel;
 class NeighborUpdater;
 class PacketLogger;
 class RouteUpdateLogger;
@@ -456,6 +458,22 @@ class SwSwitch : public HwSwitch::Callback {
     return &neighborCacheEventBase_;
   }
 
+  /*
+   * Get the timing wheel all neighbor cache entries schedule their timers
+   * on. Only to be used from the neighbor cache thread.
+   */
+  NeighborCacheTimerWheel* getNeighborCacheTimerWheel() {
+    return neighborCacheTimerWheel_.get();
+  }
+
+  /*
+   * Get the executor to convert the whole SwitchState to thrift on, null if
+   * conversions should happen on the calling thread
+   */
+  folly::Executor* getStateToThriftExecutor() const {
+    return stateToThriftExecutor_.get();
+  }
+
   /**
    * Do the packet received callback, and throw exception if there is an error
    * in the handling of packet.
@@ -930,6 +948,13 @@ class SwSwitch : public HwSwitch::Callback {
   std::unique_ptr<std::thread> neighborCacheThread_;
   folly::EventBase neighborCacheEventBase_;
   std::shared_ptr<ThreadHeartbeat> neighborCacheThreadHeartbeat_;
+  std::unique_ptr<NeighborCacheTimerWheel> neighborCacheTimerWheel_;
+
+  /*
+   * Workers converting the whole SwitchState to thrift, for warmboot and
+   * fsdb full syncs. Only set if --state_to_thrift_threads is non zero.
+   */
+  std::unique_ptr<folly::CPUThreadPoolExecutor> stateToThriftExecutor_;
 
   /*
    * A thread dedicated to monitor above thread heartbeats
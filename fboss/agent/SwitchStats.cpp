@@ -171,6 +171,20 @@ SwitchStats::SwitchStats(ThreadLocalStatsMap* map)
           AVG,
           50,
           100),
+      neighborUpdateBatches_(
+          map,
+          kCounterPrefix + "neighbor_update_batches",
+          SUM,
+          RATE),
+      neighborUpdateBatchSize_(
+          map,
+          kCounterPrefix + "neighbor_update_batch_size",
+          16,
+          0,
+          1024,
+          AVG,
+          50,
+          100),
       linkStateChange_(map, kCounterPrefix + "link_state.flap", SUM),
       pcapDistFailure_(map, kCounterPrefix + "pcap_dist_failure.error"),
       updateStatsExceptions_(
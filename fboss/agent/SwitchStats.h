@@ -297,6 +297,11 @@ class SwitchStats : public boost::noncopyable {
     neighborCacheEventBacklog_.addValue(value);
   }
 
+  void neighborUpdateBatch(int size) {
+    neighborUpdateBatches_.addValue(1);
+    neighborUpdateBatchSize_.addValue(size);
+  }
+
   void linkStateChange() {
     linkStateChange_.addValue(1);
   }
@@ -523,6 +528,13 @@ class SwitchStats : public boost::noncopyable {
    */
   TLHistogram neighborCacheEventBacklog_;
 
+  /**
+   * Neighbor table updates committed to the switch state, and the number of
+   * neighbor entry changes in each
+   */
+  TLTimeseries neighborUpdateBatches_;
+  TLHistogram neighborUpdateBatchSize_;
+
   /**
    * Link state up/down change count
    */
@@ -56,8 +56,7 @@ PcapPkt::PcapPkt(const RxPacketData* pkt, TimePoint timestamp)
       timestamp_(timestamp),
       buf_(),
       reasons_(std::move(pkt->reasons)) {
-  buf_ = std::move(*folly::IOBuf::copyBuffer(
-      pkt->packetData.data(), pkt->packetData.size()));
+  pkt->packetData.cloneInto(buf_);
 }
 
 PcapPkt::PcapPkt(const TxPacketData* pkt)
@@ -71,8 +70,7 @@ PcapPkt::PcapPkt(const TxPacketData* pkt, TimePoint timestamp)
       timestamp_(timestamp),
       buf_(),
       reasons_() {
-  buf_ = std::move(*folly::IOBuf::copyBuffer(
-      pkt->packetData.data(), pkt->packetData.size()));
+  pkt->packetData.cloneInto(buf_);
 }
 
 } // namespace facebook::fboss
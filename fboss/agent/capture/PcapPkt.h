@@ -36,8 +36,8 @@ struct RxPacketData {
   int32_t srcPort;
   int32_t srcVlan;
 
-  // The data in the packet
-  folly::fbstring packetData;
+  // The data in the packet, sharing the buffer of the received packet
+  folly::IOBuf packetData;
 
   // A list of the reasons that the packet was sent to the CPU
   std::vector<RxReason> reasons;
@@ -46,7 +46,7 @@ struct RxPacketData {
 // A struct holding data of a packet that was sent out
 // of the CPU
 struct TxPacketData {
-  folly::fbstring packetData;
+  folly::IOBuf packetData;
 };
 
 /*
@@ -0,0 +1,408 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/agent/hw/SflowV5Exporter.h"
+
+#include "fboss/agent/FbossError.h"
+
+#include <folly/Bits.h>
+#include <folly/ScopeGuard.h>
+#include <folly/String.h>
+#include <folly/logging/xlog.h>
+
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+DEFINE_bool(
+    sflow_v5_export,
+    false,
+    "Export sFlow samples to collectors as batched sFlow v5 datagrams "
+    "rather than one thrift encoded SflowPacketInfo per datagram");
+DEFINE_int32(
+    sflow_v5_max_datagram_size,
+    1400,
+    "Max size of the sFlow v5 datagrams sent to collectors");
+DEFINE_int32(
+    sflow_v5_flush_interval_ms,
+    100,
+    "Time an sFlow sample is held back to be batched with others. Held back "
+    "samples are checked for at this interval, so one can wait up to twice "
+    "as long");
+DEFINE_int32(
+    sflow_v5_counter_interval_s,
+    20,
+    "Interval between counter samples of sampled ports, 0 to disable");
+
+namespace {
+
+// sFlow v5 structure formats, all from the standard enterprise 0
+constexpr uint32_t kSflowVersion = 5;
+constexpr uint32_t kAddressTypeIpv4 = 1;
+constexpr uint32_t kAddressTypeIpv6 = 2;
+constexpr uint32_t kFlowSampleFormat = 1;
+constexpr uint32_t kCounterSampleFormat = 2;
+constexpr uint32_t kRawPacketHeaderFormat = 1;
+constexpr uint32_t kGenericIfCountersFormat = 1;
+constexpr uint32_t kHeaderProtocolEthernet = 1;
+constexpr uint32_t kIfTypeEthernetCsmacd = 6;
+constexpr uint32_t kIfDirectionFullDuplex = 1;
+
+// Sizes of the fixed parts of samples, with their format and length
+constexpr size_t kFlowSampleSize = 8 + 32;
+constexpr size_t kRawPacketHeaderSize = 8 + 16;
+constexpr size_t kGenericIfCountersSize = 8 + 88;
+constexpr size_t kCounterSampleSize = 8 + 12 + kGenericIfCountersSize;
+
+size_t padded(size_t len) {
+  return (len + 3) & ~size_t(3);
+}
+
+void putU32(std::string& out, uint32_t value) {
+  value = folly::Endian::big(value);
+  out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void putU64(std::string& out, uint64_t value) {
+  value = folly::Endian::big(value);
+  out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void patchU32(std::string& out, size_t offset, uint32_t value) {
+  value = folly::Endian::big(value);
+  std::memcpy(&out[offset], &value, sizeof(value));
+}
+
+// Unknown counters are reported as all ones
+uint32_t counter32(int64_t value) {
+  return value < 0 ? std::numeric_limits<uint32_t>::max()
+                   : static_cast<uint32_t>(value);
+}
+
+uint64_t counter64(int64_t value) {
+  return value < 0 ? std::numeric_limits<uint64_t>::max()
+                   : static_cast<uint64_t>(value);
+}
+
+} // namespace
+
+namespace facebook::fboss {
+
+SflowV5Exporter::SflowV5Exporter(
+    size_t maxDatagramSize,
+    std::chrono::milliseconds flushInterval)
+    : maxDatagramSize_(maxDatagramSize),
+      flushInterval_(flushInterval),
+      start_(std::chrono::steady_clock::now()) {
+  if (flushInterval_.count() > 0) {
+    flushScheduler_ = std::make_unique<folly::FunctionScheduler>();
+    flushScheduler_->setThreadName("SflowV5Flush");
+    flushScheduler_->addFunction(
+        [this]() { flushIfDue(); }, flushInterval_, "sflowV5Flush");
+    flushScheduler_->start();
+  }
+}
+
+SflowV5Exporter::~SflowV5Exporter() {
+  if (flushScheduler_) {
+    flushScheduler_->shutdown();
+  }
+  for (auto& [family, socket] : sockets_) {
+    close(socket);
+  }
+}
+
+void SflowV5Exporter::addCollector(
+    const std::string& id,
+    const folly::SocketAddress& addr) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  // Fail early on address families we can't send to
+  getSocketLocked(addr.getFamily());
+  Collector collector;
+  collector.address = addr;
+  collector.storageLen = addr.getAddress(&collector.storage);
+  collectors_[id] = collector;
+  XLOG(DBG2) << "Added sFlow v5 collector " << addr.describe();
+}
+
+void SflowV5Exporter::removeCollector(const std::string& id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  collectors_.erase(id);
+}
+
+bool SflowV5Exporter::hasCollector(const std::string& id) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return collectors_.find(id) != collectors_.end();
+}
+
+size_t SflowV5Exporter::numCollectors() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return collectors_.size();
+}
+
+void SflowV5Exporter::setAgentAddress(const folly::IPAddress& agentAddress) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  agentAddress_ = agentAddress;
+}
+
+void SflowV5Exporter::addFlowSample(
+    const SflowPacketInfo& info,
+    uint32_t samplingRate) {
+  const auto& header = *info.packetData();
+  uint16_t srcPort = *info.srcPort();
+  uint16_t dstPort = *info.dstPort();
+  uint32_t sourcePort = *info.ingressSampled() ? srcPort : dstPort;
+  auto frameLength = std::max<uint32_t>(*info.frameLength(), header.size());
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto recordSize = kRawPacketHeaderSize + padded(header.size());
+  reserveLocked(kFlowSampleSize + recordSize);
+
+  putU32(current_, kFlowSampleFormat);
+  putU32(current_, kFlowSampleSize - 8 + recordSize);
+  putU32(current_, ++flowSampleSeq_[sourcePort]);
+  // ifIndex data source
+  putU32(current_, sourcePort);
+  putU32(current_, samplingRate);
+  putU32(current_, samplePool_[sourcePort] += samplingRate);
+  // drops
+  putU32(current_, 0);
+  putU32(current_, srcPort);
+  putU32(current_, dstPort);
+  // one record, the sampled packet header
+  putU32(current_, 1);
+
+  putU32(current_, kRawPacketHeaderFormat);
+  putU32(current_, recordSize - 8);
+  putU32(current_, kHeaderProtocolEthernet);
+  putU32(current_, frameLength);
+  putU32(current_, *info.payloadRemoved());
+  putU32(current_, header.size());
+  current_.append(header);
+  current_.append(padded(header.size()) - header.size(), '\0');
+
+  sampleAddedLocked();
+}
+
+void SflowV5Exporter::addCounterSample(
+    PortID port,
+    const HwPortStats& stats,
+    uint64_t speedBps,
+    bool up) {
+  uint32_t ifIndex = port;
+  std::lock_guard<std::mutex> lock(mutex_);
+  reserveLocked(kCounterSampleSize);
+
+  putU32(current_, kCounterSampleFormat);
+  putU32(current_, kCounterSampleSize - 8);
+  putU32(current_, ++counterSampleSeq_[ifIndex]);
+  putU32(current_, ifIndex);
+  // one record, the generic interface counters
+  putU32(current_, 1);
+
+  putU32(current_, kGenericIfCountersFormat);
+  putU32(current_, kGenericIfCountersSize - 8);
+  putU32(current_, ifIndex);
+  putU32(current_, kIfTypeEthernetCsmacd);
+  putU64(current_, speedBps);
+  putU32(current_, kIfDirectionFullDuplex);
+  // admin and oper status
+  putU32(current_, up ? 3 : 0);
+  putU64(current_, counter64(*stats.inBytes_()));
+  putU32(current_, counter32(*stats.inUnicastPkts_()));
+  putU32(current_, counter32(*stats.inMulticastPkts_()));
+  putU32(current_, counter32(*stats.inBroadcastPkts_()));
+  putU32(current_, counter32(*stats.inDiscards_()));
+  putU32(current_, counter32(*stats.inErrors_()));
+  // unknown protos
+  putU32(current_, std::numeric_limits<uint32_t>::max());
+  putU64(current_, counter64(*stats.outBytes_()));
+  putU32(current_, counter32(*stats.outUnicastPkts_()));
+  putU32(current_, counter32(*stats.outMulticastPkts_()));
+  putU32(current_, counter32(*stats.outBroadcastPkts_()));
+  putU32(current_, counter32(*stats.outDiscards_()));
+  putU32(current_, counter32(*stats.outErrors_()));
+  // promiscuous mode
+  putU32(current_, 0);
+
+  sampleAddedLocked();
+}
+
+void SflowV5Exporter::flush() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  flushLocked();
+}
+
+void SflowV5Exporter::flushIfDue() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (samplesPending_ &&
+      std::chrono::steady_clock::now() - oldestSample_ >= flushInterval_) {
+    flushLocked();
+  }
+}
+
+uint64_t SflowV5Exporter::getDatagramsSent() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return datagramsSent_;
+}
+
+uint64_t SflowV5Exporter::getSamplesSent() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return samplesSent_;
+}
+
+std::vector<std::string> SflowV5Exporter::getPendingDatagrams() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto datagrams = pending_;
+  if (currentSamples_) {
+    datagrams.push_back(current_);
+    patchU32(datagrams.back(), numSamplesOffset_, currentSamples_);
+  }
+  return datagrams;
+}
+
+void SflowV5Exporter::startDatagramLocked() {
+  current_.clear();
+  current_.reserve(maxDatagramSize_);
+  putU32(current_, kSflowVersion);
+  if (agentAddress_.isV4()) {
+    putU32(current_, kAddressTypeIpv4);
+  } else {
+    putU32(current_, kAddressTypeIpv6);
+  }
+  auto agentAddress = agentAddress_.bytes();
+  current_.append(
+      reinterpret_cast<const char*>(agentAddress), agentAddress_.byteCount());
+  // sub agent id
+  putU32(current_, 0);
+  putU32(current_, ++datagramSeq_);
+  putU32(
+      current_,
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - start_)
+          .count());
+  numSamplesOffset_ = current_.size();
+  putU32(current_, 0);
+}
+
+void SflowV5Exporter::finishDatagramLocked() {
+  if (!currentSamples_) {
+    return;
+  }
+  patchU32(current_, numSamplesOffset_, currentSamples_);
+  pending_.push_back(std::move(current_));
+  current_.clear();
+  currentSamples_ = 0;
+}
+
+void SflowV5Exporter::reserveLocked(size_t sampleSize) {
+  // A sample too large for a datagram of its own still goes out alone
+  if (currentSamples_ && current_.size() + sampleSize > maxDatagramSize_) {
+    finishDatagramLocked();
+  }
+  if (!currentSamples_) {
+    startDatagramLocked();
+  }
+}
+
+void SflowV5Exporter::sampleAddedLocked() {
+  if (!samplesPending_) {
+    oldestSample_ = std::chrono::steady_clock::now();
+  }
+  ++currentSamples_;
+  ++samplesPending_;
+  if (pending_.size() >= kMaxPendingDatagrams ||
+      oldestSample_ + flushInterval_ <= std::chrono::steady_clock::now()) {
+    flushLocked();
+  }
+}
+
+void SflowV5Exporter::flushLocked() {
+  finishDatagramLocked();
+  if (pending_.empty()) {
+    return;
+  }
+  SCOPE_EXIT {
+    pending_.clear();
+    samplesPending_ = 0;
+  };
+  if (collectors_.empty()) {
+    XLOG(DBG1) << "No sFlow collectors, dropping " << samplesPending_
+               << " samples";
+    return;
+  }
+
+  // One message per datagram and collector, grouped by address family so
+  // that each family gets a single sendmmsg
+  std::unordered_map<sa_family_t, std::vector<mmsghdr>> familyToMsgs;
+  std::vector<iovec> iovecs;
+  iovecs.reserve(pending_.size());
+  for (auto& datagram : pending_) {
+    iovecs.push_back({datagram.data(), datagram.size()});
+  }
+  for (auto& [id, collector] : collectors_) {
+    auto& msgs = familyToMsgs[collector.address.getFamily()];
+    for (auto& iov : iovecs) {
+      mmsghdr msg{};
+      msg.msg_hdr.msg_name = &collector.storage;
+      msg.msg_hdr.msg_namelen = collector.storageLen;
+      msg.msg_hdr.msg_iov = &iov;
+      msg.msg_hdr.msg_iovlen = 1;
+      msgs.push_back(msg);
+    }
+  }
+
+  for (auto& [family, msgs] : familyToMsgs) {
+    auto socket = getSocketLocked(family);
+    size_t sent = 0;
+    while (sent < msgs.size()) {
+      auto batch = std::min<size_t>(msgs.size() - sent, UIO_MAXIOV);
+      auto ret = ::sendmmsg(socket, &msgs[sent], batch, 0);
+      if (ret < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        XLOG(DBG1) << "Failed sending " << msgs.size() - sent
+                   << " sFlow datagrams: " << folly::errnoStr(errno);
+        break;
+      }
+      sent += ret;
+    }
+    datagramsSent_ += sent;
+  }
+  samplesSent_ += samplesPending_;
+  XLOG(DBG4) << "Sent " << pending_.size() << " sFlow datagrams with "
+             << samplesPending_ << " samples to " << collectors_.size()
+             << " collectors";
+}
+
+int SflowV5Exporter::getSocketLocked(sa_family_t family) {
+  if (auto it = sockets_.find(family); it != sockets_.end()) {
+    return it->second;
+  }
+  if (family != AF_INET && family != AF_INET6) {
+    throw FbossError("Unsupported address family for sFlow collector");
+  }
+  auto socket = ::socket(family, SOCK_DGRAM, IPPROTO_UDP);
+  if (socket == -1) {
+    throw FbossError("Error creating UDP socket: ", folly::errnoStr(errno));
+  }
+  if (fcntl(socket, F_SETFL, O_NONBLOCK) != 0) {
+    close(socket);
+    throw FbossError(
+        "Failed to put socket in non-blocking mode: ", folly::errnoStr(errno));
+  }
+  sockets_.emplace(family, socket);
+  return socket;
+}
+
+} // namespace facebook::fboss
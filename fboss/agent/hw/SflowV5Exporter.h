@@ -0,0 +1,139 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#pragma once
+
+#include "fboss/agent/hw/gen-cpp2/hardware_stats_types.h"
+#include "fboss/agent/if/gen-cpp2/sflow_types.h"
+#include "fboss/agent/types.h"
+
+#include <folly/IPAddress.h>
+#include <folly/SocketAddress.h>
+#include <folly/experimental/FunctionScheduler.h>
+#include <gflags/gflags.h>
+#include <sys/socket.h>
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+DECLARE_bool(sflow_v5_export);
+DECLARE_int32(sflow_v5_max_datagram_size);
+DECLARE_int32(sflow_v5_flush_interval_ms);
+DECLARE_int32(sflow_v5_counter_interval_s);
+
+namespace facebook::fboss {
+
+/*
+ * Exports sFlow samples to collectors as standard sFlow v5 datagrams.
+ *
+ * Flow samples, and counter samples built from port stats, are packed into
+ * datagrams of up to maxDatagramSize bytes rather than sent one per
+ * datagram. Datagrams are held back until flushInterval has passed since
+ * the oldest sample in them was added, or kMaxPendingDatagrams of them are
+ * full, and then sent to all collectors with a single sendmmsg() per
+ * address family. A thread of the exporter checks for samples that are due
+ * every flushInterval, so they go out even when no more samples come in.
+ *
+ * Thread safe: samples come in from the rx path while collectors change
+ * from state updates and counters from stats collection.
+ */
+class SflowV5Exporter {
+ public:
+  static constexpr size_t kMaxPendingDatagrams = 32;
+
+  SflowV5Exporter(
+      size_t maxDatagramSize,
+      std::chrono::milliseconds flushInterval);
+  ~SflowV5Exporter();
+
+  void addCollector(const std::string& id, const folly::SocketAddress& addr);
+  void removeCollector(const std::string& id);
+  bool hasCollector(const std::string& id) const;
+  size_t numCollectors() const;
+
+  void setAgentAddress(const folly::IPAddress& agentAddress);
+
+  /*
+   * Queue a sampled packet. samplingRate is the rate of the port and
+   * direction the packet was sampled on.
+   */
+  void addFlowSample(const SflowPacketInfo& info, uint32_t samplingRate);
+
+  /*
+   * Queue the generic interface counters of port.
+   */
+  void addCounterSample(
+      PortID port,
+      const HwPortStats& stats,
+      uint64_t speedBps,
+      bool up);
+
+  // Send all queued samples
+  void flush();
+  // Send queued samples if the oldest has been waiting for flushInterval
+  void flushIfDue();
+
+  uint64_t getDatagramsSent() const;
+  uint64_t getSamplesSent() const;
+
+  // Datagrams queued, the one being filled included. Exposed for testing.
+  std::vector<std::string> getPendingDatagrams() const;
+
+ private:
+  struct Collector {
+    folly::SocketAddress address;
+    sockaddr_storage storage;
+    socklen_t storageLen;
+  };
+
+  void startDatagramLocked();
+  void finishDatagramLocked();
+  // Makes room for a sample of sampleSize bytes in the current datagram
+  void reserveLocked(size_t sampleSize);
+  void sampleAddedLocked();
+  void flushLocked();
+  int getSocketLocked(sa_family_t family);
+
+  const size_t maxDatagramSize_;
+  const std::chrono::milliseconds flushInterval_;
+  const std::chrono::steady_clock::time_point start_;
+
+  mutable std::mutex mutex_;
+  std::map<std::string, Collector> collectors_;
+  std::unordered_map<sa_family_t, int> sockets_;
+  folly::IPAddress agentAddress_{"::"};
+
+  std::vector<std::string> pending_;
+  std::string current_;
+  size_t numSamplesOffset_{0};
+  uint32_t currentSamples_{0};
+  std::chrono::steady_clock::time_point oldestSample_;
+  uint32_t datagramSeq_{0};
+  // Per data source sequence numbers and sample pools
+  std::unordered_map<uint32_t, uint32_t> flowSampleSeq_;
+  std::unordered_map<uint32_t, uint32_t> samplePool_;
+  std::unordered_map<uint32_t, uint32_t> counterSampleSeq_;
+
+  uint64_t datagramsSent_{0};
+  uint64_t samplesSent_{0};
+  uint64_t samplesPending_{0};
+
+  // Runs flushIfDue() every flushInterval, none if samples aren't held back
+  std::unique_ptr<folly::FunctionScheduler> flushScheduler_;
+
+  // no copy or assignment
+  SflowV5Exporter(SflowV5Exporter const&) = delete;
+  SflowV5Exporter& operator=(SflowV5Exporter const&) = delete;
+};
+
+} // namespace facebook::fboss
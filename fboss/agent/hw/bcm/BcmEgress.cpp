@@ -295,6 +295,10 @@ BcmEcmpEgress::BcmEcmpEgress(
     wideEcmpSupported_ = true;
   }
   program();
+  if (id_ != INVALID) {
+    hw_->writableEgressManager()->ecmpGroupAdded(
+        id_, egressId2Weight_, ucmpEnabled_);
+  }
 }
 
 void BcmEcmpEgress::program() {
@@ -420,6 +424,10 @@ BcmEcmpEgress::~BcmEcmpEgress() {
   if (id_ == INVALID) {
     return;
   }
+  // Egress manager is gone by now if the switch itself is being torn down
+  if (auto egressManager = hw_->writableEgressManager()) {
+    egressManager->ecmpGroupRemoved(id_, egressId2Weight_);
+  }
   int ret;
   if (useHsdk_) {
     ret = bcm_l3_ecmp_destroy(hw_->getUnit(), id_);
@@ -73,6 +73,12 @@ void BcmEgressManager::linkStateChangedMaybeLocked(
     hw_->writableMultiPathNextHopTable()->egressResolutionChangedHwLocked(
         portAndEgressIds->getEgressIds(),
         up ? BcmEcmpEgress::Action::EXPAND : BcmEcmpEgress::Action::SHRINK);
+  } else if (ecmpGroupsIndexed_) {
+    CHECK(!up);
+    removeEgressesFromIndexedEcmpsHwNotLocked(
+        portAndEgressIds->getEgressIds(),
+        hw_->getPlatform()->getAsic()->isSupported(HwAsic::Feature::WIDE_ECMP),
+        hw_->getPlatform()->getAsic()->isSupported(HwAsic::Feature::HSDK));
   } else {
     CHECK(!up);
     egressResolutionChangedHwNotLocked(
@@ -84,6 +90,72 @@ void BcmEgressManager::linkStateChangedMaybeLocked(
   }
 }
 
+void BcmEgressManager::ecmpGroupAdded(
+    bcm_if_t ecmpId,
+    const EgressId2Weight& egressId2Weight,
+    bool ucmpEnabled) {
+  auto egressId2EcmpMembers = egressId2EcmpMembers_.wlock();
+  for (const auto& path : egressId2Weight) {
+    (*egressId2EcmpMembers)[path.first][ecmpId] =
+        EcmpMember{path.second, ucmpEnabled};
+  }
+}
+
+void BcmEgressManager::ecmpGroupRemoved(
+    bcm_if_t ecmpId,
+    const EgressId2Weight& egressId2Weight) {
+  auto egressId2EcmpMembers = egressId2EcmpMembers_.wlock();
+  for (const auto& path : egressId2Weight) {
+    auto itr = egressId2EcmpMembers->find(path.first);
+    if (itr == egressId2EcmpMembers->end()) {
+      continue;
+    }
+    itr->second.erase(ecmpId);
+    if (itr->second.empty()) {
+      egressId2EcmpMembers->erase(itr);
+    }
+  }
+}
+
+size_t BcmEgressManager::getEcmpGroupCount(bcm_if_t egressId) const {
+  auto egressId2EcmpMembers = egressId2EcmpMembers_.rlock();
+  auto itr = egressId2EcmpMembers->find(egressId);
+  return itr == egressId2EcmpMembers->end() ? 0 : itr->second.size();
+}
+
+void BcmEgressManager::removeEgressesFromIndexedEcmpsHwNotLocked(
+    const EgressIdSet& affectedEgressIds,
+    bool wideEcmpSupported,
+    bool useHsdk) const {
+  // Snapshot the affected memberships, so as to not hold up ECMP
+  // programming in the update thread while we talk to HW.
+  std::vector<std::pair<bcm_if_t, EcmpId2Member>> toRemove;
+  {
+    auto egressId2EcmpMembers = egressId2EcmpMembers_.rlock();
+    for (auto egressId : affectedEgressIds) {
+      auto itr = egressId2EcmpMembers->find(egressId);
+      if (itr != egressId2EcmpMembers->end()) {
+        toRemove.emplace_back(egressId, itr->second);
+      }
+    }
+  }
+  for (const auto& [egressId, ecmpId2Member] : toRemove) {
+    for (const auto& [ecmpId, member] : ecmpId2Member) {
+      // Same as BcmEcmpEgress::removeEgressIdHwLocked
+      if (member.weight == 0) {
+        continue;
+      }
+      BcmEcmpEgress::removeEgressIdHwNotLocked(
+          hw_->getUnit(),
+          ecmpId,
+          std::make_pair(egressId, member.weight),
+          member.ucmpEnabled,
+          wideEcmpSupported,
+          useHsdk);
+    }
+  }
+}
+
 template <typename T>
 BcmEgressManager::EgressIdAndWeight BcmEgressManager::toEgressIdAndWeight(
     T egress) {
@@ -13,6 +13,10 @@
 #include <boost/container/flat_set.hpp>
 
 #include <folly/SpinLock.h>
+#include <folly/Synchronized.h>
+
+#include <atomic>
+#include <unordered_map>
 
 extern "C" {
 #include <bcm/l3.h>
@@ -26,6 +30,7 @@ namespace facebook::fboss {
 class BcmEgressManager {
  public:
   using EgressIdSet = BcmEcmpEgress::EgressIdSet;
+  using EgressId2Weight = BcmEcmpEgress::EgressId2Weight;
 
   explicit BcmEgressManager(const BcmSwitchIf* hw) : hw_(hw) {
     auto platform = hw_->getPlatform();
@@ -98,6 +103,32 @@ class BcmEgressManager {
     resolvedEgresses_.erase(egressId);
   }
 
+  /*
+   * Egress -> ECMP group membership. Maintained as ECMP groups are
+   * programmed and destroyed, so that on link down we only visit the
+   * ECMP groups going over the port, rather than traversing every ECMP
+   * group in HW.
+   */
+  void ecmpGroupAdded(
+      bcm_if_t ecmpId,
+      const EgressId2Weight& egressId2Weight,
+      bool ucmpEnabled);
+  void ecmpGroupRemoved(
+      bcm_if_t ecmpId,
+      const EgressId2Weight& egressId2Weight);
+  /*
+   * Called once every ECMP group in HW is accounted for in the membership
+   * index, i.e. once the warm boot cache is done with. Till then link
+   * down falls back to traversing the ECMP groups in HW.
+   */
+  void ecmpGroupsIndexed() {
+    ecmpGroupsIndexed_ = true;
+  }
+  /*
+   * Number of ECMP groups the egress is a member of
+   */
+  size_t getEcmpGroupCount(bcm_if_t egressId) const;
+
  private:
   /*
    * Called both while holding and not holding the hw lock.
@@ -121,6 +152,18 @@ class BcmEgressManager {
       T* intfArray, // array of egresses in the ecmp group
       void* userData); // egresses we intend to remove from the ecmp group
   void setPort2EgressIdsInternal(std::shared_ptr<PortAndEgressIdsMap> newMap);
+  void removeEgressesFromIndexedEcmpsHwNotLocked(
+      const EgressIdSet& affectedEgressIds,
+      bool wideEcmpSupported,
+      bool useHsdk) const;
+
+  struct EcmpMember {
+    // Weight of the egress in the ECMP group, as programmed by
+    // BcmEcmpEgress
+    uint64_t weight;
+    bool ucmpEnabled;
+  };
+  using EcmpId2Member = boost::container::flat_map<bcm_if_t, EcmpMember>;
 
   const BcmSwitchIf* hw_;
   /*
@@ -138,6 +181,13 @@ class BcmEgressManager {
   std::shared_ptr<PortAndEgressIdsMap> portAndEgressIdsDontUseDirectly_;
   mutable folly::SpinLock portAndEgressIdsLock_;
   boost::container::flat_set<bcm_if_t> resolvedEgresses_;
+  /*
+   * egressId -> ECMP groups it is a member of. Updated from the update
+   * thread, read from the linkscan thread.
+   */
+  folly::Synchronized<std::unordered_map<bcm_if_t, EcmpId2Member>>
+      egressId2EcmpMembers_;
+  std::atomic<bool> ecmpGroupsIndexed_{false};
 };
 
 } // namespace facebook::fboss
@@ -195,20 +195,44 @@ BcmSflowExporter::~BcmSflowExporter() {
   }
 }
 
+BcmSflowExporterTable::BcmSflowExporterTable() {
+  if (FLAGS_sflow_v5_export) {
+    v5Exporter_ = make_unique<SflowV5Exporter>(
+        FLAGS_sflow_v5_max_datagram_size,
+        std::chrono::milliseconds(FLAGS_sflow_v5_flush_interval_ms));
+  }
+}
+
+BcmSflowExporterTable::~BcmSflowExporterTable() {
+  if (v5Exporter_) {
+    v5Exporter_->flush();
+  }
+}
+
 bool BcmSflowExporterTable::contains(
     const shared_ptr<SflowCollector>& c) const {
+  if (v5Exporter_) {
+    return v5Exporter_->hasCollector(c->getID());
+  }
   auto iter = map_.find(c->getID());
   return iter != map_.end();
 }
 
 size_t BcmSflowExporterTable::size() const {
+  if (v5Exporter_) {
+    return v5Exporter_->numCollectors();
+  }
   return map_.size();
 }
 
 void BcmSflowExporterTable::addExporter(const shared_ptr<SflowCollector>& c) {
   try {
-    auto exporter = make_unique<BcmSflowExporter>(c->getAddress());
-    map_.emplace(c->getID(), move(exporter));
+    if (v5Exporter_) {
+      v5Exporter_->addCollector(c->getID(), c->getAddress());
+    } else {
+      auto exporter = make_unique<BcmSflowExporter>(c->getAddress());
+      map_.emplace(c->getID(), move(exporter));
+    }
   } catch (const fboss::thrift::FbossBaseError& ex) {
     XLOG(ERR) << "Could not add exporter: "
               << c->getAddress().getFullyQualified()
@@ -222,6 +246,9 @@ void BcmSflowExporterTable::addExporter(const shared_ptr<SflowCollector>& c) {
 
 void BcmSflowExporterTable::removeExporter(const std::string& id) {
   XLOG(DBG2) << "Removed sFlow exporter " << id;
+  if (v5Exporter_) {
+    v5Exporter_->removeCollector(id);
+  }
   map_.erase(id);
 }
 
@@ -229,24 +256,35 @@ void BcmSflowExporterTable::updateSamplingRates(
     PortID id,
     int64_t inRate,
     int64_t outRate) {
-  std::pair<int64_t, int64_t> rates(inRate, outRate);
-  auto it = port2samplingRates_.find(id);
-  if (it != port2samplingRates_.end()) {
-    it->second = rates;
-  } else {
-    port2samplingRates_.insert(std::make_pair(id, rates));
-  }
+  (*port2samplingRates_.wlock())[id] = std::make_pair(inRate, outRate);
 
   // We piggyback the update of local IPv6
   localIP_ = getLocalIPv6();
+  if (v5Exporter_) {
+    v5Exporter_->setAgentAddress(localIP_);
+  }
 }
 
 void BcmSflowExporterTable::sendToAll(const SflowPacketInfo& info) {
-  if (map_.empty()) {
+  if (size() == 0) {
     XLOG(DBG1)
         << "zero sFlow collectors with sflow enabled, skipping sample export";
     return;
   }
+  if (v5Exporter_) {
+    // Batched with other samples rather than sent right away
+    uint32_t samplingRate = 0;
+    auto port = *info.ingressSampled() ? *info.srcPort() : *info.dstPort();
+    {
+      auto rates = port2samplingRates_.rlock();
+      if (auto it = rates->find(PortID(port)); it != rates->end()) {
+        samplingRate = *info.ingressSampled() ? it->second.first
+                                              : it->second.second;
+      }
+    }
+    v5Exporter_->addFlowSample(info, samplingRate);
+    return;
+  }
   // Serialize info to a string and wrap it in an IOBuf for sending
   string output;
   apache::thrift::BinarySerializer::serialize(info, &output);
@@ -268,4 +306,37 @@ void BcmSflowExporterTable::sendToAll(const SflowPacketInfo& info) {
   }
 }
 
+bool BcmSflowExporterTable::counterSamplesDue() {
+  if (!v5Exporter_ || !FLAGS_sflow_v5_counter_interval_s || size() == 0) {
+    return false;
+  }
+  auto now = std::chrono::steady_clock::now();
+  if (now - lastCounterSamples_ <
+      std::chrono::seconds(FLAGS_sflow_v5_counter_interval_s)) {
+    return false;
+  }
+  lastCounterSamples_ = now;
+  return true;
+}
+
+std::vector<PortID> BcmSflowExporterTable::getSampledPorts() const {
+  std::vector<PortID> ports;
+  for (const auto& [port, rates] : *port2samplingRates_.rlock()) {
+    if (rates.first || rates.second) {
+      ports.push_back(port);
+    }
+  }
+  return ports;
+}
+
+void BcmSflowExporterTable::addCounterSample(
+    PortID port,
+    const HwPortStats& stats,
+    uint64_t speedBps,
+    bool up) {
+  if (v5Exporter_) {
+    v5Exporter_->addCounterSample(port, stats, speedBps, up);
+  }
+}
+
 } // namespace facebook::fboss
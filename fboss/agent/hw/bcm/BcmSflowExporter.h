@@ -9,11 +9,15 @@
  */
 #pragma once
 
+#include <chrono>
 #include <unordered_map>
+#include <vector>
 
 #include <folly/IPAddress.h>
 #include <folly/SocketAddress.h>
+#include <folly/Synchronized.h>
 
+#include "fboss/agent/hw/SflowV5Exporter.h"
 #include "fboss/agent/if/gen-cpp2/sflow_types.h"
 #include "fboss/agent/state/SflowCollector.h"
 #include "fboss/agent/types.h"
@@ -44,10 +48,15 @@ class BcmSflowExporter {
   int socket_{-1};
 };
 
+/*
+ * sFlow collectors of the switch. Samples either go out to each collector
+ * as one thrift serialized SflowPacketInfo per datagram, or with
+ * --sflow_v5_export, batched into sFlow v5 datagrams by a SflowV5Exporter.
+ */
 class BcmSflowExporterTable {
  public:
-  BcmSflowExporterTable() = default;
-  ~BcmSflowExporterTable() = default;
+  BcmSflowExporterTable();
+  ~BcmSflowExporterTable();
 
   bool contains(const std::shared_ptr<SflowCollector>& collector) const;
   size_t size() const;
@@ -58,17 +67,32 @@ class BcmSflowExporterTable {
 
   void sendToAll(const SflowPacketInfo& info);
 
+  /*
+   * Only with sFlow v5 export: whether counter samples of the sampled
+   * ports are due, as of now, and queueing them.
+   */
+  bool counterSamplesDue();
+  std::vector<PortID> getSampledPorts() const;
+  void addCounterSample(
+      PortID port,
+      const HwPortStats& stats,
+      uint64_t speedBps,
+      bool up);
+
  private:
   // no copy or assignment
   BcmSflowExporterTable(BcmSflowExporterTable const&) = delete;
   BcmSflowExporterTable& operator=(BcmSflowExporterTable const&) = delete;
 
   std::unordered_map<std::string, std::unique_ptr<BcmSflowExporter>> map_;
-  std::unordered_map<
+  // Updated from state updates, read from the rx and stats threads
+  folly::Synchronized<std::unordered_map<
       PortID,
-      std::pair<int64_t /* ingress rate */, int64_t /* egress rate */>>
+      std::pair<int64_t /* ingress rate */, int64_t /* egress rate */>>>
       port2samplingRates_;
   folly::IPAddress localIP_;
+  std::unique_ptr<SflowV5Exporter> v5Exporter_;
+  std::chrono::steady_clock::time_point lastCounterSamples_;
 };
 
 } // namespace facebook::fboss
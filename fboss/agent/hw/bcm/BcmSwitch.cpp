@@ -972,6 +972,9 @@ HwInitResult BcmSwitch::initImpl(
     setMacAging(std::chrono::seconds(
         ret.switchState->getSwitchSettings()->getL2AgeTimerSeconds()));
   }
+  // Unclaimed ECMP groups are gone with the warm boot cache, the ones left
+  // in HW are all accounted for by BcmEcmpEgress.
+  egressManager_->ecmpGroupsIndexed();
 
   macTable_ = std::make_unique<BcmMacTable>(this);
 
@@ -2648,6 +2651,22 @@ void BcmSwitch::updateStatsImpl(SwitchStats* /* switchStats */) {
   updateGlobalStats();
   // Update cpu or host bound packet stats
   controlPlane_->updateQueueCounters();
+  // sFlow v5 counter samples ride on the freshly collected port stats
+  if (sFlowExporterTable_->counterSamplesDue()) {
+    for (auto port : sFlowExporterTable_->getSampledPorts()) {
+      auto bcmPort = portTable_->getBcmPortIf(port);
+      if (!bcmPort) {
+        continue;
+      }
+      if (auto stats = bcmPort->getPortStats()) {
+        sFlowExporterTable_->addCounterSample(
+            port,
+            *stats,
+            static_cast<uint64_t>(bcmPort->getSpeed()) * 1000000,
+            bcmPort->isUp());
+      }
+    }
+  }
 }
 
 folly::F14FastMap<std::string, HwPortStats> BcmSwitch::getPortStats() const {
@@ -3219,6 +3238,7 @@ bool BcmSwitch::handleSflowPacket(BcmPacketT& bcmPacket) noexcept {
   info.srcPort() = src_port;
   info.dstPort() = dest_port;
   info.vlan() = vlan;
+  info.frameLength() = pkt_len;
 
   auto snapLen = std::min(kMaxSflowSnapLen, (unsigned int)(pkt_len));
 
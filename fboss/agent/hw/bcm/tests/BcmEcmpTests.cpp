@@ -14,6 +14,7 @@
 #include "fboss/agent/FibHelpers.h"
 #include "fboss/agent/gen-cpp2/switch_config_types.h"
 #include "fboss/agent/hw/bcm/BcmEcmpUtils.h"
+#include "fboss/agent/hw/bcm/BcmEgressManager.h"
 #include "fboss/agent/hw/bcm/BcmError.h"
 #include "fboss/agent/hw/bcm/BcmHost.h"
 #include "fboss/agent/hw/bcm/BcmMultiPathNextHop.h"
@@ -30,6 +31,7 @@
 
 #include <boost/container/flat_set.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <numeric>
 #include <set>
@@ -187,4 +189,40 @@ TEST_F(BcmEcmpTest, NativeUcmpFlag) {
   EXPECT_FALSE(utility::isNativeUcmpEnabled(getHwSwitch(), ecmp));
 }
 
+TEST_F(BcmEcmpTest, EcmpMembershipIndex) {
+  const RoutePrefixV6 kOtherRoute{IPAddressV6("2401:db00::"), 64};
+  const auto egressManager = getHwSwitch()->getEgressManager();
+  auto countEgresses = [&](const auto& egressIds, size_t ecmpGroups) {
+    return std::count_if(
+        egressIds.begin(), egressIds.end(), [&](const auto& egressId) {
+          return egressManager->getEcmpGroupCount(egressId.first) ==
+              ecmpGroups;
+        });
+  };
+
+  // Default route over all next hops, the other one over half of them
+  applyNewState(
+      ecmpHelper_->resolveNextHops(getProgrammedState(), kNumNextHops));
+  ecmpHelper_->programRoutes(getRouteUpdater(), kNumNextHops);
+  ecmpHelper_->programRoutes(
+      getRouteUpdater(), kNumNextHops / 2, {kOtherRoute});
+  auto egressIds = getEcmpEgress()->egressId2Weight();
+  ASSERT_EQ(kNumNextHops, egressIds.size());
+  EXPECT_EQ(kNumNextHops / 2, countEgresses(egressIds, 2));
+  EXPECT_EQ(kNumNextHops / 2, countEgresses(egressIds, 1));
+
+  // Link down shrinks the groups in HW, membership in SW is unchanged
+  bringDownPort(ecmpHelper_->nhop(0).portDesc.phyPortID());
+  EXPECT_EQ(
+      kNumNextHops - 1,
+      getEcmpSizeInHw(getHwSwitch(), kDefaultRoutePrefix, kRid, kNumNextHops));
+  EXPECT_EQ(kNumNextHops / 2, countEgresses(egressIds, 2));
+  EXPECT_EQ(kNumNextHops / 2, countEgresses(egressIds, 1));
+
+  ecmpHelper_->unprogramRoutes(getRouteUpdater(), {kOtherRoute});
+  EXPECT_EQ(kNumNextHops, countEgresses(egressIds, 1));
+  ecmpHelper_->unprogramRoutes(getRouteUpdater());
+  EXPECT_EQ(kNumNextHops, countEgresses(egressIds, 0));
+}
+
 } // namespace facebook::fboss
@@ -22,11 +22,50 @@
 #include <folly/Benchmark.h>
 #include <folly/IPAddress.h>
 
+#include <algorithm>
+#include <functional>
+
 namespace facebook::fboss {
 
 using utility::getEcmpSizeInHw;
 
-BENCHMARK(HwEcmpGroupShrink) {
+namespace {
+/*
+ * Distinct next hop weights for each of the unrelated ECMP groups, so that
+ * each route gets an ECMP group of its own.
+ */
+std::vector<std::vector<NextHopWeight>> unrelatedGroupWeights(
+    size_t numGroups,
+    int ecmpWidth) {
+  constexpr NextHopWeight kMaxWeight = 8;
+  std::vector<std::vector<NextHopWeight>> groupWeights;
+  for (int combination = 0; groupWeights.size() < numGroups; ++combination) {
+    std::vector<NextHopWeight> weights;
+    auto remaining = combination;
+    for (int i = 0; i < ecmpWidth; ++i) {
+      weights.push_back(remaining % kMaxWeight + 1);
+      remaining /= kMaxWeight;
+    }
+    CHECK_EQ(remaining, 0) << "Not enough weight combinations";
+    // Equal weights would all be plain ECMP over the same next hops
+    if (std::adjacent_find(
+            weights.begin(), weights.end(), std::not_equal_to<>()) ==
+        weights.end()) {
+      continue;
+    }
+    groupWeights.push_back(std::move(weights));
+  }
+  return groupWeights;
+}
+} // namespace
+
+/*
+ * Time to shrink the ECMP group going over a port that went down, with
+ * numUnrelatedEcmpGroups other ECMP groups programmed that do not go over
+ * that port. Shrink time should not depend on the number of unrelated
+ * groups.
+ */
+void runEcmpGroupShrinkBenchmark(size_t numUnrelatedEcmpGroups) {
   folly::BenchmarkSuspender suspender;
   constexpr int kEcmpWidth = 4;
   auto ensemble = createHwEnsemble(HwSwitchEnsemble::getAllFeatures());
@@ -42,6 +81,29 @@ BENCHMARK(HwEcmpGroupShrink) {
       std::make_unique<HwSwitchEnsembleRouteUpdateWrapper>(
           ensemble->getRouteUpdater()),
       kEcmpWidth);
+  if (numUnrelatedEcmpGroups) {
+    // Unrelated groups are spread over the ports past the first one, which
+    // is the one we bring down.
+    ensemble->applyNewState(ecmpHelper.resolveNextHops(
+        ensemble->getProgrammedState(), kEcmpWidth + 1));
+    boost::container::flat_set<PortDescriptor> unrelatedPorts;
+    for (int i = 1; i <= kEcmpWidth; ++i) {
+      unrelatedPorts.insert(ecmpHelper.ecmpPortDescriptorAt(i));
+    }
+    auto groupWeights =
+        unrelatedGroupWeights(numUnrelatedEcmpGroups, kEcmpWidth);
+    for (size_t i = 0; i < groupWeights.size(); ++i) {
+      auto bytes = folly::IPAddressV6("2401:db00::").toByteArray();
+      bytes[4] = (i >> 8) & 0xff;
+      bytes[5] = i & 0xff;
+      ecmpHelper.programRoutes(
+          std::make_unique<HwSwitchEnsembleRouteUpdateWrapper>(
+              ensemble->getRouteUpdater()),
+          unrelatedPorts,
+          {RoutePrefixV6{folly::IPAddressV6(bytes), 48}},
+          groupWeights[i]);
+    }
+  }
   auto prefix = folly::CIDRNetwork(folly::IPAddress("::"), 0);
   CHECK_EQ(
       kEcmpWidth,
@@ -85,4 +147,16 @@ BENCHMARK(HwEcmpGroupShrink) {
   }
 }
 
+BENCHMARK(HwEcmpGroupShrink) {
+  runEcmpGroupShrinkBenchmark(0);
+}
+
+BENCHMARK(HwEcmpGroupShrinkWith1kUnrelatedGroups) {
+  runEcmpGroupShrinkBenchmark(1024);
+}
+
+BENCHMARK(HwEcmpGroupShrinkWith4kUnrelatedGroups) {
+  runEcmpGroupShrinkBenchmark(4000);
+}
+
 } // namespace facebook::fboss
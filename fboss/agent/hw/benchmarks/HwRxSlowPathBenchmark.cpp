@@ -9,14 +9,18 @@
  */
 
 #include "fboss/agent/Platform.h"
+#include "fboss/agent/RxPacket.h"
 #include "fboss/agent/hw/test/ConfigFactory.h"
 #include "fboss/agent/hw/test/HwSwitchEnsemble.h"
 #include "fboss/agent/hw/test/HwSwitchEnsembleFactory.h"
 #include "fboss/agent/hw/test/HwSwitchEnsembleRouteUpdateWrapper.h"
 #include "fboss/agent/hw/test/HwTestCoppUtils.h"
+#include "fboss/agent/hw/test/HwTestPacketSnooper.h"
 #include "fboss/agent/hw/test/HwTestPacketUtils.h"
 #include "fboss/agent/hw/test/dataplane_tests/HwTestQosUtils.h"
 #include "fboss/agent/test/EcmpSetupHelper.h"
+#include "fboss/agent/thrift_packet_stream/PacketStreamClient.h"
+#include "fboss/agent/thrift_packet_stream/PacketStreamService.h"
 
 #include "fboss/agent/hw/switch_asics/HwAsic.h"
 #include "fboss/agent/hw/test/HwTestPacketTrapEntry.h"
@@ -24,7 +28,9 @@
 #include <folly/IPAddress.h>
 #include <folly/dynamic.h>
 #include <folly/init/Init.h>
+#include <folly/io/async/ScopedEventBaseThread.h>
 #include <folly/json.h>
+#include <thrift/lib/cpp2/util/ScopedServerInterfaceThread.h>
 
 #include <iostream>
 #include <thread>
@@ -34,11 +40,80 @@ DEFINE_bool(
     setup_for_warmboot,
     false,
     "Set to true will prepare the device for warmboot");
+DEFINE_int32(
+    rx_observers,
+    0,
+    "Packet observers to attach, each keeping the last packet received");
+DEFINE_int32(
+    rx_packet_streams,
+    0,
+    "Packet stream clients to publish every packet received to");
 
 namespace facebook::fboss {
 
 const std::string kDstIp = "2620:0:1cfe:face:b00c::4";
 
+namespace {
+
+class RxPacketStreamService : public PacketStreamService {
+ public:
+  RxPacketStreamService() : PacketStreamService("RxSlowPathBenchmark") {}
+
+ protected:
+  void clientConnected(const std::string& /* clientId */) override {}
+  void clientDisconnected(const std::string& /* clientId */) override {}
+  void addPort(
+      const std::string& /* clientId */,
+      const std::string& /* l2Port */) override {}
+  void removePort(
+      const std::string& /* clientId */,
+      const std::string& /* l2Port */) override {}
+};
+
+class RxPacketStreamClient : public PacketStreamClient {
+ public:
+  RxPacketStreamClient(const std::string& clientId, folly::EventBase* evb)
+      : PacketStreamClient(clientId, evb) {}
+
+ protected:
+  void recvPacket(TPacket&& /* packet */) override {}
+};
+
+/*
+ * Publishes every packet received to the packet stream clients, the way
+ * MKAServiceManager forwards EAPOL packets. This hooks into the ensemble's
+ * observers, there is no SwSwitch here, so SwSwitch::publishRxPacket is not
+ * part of what gets measured.
+ */
+class RxPacketStreamPublisher
+    : public HwSwitchEnsemble::HwSwitchEventObserverIf {
+ public:
+  RxPacketStreamPublisher(
+      HwSwitchEnsemble* ensemble,
+      PacketStreamService* service)
+      : ensemble_(ensemble), service_(service) {
+    ensemble_->addHwEventObserver(this);
+  }
+  ~RxPacketStreamPublisher() override {
+    ensemble_->removeHwEventObserver(this);
+  }
+
+ private:
+  void packetReceived(RxPacket* pkt) noexcept override {
+    service_->broadcast(
+        folly::to<std::string>(pkt->getSrcPort()), *pkt->buf());
+  }
+  void linkStateChanged(PortID /*port*/, bool /*up*/) override {}
+  void l2LearningUpdateReceived(
+      L2Entry /*l2Entry*/,
+      L2EntryUpdateType /*l2EntryUpdateType*/) override {}
+
+  HwSwitchEnsemble* ensemble_;
+  PacketStreamService* service_;
+};
+
+} // namespace
+
 void runRxSlowPathBenchmark() {
   constexpr int kEcmpWidth = 1;
   auto ensemble = createHwEnsemble(HwSwitchEnsemble::getAllFeatures());
@@ -66,6 +141,38 @@ void runRxSlowPathBenchmark() {
   utility::disableTTLDecrements(
       hwSwitch, ecmpHelper.getRouterId(), ecmpHelper.getNextHops()[0]);
 
+  // Fan the packets out to observers and packet stream clients, as the
+  // agent would with packet captures and services like mka attached
+  std::vector<std::unique_ptr<HwTestPacketSnooper>> observers;
+  for (int i = 0; i < FLAGS_rx_observers; ++i) {
+    observers.push_back(std::make_unique<HwTestPacketSnooper>(ensemble.get()));
+  }
+  auto streamService = std::make_shared<RxPacketStreamService>();
+  std::unique_ptr<apache::thrift::ScopedServerInterfaceThread> streamServer;
+  folly::ScopedEventBaseThread streamClientThread;
+  std::vector<std::unique_ptr<RxPacketStreamClient>> streamClients;
+  std::unique_ptr<RxPacketStreamPublisher> streamPublisher;
+  if (FLAGS_rx_packet_streams > 0) {
+    streamServer =
+        std::make_unique<apache::thrift::ScopedServerInterfaceThread>(
+            streamService);
+    for (int i = 0; i < FLAGS_rx_packet_streams; ++i) {
+      auto client = std::make_unique<RxPacketStreamClient>(
+          folly::to<std::string>("client", i),
+          streamClientThread.getEventBase());
+      client->connectToServer("::1", streamServer->getPort());
+      for (auto retry = 0; retry < 50 && !client->isConnectedToServer();
+           ++retry) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      }
+      CHECK(client->isConnectedToServer());
+      client->registerPortToServer(folly::to<std::string>(portUsed));
+      streamClients.push_back(std::move(client));
+    }
+    streamPublisher = std::make_unique<RxPacketStreamPublisher>(
+        ensemble.get(), streamService.get());
+  }
+
   const auto kSrcMac = folly::MacAddress{"fa:ce:b0:00:00:0c"};
   // Send packet
   auto txPacket = utility::makeUDPTxPacket(
@@ -104,11 +211,17 @@ void runRxSlowPathBenchmark() {
     folly::dynamic cpuRxRateJson = folly::dynamic::object;
     cpuRxRateJson["cpu_rx_pps"] = pps;
     cpuRxRateJson["cpu_rx_bytes_per_sec"] = bytesPerSec;
+    cpuRxRateJson["rx_observers"] = FLAGS_rx_observers;
+    cpuRxRateJson["rx_packet_streams"] = FLAGS_rx_packet_streams;
+    cpuRxRateJson["packet_stream_copies_saved"] =
+        streamService->getCopiesSaved();
     std::cout << toPrettyJson(cpuRxRateJson) << std::endl;
   } else {
     XLOG(DBG2) << " Pkts before: " << pktsBefore << " Pkts after: " << pktsAfter
                << " interval ms: " << durationMillseconds.count()
-               << " pps: " << pps << " bytes per sec: " << bytesPerSec;
+               << " pps: " << pps << " bytes per sec: " << bytesPerSec
+               << " packet stream copies saved: "
+               << streamService->getCopiesSaved();
   }
 }
 } // namespace facebook::fboss
@@ -196,6 +196,15 @@ cfg::InterfaceType SaiNeighborManager::getNeighborRifType(
   throw FbossError("Could not find neighbor: ", saiEntry.ip().str());
 }
 
+std::optional<SaiPortDescriptor> SaiNeighborManager::getNeighborSaiPortDesc(
+    const SaiNeighborTraits::NeighborEntry& saiEntry) const {
+  auto itr = neighbors_.find(saiEntry);
+  if (itr == neighbors_.end()) {
+    return std::nullopt;
+  }
+  return itr->second->getSaiPortDesc();
+}
+
 std::string SaiNeighborManager::listManagedObjects() const {
   std::string output{};
   for (const auto& entry : neighbors_) {
@@ -260,7 +269,9 @@ PortRifNeighbor::PortRifNeighbor(
     std::optional<sai_uint32_t> metadata,
     std::optional<sai_uint32_t> encapIndex,
     bool isLocal)
-    : manager_(manager), handle_(std::make_unique<SaiNeighborHandle>()) {
+    : manager_(manager),
+      saiPortDesc_(std::get<SaiPortDescriptor>(saiPortAndIntf)),
+      handle_(std::make_unique<SaiNeighborHandle>()) {
   const auto& ip = std::get<folly::IPAddress>(intfIDAndIpAndMac);
   auto rifSaiId = std::get<RouterInterfaceSaiId>(saiPortAndIntf);
   auto adapterHostKey = SaiNeighborTraits::NeighborEntry(
@@ -22,6 +22,7 @@
 #include <fmt/format.h>
 #include <memory>
 #include <mutex>
+#include <optional>
 
 namespace facebook::fboss {
 
@@ -70,11 +71,11 @@ class ManagedVlanRifNeighbor : public SaiObjectEventAggregateSubscriber<
 
   std::string toString() const;
 
- private:
   SaiPortDescriptor getSaiPortDesc() const {
     return std::get<SaiPortDescriptor>(saiPortAndIntf_);
   }
 
+ private:
   RouterInterfaceSaiId getRouterInterfaceSaiId() const {
     return std::get<RouterInterfaceSaiId>(saiPortAndIntf_);
   }
@@ -112,8 +113,13 @@ class PortRifNeighbor {
     return fmt::format("{}", neighbor_->attributes());
   }
 
+  SaiPortDescriptor getSaiPortDesc() const {
+    return saiPortDesc_;
+  }
+
  private:
   SaiNeighborManager* manager_;
+  SaiPortDescriptor saiPortDesc_;
   std::shared_ptr<SaiNeighbor> neighbor_;
   std::unique_ptr<SaiNeighborHandle> handle_;
 };
@@ -134,6 +140,10 @@ class SaiNeighborEntry {
   }
 
   cfg::InterfaceType getRifType() const;
+  SaiPortDescriptor getSaiPortDesc() const {
+    return std::visit(
+        [](auto& handle) { return handle->getSaiPortDesc(); }, neighbor_);
+  }
   SaiNeighborHandle* getHandle() const {
     return std::visit(
         [](auto& handle) { return handle->getHandle(); }, neighbor_);
@@ -186,6 +196,12 @@ class SaiNeighborManager {
   cfg::InterfaceType getNeighborRifType(
       const SaiNeighborTraits::NeighborEntry& entry) const;
 
+  /*
+   * Port (or LAG) the neighbor was learnt on, if we know of the neighbor
+   */
+  std::optional<SaiPortDescriptor> getNeighborSaiPortDesc(
+      const SaiNeighborTraits::NeighborEntry& entry) const;
+
   void clear();
 
   std::shared_ptr<SaiNeighbor> createSaiObject(
@@ -155,6 +155,65 @@ std::string SaiNextHopGroupManager::listManagedObjects() const {
   return finalOutput;
 }
 
+void SaiNextHopGroupManager::handleLinkDown(SaiPortDescriptor port) {
+  auto itr = portToMembers_.find(port);
+  if (itr == portToMembers_.end()) {
+    return;
+  }
+  auto members = std::move(itr->second);
+  portToMembers_.erase(itr);
+  XLOG(DBG2) << "link down on " << port.str() << ", removing "
+             << members.size() << " next hop group members";
+  // In fixed width mode, the weights of the remaining members need to be
+  // reprogrammed before removing members. Do that once per group rather
+  // than once per member going down.
+  folly::F14FastMap<
+      SaiNextHopGroupHandle*,
+      std::vector<SaiNextHopGroupMemberInfo>>
+      fixedWidthMembersRemoved;
+  for (auto member : members) {
+    std::visit(
+        [&fixedWidthMembersRemoved](auto* managedMember) {
+          if (auto memberInfo = managedMember->getFixedWidthMemberInfo()) {
+            fixedWidthMembersRemoved[managedMember->getNextHopGroupHandle()]
+                .push_back(*memberInfo);
+          }
+        },
+        member);
+  }
+  for (const auto& [nhgroup, memberInfos] : fixedWidthMembersRemoved) {
+    nhgroup->membersRemoved(memberInfos);
+  }
+  for (auto member : members) {
+    std::visit(
+        [](auto* managedMember) { managedMember->handleLinkDown(); }, member);
+  }
+}
+
+std::optional<SaiPortDescriptor> SaiNextHopGroupManager::addToPortIndex(
+    const SaiNeighborTraits::NeighborEntry& neighbor,
+    ManagedNextHopGroupMemberPtr member) {
+  auto port =
+      managerTable_->neighborManager().getNeighborSaiPortDesc(neighbor);
+  if (port) {
+    portToMembers_[*port].insert(member);
+  }
+  return port;
+}
+
+void SaiNextHopGroupManager::removeFromPortIndex(
+    SaiPortDescriptor port,
+    ManagedNextHopGroupMemberPtr member) {
+  auto itr = portToMembers_.find(port);
+  if (itr == portToMembers_.end()) {
+    return;
+  }
+  itr->second.erase(member);
+  if (itr->second.empty()) {
+    portToMembers_.erase(itr);
+  }
+}
+
 NextHopGroupMember::NextHopGroupMember(
     SaiNextHopGroupManager* manager,
     SaiNextHopGroupHandle* nhgroup,
@@ -220,6 +279,8 @@ void ManagedSaiNextHopGroupMember<NextHopTraits>::createObject(
     // notify nhgroup to bulk program correct weight
     nhgroup_->memberAdded({adapterHostKey, weight_}, bulkUpdate);
   }
+  removeFromPortIndex();
+  port_ = manager_->addToPortIndex(managedNextHop_->getPublisherKey(), this);
   XLOG(DBG2) << "ManagedSaiNextHopGroupMember::createObject: " << toString();
 }
 
@@ -229,7 +290,9 @@ void ManagedSaiNextHopGroupMember<NextHopTraits>::removeObject(
     typename ManagedSaiNextHopGroupMember<NextHopTraits>::PublisherObjects
     /* removed */) {
   XLOG(DBG2) << "ManagedSaiNextHopGroupMember::removeObject: " << toString();
-  if (fixedWidthMode_) {
+  removeFromPortIndex();
+  // Member may already be gone if the link of the next hop went down
+  if (fixedWidthMode_ && this->getObject()) {
     // notify nhgroup to bulk program with 0 weight. In fixed width mode
     // member cannot be removed directly. check comments associated with
     // SaiNextHopGroupHandle::bulkProgramMembers for details
@@ -239,6 +302,32 @@ void ManagedSaiNextHopGroupMember<NextHopTraits>::removeObject(
   this->resetObject();
 }
 
+template <typename NextHopTraits>
+void ManagedSaiNextHopGroupMember<NextHopTraits>::handleLinkDown() {
+  XLOG(DBG2) << "ManagedSaiNextHopGroupMember::handleLinkDown: "
+             << toString();
+  removeFromPortIndex();
+  this->resetObject();
+}
+
+template <typename NextHopTraits>
+std::optional<SaiNextHopGroupMemberInfo>
+ManagedSaiNextHopGroupMember<NextHopTraits>::getFixedWidthMemberInfo() const {
+  if (!fixedWidthMode_ || !this->getObject()) {
+    return std::nullopt;
+  }
+  return SaiNextHopGroupMemberInfo{
+      this->getObject()->adapterHostKey(), weight_};
+}
+
+template <typename NextHopTraits>
+void ManagedSaiNextHopGroupMember<NextHopTraits>::removeFromPortIndex() {
+  if (port_) {
+    manager_->removeFromPortIndex(*port_, this);
+    port_.reset();
+  }
+}
+
 size_t SaiNextHopGroupHandle::nextHopGroupSize() const {
   return std::count_if(
       std::begin(members_), std::end(members_), [](auto member) {
@@ -249,13 +338,18 @@ size_t SaiNextHopGroupHandle::nextHopGroupSize() const {
 void SaiNextHopGroupHandle::memberAdded(
     SaiNextHopGroupMemberInfo memberInfo,
     bool updateHardware) {
-  bulkProgramMembers(memberInfo, true /* added */, updateHardware);
+  bulkProgramMembers({memberInfo}, true /* added */, updateHardware);
 }
 
 void SaiNextHopGroupHandle::memberRemoved(
     SaiNextHopGroupMemberInfo memberInfo,
     bool updateHardware) {
-  bulkProgramMembers(memberInfo, false /* added */, updateHardware);
+  bulkProgramMembers({memberInfo}, false /* added */, updateHardware);
+}
+
+void SaiNextHopGroupHandle::membersRemoved(
+    const std::vector<SaiNextHopGroupMemberInfo>& memberInfos) {
+  bulkProgramMembers(memberInfos, false /* added */, true /* updateHardware */);
 }
 
 /*
@@ -278,18 +372,25 @@ void SaiNextHopGroupHandle::memberRemoved(
  *     - Remove the member with weight 0 from nexthop group
  */
 void SaiNextHopGroupHandle::bulkProgramMembers(
-    SaiNextHopGroupMemberInfo modifiedMemberInfo,
+    const std::vector<SaiNextHopGroupMemberInfo>& modifiedMemberInfos,
     bool added,
     bool updateHardware) {
-  if (added) {
-    fixedWidthNextHopGroupMembers_.insert(modifiedMemberInfo);
-  } else {
-    if (fixedWidthNextHopGroupMembers_.find(modifiedMemberInfo) ==
-        fixedWidthNextHopGroupMembers_.end()) {
-      XLOG(DBG2) << "Cannot find member to delete for fixed width ecmp";
-      return;
+  std::vector<SaiNextHopGroupMemberInfo> removedMemberInfos;
+  for (const auto& modifiedMemberInfo : modifiedMemberInfos) {
+    if (added) {
+      fixedWidthNextHopGroupMembers_.insert(modifiedMemberInfo);
+    } else {
+      if (fixedWidthNextHopGroupMembers_.find(modifiedMemberInfo) ==
+          fixedWidthNextHopGroupMembers_.end()) {
+        XLOG(DBG2) << "Cannot find member to delete for fixed width ecmp";
+        continue;
+      }
+      fixedWidthNextHopGroupMembers_.erase(modifiedMemberInfo);
+      removedMemberInfos.push_back(modifiedMemberInfo);
     }
-    fixedWidthNextHopGroupMembers_.erase(modifiedMemberInfo);
+  }
+  if (!added && removedMemberInfos.empty()) {
+    return;
   }
   if (!updateHardware) {
     return;
@@ -314,10 +415,10 @@ void SaiNextHopGroupHandle::bulkProgramMembers(
     adapterHostKeys.emplace_back(adapterHostKey);
     weights.emplace_back(memberWeights.at(idx++));
   }
-  // For removed entry, set the weight to 0 before deleting
-  // the member from hardware
-  if (!added) {
-    adapterHostKeys.emplace_back(modifiedMemberInfo.first);
+  // For removed entries, set the weight to 0 before deleting
+  // the members from hardware
+  for (const auto& removedMemberInfo : removedMemberInfos) {
+    adapterHostKeys.emplace_back(removedMemberInfo.first);
     weights.emplace_back(0);
   }
   if (adapterHostKeys.size()) {
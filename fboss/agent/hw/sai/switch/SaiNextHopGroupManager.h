@@ -21,6 +21,8 @@
 #include "fboss/lib/RefMap.h"
 
 #include <memory>
+#include <optional>
+#include <variant>
 #include "folly/container/F14Map.h"
 #include "folly/container/F14Set.h"
 
@@ -79,6 +81,7 @@ class ManagedSaiNextHopGroupMember
         fixedWidthMode_(fixedWidthMode) {}
 
   ~ManagedSaiNextHopGroupMember() {
+    removeFromPortIndex();
     this->resetObject();
   }
 
@@ -86,19 +89,41 @@ class ManagedSaiNextHopGroupMember
 
   void removeObject(size_t index, PublisherObjects removed);
 
-  void handleLinkDown() {}
+  /*
+   * Remove the member ahead of its next hop going away, on the port
+   * of the next hop going down. Fixed width groups are expected to have
+   * been reprogrammed already, see SaiNextHopGroupManager::handleLinkDown.
+   */
+  void handleLinkDown();
+
+  SaiNextHopGroupHandle* getNextHopGroupHandle() const {
+    return nhgroup_;
+  }
+
+  /*
+   * Member info for fixed width groups, if the member is programmed
+   */
+  std::optional<SaiNextHopGroupMemberInfo> getFixedWidthMemberInfo() const;
 
   std::string toString() const;
 
  private:
+  void removeFromPortIndex();
+
   SaiNextHopGroupManager* manager_;
   SaiNextHopGroupHandle* nhgroup_;
   std::shared_ptr<ManagedNextHop<NextHopTraits>> managedNextHop_;
   SaiNextHopGroupTraits::AdapterKey nexthopGroupId_;
   NextHopWeight weight_;
   bool fixedWidthMode_;
+  // Port the next hop resolved over, as indexed by SaiNextHopGroupManager
+  std::optional<SaiPortDescriptor> port_;
 };
 
+using ManagedNextHopGroupMemberPtr = std::variant<
+    ManagedSaiNextHopGroupMember<SaiIpNextHopTraits>*,
+    ManagedSaiNextHopGroupMember<SaiMplsNextHopTraits>*>;
+
 class NextHopGroupMember {
  public:
   using ManagedIpNextHopGroupMember =
@@ -158,8 +183,10 @@ struct SaiNextHopGroupHandle {
   void memberRemoved(
       SaiNextHopGroupMemberInfo memberInfo,
       bool updateHardware = true);
+  void membersRemoved(
+      const std::vector<SaiNextHopGroupMemberInfo>& memberInfos);
   void bulkProgramMembers(
-      SaiNextHopGroupMemberInfo modifiedMemberInfo,
+      const std::vector<SaiNextHopGroupMemberInfo>& modifiedMemberInfos,
       bool added,
       bool updateHardware);
   ~SaiNextHopGroupHandle();
@@ -187,12 +214,36 @@ class SaiNextHopGroupManager {
 
   std::string listManagedObjects() const;
 
+  /*
+   * Link down fast path. Remove the members of all next hop groups whose
+   * next hop resolved over the port, without waiting for the neighbors or
+   * next hops to go away. Members get added back as the next hops are
+   * recreated once neighbors resolve again.
+   */
+  void handleLinkDown(SaiPortDescriptor port);
+
+  /*
+   * Track programmed members by the port their next hop resolved over.
+   * Returns the port the member got indexed under, if any.
+   */
+  std::optional<SaiPortDescriptor> addToPortIndex(
+      const SaiNeighborTraits::NeighborEntry& neighbor,
+      ManagedNextHopGroupMemberPtr member);
+  void removeFromPortIndex(
+      SaiPortDescriptor port,
+      ManagedNextHopGroupMemberPtr member);
+
  private:
   bool isFixedWidthNextHopGroup(
       const RouteNextHopEntry::NextHopSet& swNextHops) const;
   SaiStore* saiStore_;
   SaiManagerTable* managerTable_;
   const SaiPlatform* platform_;
+  // Declared ahead of the members, which remove themselves on destruction
+  folly::F14FastMap<
+      SaiPortDescriptor,
+      folly::F14FastSet<ManagedNextHopGroupMemberPtr>>
+      portToMembers_;
   // TODO(borisb): improve SaiObject/SaiStore to the point where they
   // support the next hop group use case correctly, rather than this
   // abomination of multiple levels of RefMaps :(
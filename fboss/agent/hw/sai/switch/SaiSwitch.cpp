@@ -57,7 +57,12 @@
 #include "fboss/agent/platforms/sai/SaiPlatform.h"
 
 #include "fboss/agent/rib/RoutingInformationBase.h"
+#include "fboss/agent/state/DeltaFunctions.h"
+#include "fboss/agent/state/Interface.h"
+#include "fboss/agent/state/InterfaceMap.h"
 #include "fboss/agent/state/Port.h"
+#include "fboss/agent/state/SflowCollector.h"
+#include "fboss/agent/state/SflowCollectorMap.h"
 #include "fboss/agent/state/StateDelta.h"
 #include "fboss/agent/state/SwitchState.h"
 
@@ -68,6 +73,7 @@
 #include "fboss/lib/phy/PhyUtils.h"
 #include "fboss/lib/phy/gen-cpp2/phy_types.h"
 
+#include <folly/ExceptionString.h>
 #include <folly/logging/xlog.h>
 
 #include <chrono>
@@ -139,6 +145,9 @@ std::string fdbEventToString(sai_fdb_event_t event) {
 
 static std::set<facebook::fboss::cfg::PacketRxReason> kAllowedRxReasons = {
     facebook::fboss::cfg::PacketRxReason::TTL_1};
+
+// Bytes of a sampled packet's header exported as sFlow v5 flow sample
+constexpr size_t kMaxSflowSnapLen = 128;
 } // namespace
 
 namespace facebook::fboss {
@@ -215,6 +224,11 @@ SaiSwitch::SaiSwitch(SaiPlatform* platform, uint32_t featuresDesired)
       saiStore_(std::make_unique<SaiStore>()) {
   utilCreateDir(platform_->getVolatileStateDir());
   utilCreateDir(platform_->getPersistentStateDir());
+  if (FLAGS_sflow_v5_export) {
+    sflowExporter_ = std::make_unique<SflowV5Exporter>(
+        FLAGS_sflow_v5_max_datagram_size,
+        std::chrono::milliseconds(FLAGS_sflow_v5_flush_interval_ms));
+  }
 }
 
 SaiSwitch::~SaiSwitch() {}
@@ -826,9 +840,135 @@ std::shared_ptr<SwitchState> SaiSwitch::stateChangedImpl(
   // Process link state change delta and update the LED status
   processLinkStateChangeDelta(delta, lockPolicy);
 
+  if (sflowExporter_) {
+    processSflowDelta(delta);
+  }
+
   return delta.newState();
 }
 
+void SaiSwitch::processSflowDelta(const StateDelta& delta) {
+  // The hardware is already programmed, a bad collector only loses samples
+  auto addCollector = [&](const std::shared_ptr<SflowCollector>& collector) {
+    try {
+      sflowExporter_->addCollector(
+          collector->getID(), collector->getAddress());
+    } catch (const fboss::thrift::FbossBaseError& ex) {
+      XLOG(ERR) << "Could not add sFlow collector: "
+                << collector->getAddress().getFullyQualified()
+                << " reason: " << folly::exceptionStr(ex);
+    }
+  };
+  DeltaFunctions::forEachChanged(
+      delta.getSflowCollectorsDelta(),
+      [&](const std::shared_ptr<SflowCollector>& oldCollector,
+          const std::shared_ptr<SflowCollector>& newCollector) {
+        sflowExporter_->removeCollector(oldCollector->getID());
+        addCollector(newCollector);
+      },
+      addCollector,
+      [&](const std::shared_ptr<SflowCollector>& oldCollector) {
+        sflowExporter_->removeCollector(oldCollector->getID());
+      });
+
+  auto updatePort = [&](const std::shared_ptr<Port>& port) {
+    auto sflowPorts = sflowPorts_.wlock();
+    if (!port->getSflowIngressRate() && !port->getSflowEgressRate()) {
+      sflowPorts->erase(port->getID());
+      return;
+    }
+    auto& info = (*sflowPorts)[port->getID()];
+    info.ingressRate = port->getSflowIngressRate();
+    info.egressRate = port->getSflowEgressRate();
+    info.speedBps = static_cast<uint64_t>(port->getSpeed()) * 1000000;
+    info.up = port->isUp();
+  };
+  DeltaFunctions::forEachChanged(
+      delta.getPortsDelta(),
+      [&](const std::shared_ptr<Port>& /* oldPort */,
+          const std::shared_ptr<Port>& newPort) { updatePort(newPort); },
+      [&](const std::shared_ptr<Port>& newPort) { updatePort(newPort); },
+      [&](const std::shared_ptr<Port>& oldPort) {
+        sflowPorts_.wlock()->erase(oldPort->getID());
+      });
+
+  // Agent address is the first global v6 address of the switch, if any
+  if (DeltaFunctions::isEmpty(delta.getIntfsDelta())) {
+    return;
+  }
+  for (const auto& intf : *delta.newState()->getInterfaces()) {
+    for (const auto& addrAndMask : intf->getAddresses()) {
+      const auto& addr = addrAndMask.first;
+      if (addr.isV6() && !addr.isLinkLocal() && !addr.isLoopback()) {
+        sflowExporter_->setAgentAddress(addr);
+        return;
+      }
+    }
+  }
+}
+
+bool SaiSwitch::exportSflowSample(
+    const SaiRxPacket& rxPacket,
+    PortID swPortId,
+    VlanID swVlanId) {
+  if (!sflowExporter_ || !sflowExporter_->numCollectors()) {
+    return false;
+  }
+  uint32_t samplingRate = 0;
+  {
+    auto sflowPorts = sflowPorts_.rlock();
+    auto it = sflowPorts->find(swPortId);
+    if (it != sflowPorts->end()) {
+      // Trapped samples are taken on ingress unless only egress is enabled
+      const auto& rates = it->second;
+      samplingRate = rates.ingressRate ? rates.ingressRate : rates.egressRate;
+    }
+  }
+  SflowPacketInfo info;
+  auto duration = std::chrono::system_clock::now().time_since_epoch();
+  *info.timestamp()->seconds() =
+      std::chrono::duration_cast<std::chrono::seconds>(duration).count();
+  *info.timestamp()->nanoseconds() =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          duration % std::chrono::seconds(1))
+          .count();
+  *info.ingressSampled() = true;
+  info.srcPort() = static_cast<uint16_t>(swPortId);
+  info.vlan() = static_cast<uint16_t>(swVlanId);
+  auto buf = rxPacket.buf();
+  info.frameLength() = buf->computeChainDataLength();
+  auto snapLen = std::min<size_t>(kMaxSflowSnapLen, buf->length());
+  info.packetData() =
+      std::string(reinterpret_cast<const char*>(buf->data()), snapLen);
+  sflowExporter_->addFlowSample(info, samplingRate);
+  return true;
+}
+
+void SaiSwitch::exportSflowCounters() {
+  if (!sflowExporter_) {
+    return;
+  }
+  auto now = std::chrono::steady_clock::now();
+  if (FLAGS_sflow_v5_counter_interval_s && sflowExporter_->numCollectors() &&
+      now - lastSflowCounterSamples_ >=
+          std::chrono::seconds(FLAGS_sflow_v5_counter_interval_s)) {
+    lastSflowCounterSamples_ = now;
+    auto sflowPorts = sflowPorts_.copy();
+    std::map<PortID, HwPortStats> portStats;
+    {
+      std::lock_guard<std::mutex> locked(saiSwitchMutex_);
+      portStats = managerTable_->portManager().getPortStats();
+    }
+    for (const auto& [port, info] : sflowPorts) {
+      auto it = portStats.find(port);
+      if (it != portStats.end()) {
+        sflowExporter_->addCounterSample(
+            port, it->second, info.speedBps, info.up);
+      }
+    }
+  }
+}
+
 template <typename LockPolicyT>
 void SaiSwitch::updateResourceUsage(const LockPolicyT& lockPolicy) {
   [[maybe_unused]] const auto& lock = lockPolicy.lock();
@@ -1388,10 +1528,17 @@ void SaiSwitch::linkStateChangedCallbackBottomHalf(
         if (!managerTable_->lagManager().isMinimumLinkMet(swAggPort.value())) {
           // remove fdb entries on LAG, this would remove neighbors, next hops
           // will point to drop and next hop group will shrink.
+          managerTable_->nextHopGroupManager().handleLinkDown(
+              SaiPortDescriptor(swAggPort.value()));
           managerTable_->fdbManager().handleLinkDown(
               SaiPortDescriptor(swAggPort.value()));
         }
       }
+      // Shrink next hop groups right away, rather than once the link down
+      // makes it through fdb entries, neighbors and next hops. Those catch
+      // up with the members already gone.
+      managerTable_->nextHopGroupManager().handleLinkDown(
+          SaiPortDescriptor(swPortId));
       managerTable_->fdbManager().handleLinkDown(SaiPortDescriptor(swPortId));
       /*
        * Enable AFE adaptive mode (S249471) on TAJO platforms when a port
@@ -1843,6 +1990,10 @@ void SaiSwitch::packetRxCallbackPort(
              << " trap: " << packetRxReasonToString(rxReason);
   folly::io::Cursor c0(rxPacket->buf());
   XLOG(DBG6) << PktUtil::hexDump(c0);
+  if (rxReason == cfg::PacketRxReason::SAMPLEPACKET &&
+      exportSflowSample(*rxPacket, swPortId, swVlanId)) {
+    return;
+  }
   callback_->packetReceived(std::move(rxPacket));
 }
 
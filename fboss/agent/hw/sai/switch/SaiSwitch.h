@@ -12,6 +12,7 @@
 #include "fboss/agent/HwSwitch.h"
 #include "fboss/agent/L2Entry.h"
 #include "fboss/agent/hw/HwSwitchStats.h"
+#include "fboss/agent/hw/SflowV5Exporter.h"
 #include "fboss/agent/hw/gen-cpp2/hardware_stats_types.h"
 #include "fboss/agent/hw/sai/api/SaiApiTable.h"
 #include "fboss/agent/hw/sai/switch/SaiManagerTable.h"
@@ -20,6 +21,7 @@
 #include "fboss/agent/platforms/sai/SaiPlatform.h"
 #include "folly/MacAddress.h"
 
+#include <folly/Synchronized.h>
 #include <folly/io/async/EventBase.h>
 #include "fboss/agent/hw/switch_asics/HwAsic.h"
 
@@ -418,6 +420,17 @@ class SaiSwitch : public HwSwitch {
 
   PortSaiId getCPUPortSaiId() const;
 
+  void processSflowDelta(const StateDelta& delta);
+  /*
+   * Queue a packet trapped for sampling as an sFlow v5 flow sample.
+   * Returns false if it is not to be exported that way.
+   */
+  bool exportSflowSample(
+      const SaiRxPacket& rxPacket,
+      PortID swPortId,
+      VlanID swVlanId);
+  void exportSflowCounters();
+
   void packetRxCallbackPort(
       sai_size_t buffer_size,
       const void* buffer,
@@ -493,6 +506,21 @@ class SaiSwitch : public HwSwitch {
   cfg::SwitchType switchType_{cfg::SwitchType::NPU};
 
   std::map<PortID, phy::PhyInfo> lastPhyInfos_;
+
+  /*
+   * sFlow v5 export, only with --sflow_v5_export. Sampling rates, speed and
+   * oper state of the sampled ports are mirrored from the switch state for
+   * the rx and stats paths to use without taking saiSwitchMutex_.
+   */
+  struct SflowPortInfo {
+    uint32_t ingressRate{0};
+    uint32_t egressRate{0};
+    uint64_t speedBps{0};
+    bool up{false};
+  };
+  std::unique_ptr<SflowV5Exporter> sflowExporter_;
+  folly::Synchronized<std::map<PortID, SflowPortInfo>> sflowPorts_;
+  std::chrono::steady_clock::time_point lastSflowCounterSamples_;
 };
 
 } // namespace facebook::fboss
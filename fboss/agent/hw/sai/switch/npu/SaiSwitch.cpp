@@ -67,5 +67,6 @@ void SaiSwitch::updateStatsImpl(SwitchStats* /* switchStats */) {
     std::lock_guard<std::mutex> locked(saiSwitchMutex_);
     managerTable_->counterManager().updateStats();
   }
+  exportSflowCounters();
 }
 } // namespace facebook::fboss
@@ -166,6 +166,32 @@ TEST_F(NextHopGroupManagerTest, unresolveNeighbor) {
   checkNextHopGroup(saiNextHopGroup->adapterKey(), {});
 }
 
+TEST_F(NextHopGroupManagerTest, linkDown) {
+  auto arpEntry0 = resolveArp(intf0.id, h0);
+  auto arpEntry1 = resolveArp(intf1.id, h1);
+  ResolvedNextHop nh1{h0.ip, InterfaceID(intf0.id), ECMP_WEIGHT};
+  ResolvedNextHop nh2{h1.ip, InterfaceID(intf1.id), ECMP_WEIGHT};
+  RouteNextHopEntry::NextHopSet swNextHops{nh1, nh2};
+  auto saiNextHopGroupHandle =
+      saiManagerTable->nextHopGroupManager().incRefOrAddNextHopGroup(
+          swNextHops);
+  auto saiNextHopGroup = saiNextHopGroupHandle->nextHopGroup;
+  checkNextHopGroup(saiNextHopGroup->adapterKey(), {h0.ip, h1.ip});
+  saiManagerTable->nextHopGroupManager().handleLinkDown(
+      SaiPortDescriptor(PortID(h0.port.id)));
+  checkNextHopGroup(saiNextHopGroup->adapterKey(), {h1.ip});
+  // Rest of link down handling and neighbor removal catch up
+  saiManagerTable->fdbManager().handleLinkDown(
+      SaiPortDescriptor(PortID(h0.port.id)));
+  saiManagerTable->neighborManager().removeNeighbor(arpEntry0);
+  checkNextHopGroup(saiNextHopGroup->adapterKey(), {h1.ip});
+  // Member is added back once the neighbor resolves again
+  saiManagerTable->fdbManager().removeFdbEntry(
+      arpEntry0->getIntfID(), arpEntry0->getMac());
+  arpEntry0 = resolveArp(intf0.id, h0);
+  checkNextHopGroup(saiNextHopGroup->adapterKey(), {h0.ip, h1.ip});
+}
+
 TEST_F(NextHopGroupManagerTest, derefThenResolve) {
   ResolvedNextHop nh1{h0.ip, InterfaceID(intf0.id), ECMP_WEIGHT};
   ResolvedNextHop nh2{h1.ip, InterfaceID(intf1.id), ECMP_WEIGHT};
@@ -0,0 +1,123 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/agent/hw/sai/switch/SaiFdbManager.h"
+#include "fboss/agent/hw/sai/switch/SaiNeighborManager.h"
+#include "fboss/agent/hw/sai/switch/SaiNextHopGroupManager.h"
+#include "fboss/agent/hw/sai/switch/tests/ManagerTestBase.h"
+#include "fboss/agent/state/RouteNextHopEntry.h"
+
+#include <folly/Benchmark.h>
+#include <folly/init/Init.h>
+
+/*
+ * FakeSai counterpart of HwEcmpShrinkSpeedBenchmark. Times shrinking the
+ * next hop groups going over a port when that port goes down, either
+ * through the next hop group manager link down fast path, or by relying
+ * solely on the link down making its way from fdb entries to neighbors,
+ * next hops and finally next hop group members.
+ */
+
+namespace facebook::fboss {
+
+namespace {
+
+class NextHopGroupShrinkSetup : public ManagerTestBase {
+ public:
+  explicit NextHopGroupShrinkSetup(int numGroups) {
+    setupStage = SetupStage::PORT | SetupStage::VLAN | SetupStage::INTERFACE;
+    ManagerTestBase::SetUp();
+    std::vector<ResolvedNextHop> otherNextHops;
+    for (const auto& testInterface : testInterfaces) {
+      for (const auto& remoteHost : testInterface.remoteHosts) {
+        arpEntries_.push_back(resolveArp(testInterface.id, remoteHost));
+        ResolvedNextHop nextHop{
+            remoteHost.ip, InterfaceID(testInterface.id), ECMP_WEIGHT};
+        if (remoteHost.port.id == downPort().id) {
+          downNextHop_ = nextHop;
+        } else {
+          otherNextHops.push_back(nextHop);
+        }
+      }
+    }
+    // Every group goes over the port brought down, along with a distinct
+    // subset of the other next hops.
+    CHECK_LT(numGroups, 1 << otherNextHops.size());
+    for (int group = 1; group <= numGroups; ++group) {
+      RouteNextHopEntry::NextHopSet swNextHops{*downNextHop_};
+      for (size_t i = 0; i < otherNextHops.size(); ++i) {
+        if (group & (1 << i)) {
+          swNextHops.insert(otherNextHops[i]);
+        }
+      }
+      handles_.push_back(
+          saiManagerTable->nextHopGroupManager().incRefOrAddNextHopGroup(
+              swNextHops));
+    }
+  }
+
+  ~NextHopGroupShrinkSetup() override {
+    handles_.clear();
+    ManagerTestBase::TearDown();
+  }
+
+  void TestBody() override {}
+
+  SaiPortDescriptor downPortDesc() const {
+    return SaiPortDescriptor(PortID(downPort().id));
+  }
+
+ private:
+  const TestPort& downPort() const {
+    return testInterfaces[0].remoteHosts[0].port;
+  }
+
+  std::vector<std::shared_ptr<ArpEntry>> arpEntries_;
+  std::optional<ResolvedNextHop> downNextHop_;
+  std::vector<std::shared_ptr<SaiNextHopGroupHandle>> handles_;
+};
+
+} // namespace
+
+void shrinkViaFdbLinkDown(unsigned iters, int numGroups) {
+  folly::BenchmarkSuspender suspender;
+  for (unsigned i = 0; i < iters; ++i) {
+    NextHopGroupShrinkSetup setup(numGroups);
+    suspender.dismiss();
+    setup.saiManagerTable->fdbManager().handleLinkDown(setup.downPortDesc());
+    suspender.rehire();
+  }
+}
+
+void shrinkViaNextHopGroupLinkDown(unsigned iters, int numGroups) {
+  folly::BenchmarkSuspender suspender;
+  for (unsigned i = 0; i < iters; ++i) {
+    NextHopGroupShrinkSetup setup(numGroups);
+    suspender.dismiss();
+    setup.saiManagerTable->nextHopGroupManager().handleLinkDown(
+        setup.downPortDesc());
+    suspender.rehire();
+  }
+}
+
+BENCHMARK_PARAM(shrinkViaFdbLinkDown, 16);
+BENCHMARK_RELATIVE_PARAM(shrinkViaNextHopGroupLinkDown, 16);
+BENCHMARK_PARAM(shrinkViaFdbLinkDown, 256);
+BENCHMARK_RELATIVE_PARAM(shrinkViaNextHopGroupLinkDown, 256);
+BENCHMARK_PARAM(shrinkViaFdbLinkDown, 4000);
+BENCHMARK_RELATIVE_PARAM(shrinkViaNextHopGroupLinkDown, 4000);
+
+} // namespace facebook::fboss
+
+int main(int argc, char** argv) {
+  folly::init(&argc, &argv, true);
+  folly::runBenchmarks();
+  return 0;
+}
@@ -0,0 +1,273 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/agent/hw/sai/tracer/BinaryTrace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+
+#include "fboss/agent/FbossError.h"
+
+namespace {
+
+template <typename T>
+uint32_t loggedListCount(const T* list, uint32_t count, size_t maxEntries) {
+  return list ? std::min<size_t>(count, maxEntries) : 0;
+}
+
+} // namespace
+
+namespace facebook::fboss {
+
+// Records are told apart from the next boot by their op, see BinaryTrace.h
+static_assert(
+    static_cast<uint8_t>(BinaryTraceOp::CLEAR_STATS) <
+    BinaryTraceFileHeader::kMagic[offsetof(BinaryTraceRecordHeader, op)]);
+
+BinaryTraceRecord::BinaryTraceRecord(
+    BinaryTraceOp op,
+    sai_object_type_t objectType,
+    sai_status_t rv,
+    sai_object_id_t objectId) {
+  BinaryTraceRecordHeader header{};
+  header.op = op;
+  header.objectType = objectType;
+  header.rv = rv;
+  header.objectId = objectId;
+  header.timeUs = std::chrono::duration_cast<std::chrono::microseconds>(
+                      std::chrono::system_clock::now().time_since_epoch())
+                      .count();
+  // Most records are a few attributes long
+  buffer_.reserve(256);
+  append(header);
+}
+
+void BinaryTraceRecord::appendBytes(const void* data, size_t size) {
+  buffer_.append(static_cast<const char*>(data), size);
+}
+
+void BinaryTraceRecord::appendString(folly::StringPiece str) {
+  appendArray(str.data(), str.size());
+}
+
+void BinaryTraceRecord::appendAttribute(
+    const sai_attribute_t& attr,
+    BinaryTraceListType listType,
+    size_t maxListEntries) {
+  append(attr.id);
+  append(listType);
+  append(attr.value);
+
+  // Lists can be NULL, e.g. when querying their size
+  auto appendList = [this, maxListEntries](const auto* list, uint32_t count) {
+    append<bool>(list != nullptr);
+    if (list) {
+      appendArray(list, loggedListCount(list, count, maxListEntries));
+    }
+  };
+  switch (listType) {
+    case BinaryTraceListType::NONE:
+      break;
+    case BinaryTraceListType::OBJECT_ID:
+      appendList(attr.value.objlist.list, attr.value.objlist.count);
+      break;
+    case BinaryTraceListType::U32:
+      appendList(attr.value.u32list.list, attr.value.u32list.count);
+      break;
+    case BinaryTraceListType::S32:
+      appendList(attr.value.s32list.list, attr.value.s32list.count);
+      break;
+    case BinaryTraceListType::S8:
+      appendList(attr.value.s8list.list, attr.value.s8list.count);
+      break;
+    case BinaryTraceListType::QOS_MAP:
+      appendList(attr.value.qosmap.list, attr.value.qosmap.count);
+      break;
+    case BinaryTraceListType::ACL_ACTION_OBJECT_ID:
+      appendList(
+          attr.value.aclaction.parameter.objlist.list,
+          attr.value.aclaction.parameter.objlist.count);
+      break;
+    case BinaryTraceListType::SYSTEM_PORT_CONFIG:
+      appendList(
+          attr.value.sysportconfiglist.list,
+          attr.value.sysportconfiglist.count);
+      break;
+  }
+}
+
+folly::StringPiece BinaryTraceRecord::finish() {
+  uint32_t size = buffer_.size();
+  std::memcpy(buffer_.data(), &size, sizeof(size));
+  return buffer_;
+}
+
+BinaryTraceRecordReader::BinaryTraceRecordReader(folly::ByteRange record)
+    : remaining_(record) {
+  header_ = read<BinaryTraceRecordHeader>();
+}
+
+void BinaryTraceRecordReader::readBytes(void* data, size_t size) {
+  if (remaining_.size() < size) {
+    throw FbossError(
+        "Truncated record of op ",
+        static_cast<int>(header_.op),
+        ", expected ",
+        size,
+        " more bytes but only ",
+        remaining_.size(),
+        " are left");
+  }
+  std::memcpy(data, remaining_.data(), size);
+  remaining_.advance(size);
+}
+
+std::string BinaryTraceRecordReader::readString() {
+  auto chars = readArray<char>();
+  return std::string(chars.begin(), chars.end());
+}
+
+std::vector<sai_attribute_t> BinaryTraceRecordReader::readAttributes() {
+  std::vector<sai_attribute_t> attrs(read<uint32_t>());
+  for (auto& attr : attrs) {
+    attr.id = read<sai_attr_id_t>();
+    auto listType = read<BinaryTraceListType>();
+    attr.value = read<sai_attribute_value_t>();
+    readList(attr, listType);
+  }
+  return attrs;
+}
+
+void BinaryTraceRecordReader::readList(
+    sai_attribute_t& attr,
+    BinaryTraceListType listType) {
+  if (listType == BinaryTraceListType::NONE) {
+    return;
+  }
+  // The logged list pointer is meaningless here, point to a copy of the
+  // logged entries instead.
+  auto readListEntries = [this](auto*& list) {
+    using T = std::remove_pointer_t<std::remove_reference_t<decltype(list)>>;
+    list = nullptr;
+    if (!read<bool>()) {
+      return;
+    }
+    auto count = read<uint32_t>();
+    // Never empty, so that an empty but non NULL list stays non NULL
+    auto& storage = lists_.emplace_back(
+        1 + count * sizeof(T) / sizeof(uint64_t));
+    readBytes(storage.data(), count * sizeof(T));
+    list = reinterpret_cast<T*>(storage.data());
+  };
+  switch (listType) {
+    case BinaryTraceListType::NONE:
+      break;
+    case BinaryTraceListType::OBJECT_ID:
+      readListEntries(attr.value.objlist.list);
+      break;
+    case BinaryTraceListType::U32:
+      readListEntries(attr.value.u32list.list);
+      break;
+    case BinaryTraceListType::S32:
+      readListEntries(attr.value.s32list.list);
+      break;
+    case BinaryTraceListType::S8:
+      readListEntries(attr.value.s8list.list);
+      break;
+    case BinaryTraceListType::QOS_MAP:
+      readListEntries(attr.value.qosmap.list);
+      break;
+    case BinaryTraceListType::ACL_ACTION_OBJECT_ID:
+      readListEntries(attr.value.aclaction.parameter.objlist.list);
+      break;
+    case BinaryTraceListType::SYSTEM_PORT_CONFIG:
+      readListEntries(attr.value.sysportconfiglist.list);
+      break;
+  }
+}
+
+BinaryTraceParser::BinaryTraceParser(folly::ByteRange log)
+    : remaining_(log) {
+  if (remaining_.empty()) {
+    throw FbossError("Binary SAI replayer log has no content");
+  }
+  parseFileHeader();
+}
+
+bool BinaryTraceParser::atBootStart() const {
+  return remaining_.size() >= sizeof(fileHeader_.magic) &&
+      !std::memcmp(
+          remaining_.data(),
+          BinaryTraceFileHeader::kMagic,
+          sizeof(fileHeader_.magic));
+}
+
+void BinaryTraceParser::parseFileHeader() {
+  if (remaining_.size() < sizeof(fileHeader_)) {
+    throw FbossError("Binary SAI replayer log is missing its header");
+  }
+  if (!atBootStart()) {
+    throw FbossError("Not a binary SAI replayer log");
+  }
+  std::memcpy(&fileHeader_, remaining_.data(), sizeof(fileHeader_));
+  remaining_.advance(sizeof(fileHeader_));
+  if (fileHeader_.version != BinaryTraceFileHeader::kVersion) {
+    throw FbossError(
+        "Unsupported binary SAI replayer log version ", fileHeader_.version);
+  }
+  if (fileHeader_.attrValueSize != sizeof(sai_attribute_value_t)) {
+    throw FbossError(
+        "Binary SAI replayer log was written with attribute values of ",
+        fileHeader_.attrValueSize,
+        " bytes, expected ",
+        sizeof(sai_attribute_value_t),
+        ". Was it written against a different SAI version?");
+  }
+  if (fileHeader_.bootHeaderSize > remaining_.size()) {
+    throw FbossError("Truncated boot header in binary SAI replayer log");
+  }
+  bootHeader_ =
+      folly::StringPiece(remaining_.subpiece(0, fileHeader_.bootHeaderSize));
+  remaining_.advance(fileHeader_.bootHeaderSize);
+}
+
+folly::ByteRange BinaryTraceParser::nextRecord() {
+  if (remaining_.empty() || atBootStart()) {
+    return {};
+  }
+  uint32_t size = 0;
+  if (remaining_.size() >= sizeof(size)) {
+    std::memcpy(&size, remaining_.data(), sizeof(size));
+  }
+  if (size < sizeof(BinaryTraceRecordHeader) || size > remaining_.size()) {
+    throw FbossError(
+        "Malformed record of ",
+        size,
+        " bytes with ",
+        remaining_.size(),
+        " bytes left in the binary SAI replayer log");
+  }
+  auto record = remaining_.subpiece(0, size);
+  remaining_.advance(size);
+  return record;
+}
+
+bool BinaryTraceParser::nextBoot() {
+  while (!nextRecord().empty()) {
+  }
+  if (remaining_.empty()) {
+    return false;
+  }
+  parseFileHeader();
+  return true;
+}
+
+} // namespace facebook::fboss
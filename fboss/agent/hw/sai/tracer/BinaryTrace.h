@@ -0,0 +1,233 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#pragma once
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <folly/Range.h>
+
+extern "C" {
+#include <sai.h>
+}
+
+namespace facebook::fboss {
+
+/*
+ * Binary format of the SAI replayer log.
+ *
+ * Formatting every SAI call into C code on the calling thread is expensive,
+ * so with --enable_binary_replayer_log the tracer instead copies the
+ * arguments of each call into a record, with as little formatting as
+ * possible. sai_replayer_log_converter then feeds the records back to the
+ * tracer offline, which produces the same C program as text logging would
+ * have.
+ *
+ * Logs at the default location get appended to on every boot. Each boot
+ * starts with a BinaryTraceFileHeader, followed by AsyncLogger's boot header
+ * comment lines and then the records. Each record is a
+ * BinaryTraceRecordHeader followed by an op specific payload of raw values,
+ * length prefixed strings and arrays, and attribute lists. Values are
+ * written in host byte order, so the log needs to be converted on a host of
+ * the same endianness.
+ *
+ * Records can't be mistaken for the start of the next boot: the op of a
+ * record is where the magic has an 'L', which is not an op.
+ */
+
+enum class BinaryTraceOp : uint8_t {
+  API_INITIALIZE,
+  API_UNINITIALIZE,
+  API_QUERY,
+  GET_OBJECT_KEY,
+  SWITCH_CREATE,
+  CREATE,
+  POST_INVOCATION,
+  REMOVE,
+  SET_ATTR,
+  GET_ATTR,
+  BULK_SET_ATTR,
+  // Route, neighbor, fdb and inseg entries, told apart by object type
+  ENTRY_CREATE,
+  ENTRY_REMOVE,
+  ENTRY_SET_ATTR,
+  SEND_HOSTIF_PACKET,
+  GET_STATS,
+  // Keep last, see BinaryTrace.cpp
+  CLEAR_STATS,
+};
+
+// Attribute values holding a pointer to a list, which is logged after the
+// raw attribute value.
+enum class BinaryTraceListType : uint8_t {
+  NONE,
+  OBJECT_ID,
+  U32,
+  S32,
+  S8,
+  QOS_MAP,
+  ACL_ACTION_OBJECT_ID,
+  SYSTEM_PORT_CONFIG,
+};
+
+struct BinaryTraceFileHeader {
+  static constexpr char kMagic[8] = "SAIBLOG";
+  static constexpr uint32_t kVersion = 2;
+
+  char magic[8];
+  uint32_t version;
+  // Sanity check that the log is converted against the same SAI headers
+  uint32_t attrValueSize;
+  // Replayer flags affecting the generated program
+  int32_t defaultListSize;
+  int32_t defaultListCount;
+  bool enableGetAttrLog;
+  bool enablePacketLog;
+  // Size of the boot header comment lines following this header
+  uint32_t bootHeaderSize;
+};
+
+struct BinaryTraceRecordHeader {
+  // Size of the record, header included
+  uint32_t size;
+  BinaryTraceOp op;
+  sai_object_type_t objectType;
+  sai_status_t rv;
+  sai_object_id_t objectId;
+  // Time of the call, in microseconds since epoch
+  int64_t timeUs;
+};
+
+class BinaryTraceRecord {
+ public:
+  BinaryTraceRecord(
+      BinaryTraceOp op,
+      sai_object_type_t objectType,
+      sai_status_t rv = SAI_STATUS_SUCCESS,
+      sai_object_id_t objectId = SAI_NULL_OBJECT_ID);
+
+  template <typename T>
+  void append(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    appendBytes(&value, sizeof(T));
+  }
+
+  template <typename T>
+  void appendArray(const T* values, uint32_t count) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    append(count);
+    if (count) {
+      appendBytes(values, count * sizeof(T));
+    }
+  }
+
+  void appendString(folly::StringPiece str);
+
+  /*
+   * Attribute id and raw value, followed by the list the value points
+   * to, if any. Only the first maxListEntries of the list are logged,
+   * which covers everything the generated code can hold.
+   */
+  void appendAttribute(
+      const sai_attribute_t& attr,
+      BinaryTraceListType listType,
+      size_t maxListEntries);
+
+  // Fill in the record size, returning the complete record
+  folly::StringPiece finish();
+
+ private:
+  void appendBytes(const void* data, size_t size);
+
+  std::string buffer_;
+};
+
+class BinaryTraceRecordReader {
+ public:
+  explicit BinaryTraceRecordReader(folly::ByteRange record);
+
+  const BinaryTraceRecordHeader& header() const {
+    return header_;
+  }
+
+  template <typename T>
+  T read() {
+    static_assert(std::is_trivially_copyable_v<T>);
+    T value;
+    readBytes(&value, sizeof(T));
+    return value;
+  }
+
+  template <typename T>
+  std::vector<T> readArray() {
+    std::vector<T> values(read<uint32_t>());
+    if (!values.empty()) {
+      readBytes(values.data(), values.size() * sizeof(T));
+    }
+    return values;
+  }
+
+  std::string readString();
+
+  /*
+   * Attribute list written by SaiTracer::packAttrList. List values point
+   * into storage owned by the reader, so they are only valid for the
+   * lifetime of the reader.
+   */
+  std::vector<sai_attribute_t> readAttributes();
+
+ private:
+  void readBytes(void* data, size_t size);
+  void readList(sai_attribute_t& attr, BinaryTraceListType listType);
+
+  BinaryTraceRecordHeader header_{};
+  folly::ByteRange remaining_;
+  std::vector<std::vector<uint64_t>> lists_;
+};
+
+/*
+ * Splits a binary log into boots, and each boot into its headers and
+ * records. Throws FbossError on truncated or malformed logs.
+ */
+class BinaryTraceParser {
+ public:
+  // Starts out at the first boot of the log
+  explicit BinaryTraceParser(folly::ByteRange log);
+
+  // Comment lines written by AsyncLogger on startup of the current boot
+  folly::StringPiece bootHeader() const {
+    return bootHeader_;
+  }
+
+  const BinaryTraceFileHeader& fileHeader() const {
+    return fileHeader_;
+  }
+
+  // Next record of the current boot, or an empty range once exhausted
+  folly::ByteRange nextRecord();
+
+  /*
+   * Skip the rest of the current boot and move on to the next one. Returns
+   * false once the log is exhausted.
+   */
+  bool nextBoot();
+
+ private:
+  bool atBootStart() const;
+  void parseFileHeader();
+
+  folly::StringPiece bootHeader_;
+  BinaryTraceFileHeader fileHeader_;
+  folly::ByteRange remaining_;
+};
+
+} // namespace facebook::fboss
@@ -16,6 +16,7 @@
 #include "fboss/agent/SysError.h"
 #include "fboss/agent/hw/sai/api/LoggingUtil.h"
 #include "fboss/agent/hw/sai/tracer/AclApiTracer.h"
+#include "fboss/agent/hw/sai/tracer/BinaryTrace.h"
 #include "fboss/agent/hw/sai/tracer/BridgeApiTracer.h"
 #include "fboss/agent/hw/sai/tracer/BufferApiTracer.h"
 #include "fboss/agent/hw/sai/tracer/CounterApiTracer.h"
@@ -61,6 +62,13 @@ DEFINE_bool(
     false,
     "Flag to indicate whether function wrapper and logger is enabled.");
 
+DEFINE_bool(
+    enable_binary_replayer_log,
+    false,
+    "Log SAI calls in a compact binary format rather than as C code, "
+    "which is much cheaper at runtime. Use sai_replayer_log_converter "
+    "to turn the log into the C program afterwards.");
+
 DEFINE_bool(
     enable_packet_log,
     false,
@@ -385,41 +393,8 @@ sai_status_t __wrap_sai_get_object_key(
     return rv;
   }
 
-  vector<string> getObjectKeyLines = {
-      to<string>("expected_object_count=", *object_count),
-      to<string>(
-          "sai_get_object_count(switch_0, (_sai_object_type_t)",
-          object_type,
-          ", &object_count)"),
-      "object_list.resize(object_count)",
-      to<string>(
-          "sai_get_object_key(switch_0, (_sai_object_type_t)",
-          object_type,
-          ", &object_count, object_list.data())"),
-      to<string>(
-          "if (object_count < expected_object_count) { printf(\"[WARNING] current switch reloaded %u ",
-          facebook::fboss::saiObjectTypeToString(object_type),
-          " objects, expected %u\\n\", expected_object_count, object_count); }"),
-  };
-
-  vector<string> declarationLines;
-  declarationLines.reserve(*object_count);
-  for (int i = 0; i < *object_count; ++i) {
-    sai_object_key_t object = object_list[i];
-    string declaration = std::get<0>(SaiTracer::getInstance()->declareVariable(
-        &object.key.object_id, object_type));
-    declarationLines.push_back(to<string>(
-        declaration,
-        "=assignObject(object_list.data(), object_count, ",
-        i,
-        ", ",
-        object.key.object_id,
-        ")"));
-  }
-  vector<string> lines;
-  lines.insert(lines.end(), getObjectKeyLines.begin(), getObjectKeyLines.end());
-  lines.insert(lines.end(), declarationLines.begin(), declarationLines.end());
-  SaiTracer::getInstance()->writeToFile(lines);
+  SaiTracer::getInstance()->logGetObjectKeyFn(
+      object_type, *object_count, object_list);
   return rv;
 }
 
@@ -438,17 +413,26 @@ SaiTracer::SaiTracer() {
     asyncLogger_ = std::make_unique<AsyncLogger>(
         FLAGS_sai_log, FLAGS_log_timeout, AsyncLogger::SAI_REPLAYER);
 
-    asyncLogger_->startFlushThread();
-    asyncLogger_->appendLog(cpp_header_, strlen(cpp_header_));
+    // Binary logs carry the boot header in their own header, so that boots
+    // appended to the same log can be told apart from records
+    asyncLogger_->startFlushThread(!FLAGS_enable_binary_replayer_log);
+    if (FLAGS_enable_binary_replayer_log) {
+      // Header and globals are written when converting the log
+      writeBinaryHeader();
+    } else {
+      asyncLogger_->appendLog(cpp_header_, strlen(cpp_header_));
+      setupGlobals();
+    }
 
-    setupGlobals();
     initVarCounts();
   }
 }
 
 SaiTracer::~SaiTracer() {
   if (FLAGS_enable_replayer) {
-    writeFooter();
+    if (!FLAGS_enable_binary_replayer_log) {
+      writeFooter();
+    }
     asyncLogger_->forceFlush();
     asyncLogger_->stopFlushThread();
   }
@@ -474,10 +458,44 @@ void SaiTracer::writeToFile(const vector<string>& strVec, bool linefeed) {
   asyncLogger_->appendLog(lines.c_str(), lines.size());
 }
 
+void SaiTracer::writeBinaryHeader() {
+  BinaryTraceFileHeader header{};
+  std::memcpy(
+      header.magic, BinaryTraceFileHeader::kMagic, sizeof(header.magic));
+  header.version = BinaryTraceFileHeader::kVersion;
+  header.attrValueSize = sizeof(sai_attribute_value_t);
+  header.defaultListSize = FLAGS_default_list_size;
+  header.defaultListCount = FLAGS_default_list_count;
+  header.enableGetAttrLog = FLAGS_enable_get_attr_log;
+  header.enablePacketLog = FLAGS_enable_packet_log;
+  auto bootHeader = AsyncLogger::getBootHeader();
+  header.bootHeaderSize = bootHeader.size();
+  asyncLogger_->appendLog(
+      reinterpret_cast<const char*>(&header), sizeof(header));
+  asyncLogger_->appendLog(bootHeader.data(), bootHeader.size());
+}
+
+void SaiTracer::writeBinaryRecord(BinaryTraceRecord& record) {
+  auto data = record.finish();
+  asyncLogger_->appendLog(data.data(), data.size());
+}
+
 void SaiTracer::logApiInitialize(
     const char** variables,
     const char** values,
     int size) {
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(
+        BinaryTraceOp::API_INITIALIZE, SAI_OBJECT_TYPE_NULL);
+    record.append(size);
+    for (int i = 0; i < size; ++i) {
+      record.appendString(variables[i]);
+      record.appendString(values[i]);
+    }
+    writeBinaryRecord(record);
+    return;
+  }
+
   vector<string> lines;
 
   for (int i = 0; i < size; ++i) {
@@ -506,6 +524,13 @@ void SaiTracer::logApiInitialize(
 }
 
 void SaiTracer::logApiUninitialize(void) {
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(
+        BinaryTraceOp::API_UNINITIALIZE, SAI_OBJECT_TYPE_NULL);
+    writeBinaryRecord(record);
+    return;
+  }
+
   vector<string> lines{"sai_api_uninitialize()"};
   writeToFile(lines);
 }
@@ -518,6 +543,14 @@ void SaiTracer::logApiQuery(sai_api_t api_id, const std::string& api_var) {
 
   init_api_.emplace(api_id, api_var);
 
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(BinaryTraceOp::API_QUERY, SAI_OBJECT_TYPE_NULL);
+    record.append(api_id);
+    record.appendString(api_var);
+    writeBinaryRecord(record);
+    return;
+  }
+
   writeToFile(
       {to<string>("sai_", api_var, "_t* ", api_var),
        to<string>(
@@ -534,6 +567,58 @@ void SaiTracer::logApiQuery(sai_api_t api_id, const std::string& api_var) {
            " API.\")")});
 }
 
+void SaiTracer::logGetObjectKeyFn(
+    sai_object_type_t object_type,
+    uint32_t object_count,
+    const sai_object_key_t* object_list) {
+  if (!FLAGS_enable_replayer) {
+    return;
+  }
+
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(BinaryTraceOp::GET_OBJECT_KEY, object_type);
+    record.appendArray(object_list, object_count);
+    writeBinaryRecord(record);
+    return;
+  }
+
+  vector<string> getObjectKeyLines = {
+      to<string>("expected_object_count=", object_count),
+      to<string>(
+          "sai_get_object_count(switch_0, (_sai_object_type_t)",
+          object_type,
+          ", &object_count)"),
+      "object_list.resize(object_count)",
+      to<string>(
+          "sai_get_object_key(switch_0, (_sai_object_type_t)",
+          object_type,
+          ", &object_count, object_list.data())"),
+      to<string>(
+          "if (object_count < expected_object_count) { printf(\"[WARNING] current switch reloaded %u ",
+          facebook::fboss::saiObjectTypeToString(object_type),
+          " objects, expected %u\\n\", expected_object_count, object_count); }"),
+  };
+
+  vector<string> declarationLines;
+  declarationLines.reserve(object_count);
+  for (int i = 0; i < object_count; ++i) {
+    sai_object_key_t object = object_list[i];
+    string declaration =
+        std::get<0>(declareVariable(&object.key.object_id, object_type));
+    declarationLines.push_back(to<string>(
+        declaration,
+        "=assignObject(object_list.data(), object_count, ",
+        i,
+        ", ",
+        object.key.object_id,
+        ")"));
+  }
+  vector<string> lines;
+  lines.insert(lines.end(), getObjectKeyLines.begin(), getObjectKeyLines.end());
+  lines.insert(lines.end(), declarationLines.begin(), declarationLines.end());
+  writeToFile(lines);
+}
+
 void SaiTracer::logSwitchCreateFn(
     sai_object_id_t* switch_id,
     uint32_t attr_count,
@@ -543,6 +628,14 @@ void SaiTracer::logSwitchCreateFn(
     return;
   }
 
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(
+        BinaryTraceOp::SWITCH_CREATE, SAI_OBJECT_TYPE_SWITCH, rv, *switch_id);
+    packAttrList(record, attr_list, attr_count, SAI_OBJECT_TYPE_SWITCH);
+    writeBinaryRecord(record);
+    return;
+  }
+
   // First fill in attribute list
   vector<string> lines =
       setAttrList(attr_list, attr_count, SAI_OBJECT_TYPE_SWITCH);
@@ -585,6 +678,15 @@ void SaiTracer::logRouteEntryCreateFn(
     return;
   }
 
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(
+        BinaryTraceOp::ENTRY_CREATE, SAI_OBJECT_TYPE_ROUTE_ENTRY, rv);
+    record.append(*route_entry);
+    packAttrList(record, attr_list, attr_count, SAI_OBJECT_TYPE_ROUTE_ENTRY);
+    writeBinaryRecord(record);
+    return;
+  }
+
   // First fill in attribute list
   vector<string> lines =
       setAttrList(attr_list, attr_count, SAI_OBJECT_TYPE_ROUTE_ENTRY);
@@ -621,6 +723,15 @@ void SaiTracer::logNeighborEntryCreateFn(
     return;
   }
 
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(
+        BinaryTraceOp::ENTRY_CREATE, SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, rv);
+    record.append(*neighbor_entry);
+    packAttrList(record, attr_list, attr_count, SAI_OBJECT_TYPE_NEIGHBOR_ENTRY);
+    writeBinaryRecord(record);
+    return;
+  }
+
   // First fill in attribute list
   vector<string> lines =
       setAttrList(attr_list, attr_count, SAI_OBJECT_TYPE_NEIGHBOR_ENTRY);
@@ -657,6 +768,15 @@ void SaiTracer::logFdbEntryCreateFn(
     return;
   }
 
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(
+        BinaryTraceOp::ENTRY_CREATE, SAI_OBJECT_TYPE_FDB_ENTRY, rv);
+    record.append(*fdb_entry);
+    packAttrList(record, attr_list, attr_count, SAI_OBJECT_TYPE_FDB_ENTRY);
+    writeBinaryRecord(record);
+    return;
+  }
+
   // First fill in attribute list
   vector<string> lines =
       setAttrList(attr_list, attr_count, SAI_OBJECT_TYPE_FDB_ENTRY);
@@ -693,6 +813,15 @@ void SaiTracer::logInsegEntryCreateFn(
     return;
   }
 
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(
+        BinaryTraceOp::ENTRY_CREATE, SAI_OBJECT_TYPE_INSEG_ENTRY, rv);
+    record.append(*inseg_entry);
+    packAttrList(record, attr_list, attr_count, SAI_OBJECT_TYPE_INSEG_ENTRY);
+    writeBinaryRecord(record);
+    return;
+  }
+
   // First fill in attribute list
   vector<string> lines =
       setAttrList(attr_list, attr_count, SAI_OBJECT_TYPE_INSEG_ENTRY);
@@ -731,6 +860,20 @@ void SaiTracer::logCreateFn(
     return;
   }
 
+  if (FLAGS_enable_binary_replayer_log) {
+    // Logged before the call, the object id is the one passed in
+    BinaryTraceRecord record(
+        BinaryTraceOp::CREATE,
+        object_type,
+        SAI_STATUS_SUCCESS,
+        *create_object_id);
+    record.appendString(fn_name);
+    record.append(switch_id);
+    packAttrList(record, attr_list, attr_count, object_type);
+    writeBinaryRecord(record);
+    return;
+  }
+
   // First fill in attribute list
   vector<string> lines = setAttrList(attr_list, attr_count, object_type);
 
@@ -754,6 +897,14 @@ void SaiTracer::logRouteEntryRemoveFn(
     return;
   }
 
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(
+        BinaryTraceOp::ENTRY_REMOVE, SAI_OBJECT_TYPE_ROUTE_ENTRY, rv);
+    record.append(*route_entry);
+    writeBinaryRecord(record);
+    return;
+  }
+
   vector<string> lines{};
   setRouteEntry(route_entry, lines);
 
@@ -781,6 +932,14 @@ void SaiTracer::logNeighborEntryRemoveFn(
     return;
   }
 
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(
+        BinaryTraceOp::ENTRY_REMOVE, SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, rv);
+    record.append(*neighbor_entry);
+    writeBinaryRecord(record);
+    return;
+  }
+
   vector<string> lines{};
   setNeighborEntry(neighbor_entry, lines);
 
@@ -808,6 +967,14 @@ void SaiTracer::logFdbEntryRemoveFn(
     return;
   }
 
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(
+        BinaryTraceOp::ENTRY_REMOVE, SAI_OBJECT_TYPE_FDB_ENTRY, rv);
+    record.append(*fdb_entry);
+    writeBinaryRecord(record);
+    return;
+  }
+
   vector<string> lines{};
   setFdbEntry(fdb_entry, lines);
 
@@ -835,6 +1002,14 @@ void SaiTracer::logInsegEntryRemoveFn(
     return;
   }
 
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(
+        BinaryTraceOp::ENTRY_REMOVE, SAI_OBJECT_TYPE_INSEG_ENTRY, rv);
+    record.append(*inseg_entry);
+    writeBinaryRecord(record);
+    return;
+  }
+
   vector<string> lines{};
   setInsegEntry(inseg_entry, lines);
 
@@ -864,6 +1039,14 @@ void SaiTracer::logRemoveFn(
     return;
   }
 
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(
+        BinaryTraceOp::REMOVE, object_type, rv, remove_object_id);
+    record.appendString(fn_name);
+    writeBinaryRecord(record);
+    return;
+  }
+
   vector<string> lines{};
 
   // Log current timestamp, object id and return value
@@ -896,6 +1079,15 @@ void SaiTracer::logRouteEntrySetAttrFn(
     return;
   }
 
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(
+        BinaryTraceOp::ENTRY_SET_ATTR, SAI_OBJECT_TYPE_ROUTE_ENTRY, rv);
+    record.append(*route_entry);
+    packAttrList(record, attr, 1, SAI_OBJECT_TYPE_ROUTE_ENTRY);
+    writeBinaryRecord(record);
+    return;
+  }
+
   // Setup one attribute
   vector<string> lines = setAttrList(attr, 1, SAI_OBJECT_TYPE_ROUTE_ENTRY);
 
@@ -927,6 +1119,15 @@ void SaiTracer::logNeighborEntrySetAttrFn(
     return;
   }
 
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(
+        BinaryTraceOp::ENTRY_SET_ATTR, SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, rv);
+    record.append(*neighbor_entry);
+    packAttrList(record, attr, 1, SAI_OBJECT_TYPE_NEIGHBOR_ENTRY);
+    writeBinaryRecord(record);
+    return;
+  }
+
   // Setup one attribute
   vector<string> lines = setAttrList(attr, 1, SAI_OBJECT_TYPE_NEIGHBOR_ENTRY);
 
@@ -958,6 +1159,15 @@ void SaiTracer::logFdbEntrySetAttrFn(
     return;
   }
 
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(
+        BinaryTraceOp::ENTRY_SET_ATTR, SAI_OBJECT_TYPE_FDB_ENTRY, rv);
+    record.append(*fdb_entry);
+    packAttrList(record, attr, 1, SAI_OBJECT_TYPE_FDB_ENTRY);
+    writeBinaryRecord(record);
+    return;
+  }
+
   // Setup one attribute
   vector<string> lines = setAttrList(attr, 1, SAI_OBJECT_TYPE_FDB_ENTRY);
 
@@ -989,6 +1199,15 @@ void SaiTracer::logInsegEntrySetAttrFn(
     return;
   }
 
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(
+        BinaryTraceOp::ENTRY_SET_ATTR, SAI_OBJECT_TYPE_INSEG_ENTRY, rv);
+    record.append(*inseg_entry);
+    packAttrList(record, attr, 1, SAI_OBJECT_TYPE_INSEG_ENTRY);
+    writeBinaryRecord(record);
+    return;
+  }
+
   // Setup one attribute
   vector<string> lines = setAttrList(attr, 1, SAI_OBJECT_TYPE_INSEG_ENTRY);
 
@@ -1023,6 +1242,15 @@ void SaiTracer::logGetAttrFn(
     return;
   }
 
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(
+        BinaryTraceOp::GET_ATTR, object_type, rv, get_object_id);
+    record.appendString(fn_name);
+    packAttrList(record, attr, attr_count, object_type);
+    writeBinaryRecord(record);
+    return;
+  }
+
   vector<string> lines = setAttrList(attr, attr_count, object_type);
   lines.push_back(
       to<string>("memset(get_attribute,0,ATTR_SIZE*", maxAttrCount_, ")"));
@@ -1058,6 +1286,15 @@ void SaiTracer::logSetAttrFn(
     return;
   }
 
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(
+        BinaryTraceOp::SET_ATTR, object_type, rv, set_object_id);
+    record.appendString(fn_name);
+    packAttrList(record, attr, 1, object_type);
+    writeBinaryRecord(record);
+    return;
+  }
+
   // Setup one attribute
   vector<string> lines = setAttrList(attr, 1, object_type);
 
@@ -1093,6 +1330,17 @@ void SaiTracer::logBulkSetAttrFn(
     return;
   }
 
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(BinaryTraceOp::BULK_SET_ATTR, object_type, rv);
+    record.appendString(fn_name);
+    record.append(mode);
+    record.appendArray(object_id, object_count);
+    record.appendArray(object_statuses, object_count);
+    packAttrList(record, attr_list, object_count, object_type);
+    writeBinaryRecord(record);
+    return;
+  }
+
   // Setup attributes
   vector<string> lines = setAttrList(attr_list, object_count, object_type);
 
@@ -1141,6 +1389,18 @@ void SaiTracer::logSendHostifPacketFn(
     return;
   }
 
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(
+        BinaryTraceOp::SEND_HOSTIF_PACKET,
+        SAI_OBJECT_TYPE_HOSTIF_PACKET,
+        rv,
+        hostif_id);
+    record.appendArray(buffer, buffer_size);
+    packAttrList(record, attr_list, attr_count, SAI_OBJECT_TYPE_HOSTIF_PACKET);
+    writeBinaryRecord(record);
+    return;
+  }
+
   vector<string> lines =
       setAttrList(attr_list, attr_count, SAI_OBJECT_TYPE_HOSTIF_PACKET);
 
@@ -1196,6 +1456,18 @@ void SaiTracer::logGetStatsFn(
   if (!FLAGS_enable_replayer || !FLAGS_enable_get_attr_log) {
     return;
   }
+
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(
+        BinaryTraceOp::GET_STATS, object_type, rv, object_id);
+    record.appendString(fn_name);
+    record.append(mode);
+    record.appendArray(counter_ids, number_of_counters);
+    record.appendArray(counters, number_of_counters);
+    writeBinaryRecord(record);
+    return;
+  }
+
   vector<string> lines = {
       to<string>("memset(counter_list,0,4*", maxAttrCount_, ")"),
       to<string>("memset(counter_vals,0,8*", maxAttrCount_, ")")};
@@ -1238,6 +1510,15 @@ void SaiTracer::logClearStatsFn(
     return;
   }
 
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(
+        BinaryTraceOp::CLEAR_STATS, object_type, rv, object_id);
+    record.appendString(fn_name);
+    record.appendArray(counter_ids, number_of_counters);
+    writeBinaryRecord(record);
+    return;
+  }
+
   vector<string> lines = {
       to<string>("memset(counter_list,0,4*", maxAttrCount_, ")")};
   for (int i = 0; i < number_of_counters; ++i) {
@@ -1487,6 +1768,199 @@ vector<string> SaiTracer::setAttrList(
   return attrLines;
 }
 
+void SaiTracer::packAttrList(
+    BinaryTraceRecord& record,
+    const sai_attribute_t* attr_list,
+    uint32_t attr_count,
+    sai_object_type_t object_type) {
+  record.append(attr_count);
+
+  // Call functions defined in *ApiTracer.h to find out which attributes
+  // hold lists that need to be logged along with the attribute values
+  switch (object_type) {
+    case SAI_OBJECT_TYPE_ACL_COUNTER:
+      packAclCounterAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_ACL_ENTRY:
+      packAclEntryAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_ACL_TABLE:
+      packAclTableAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_ACL_TABLE_GROUP:
+      packAclTableGroupAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_ACL_TABLE_GROUP_MEMBER:
+      packAclTableGroupMemberAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_BRIDGE:
+      packBridgeAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_BRIDGE_PORT:
+      packBridgePortAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_BUFFER_POOL:
+      packBufferPoolAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_BUFFER_PROFILE:
+      packBufferProfileAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_COUNTER:
+      packCounterAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_DEBUG_COUNTER:
+      packDebugCounterAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_FDB_ENTRY:
+      packFdbEntryAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_HASH:
+      packHashAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_HOSTIF_PACKET:
+      packHostifPacketAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_HOSTIF_TRAP:
+      packHostifTrapAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_HOSTIF_TRAP_GROUP:
+      packHostifTrapGroupAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_INSEG_ENTRY:
+      packInsegEntryAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_INGRESS_PRIORITY_GROUP:
+      packIngressPriorityGroupAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_LAG:
+      packLagAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_LAG_MEMBER:
+      packLagMemberAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_MACSEC:
+      packMacsecAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_MACSEC_PORT:
+      packMacsecPortAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_MACSEC_FLOW:
+      packMacsecFlowAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_MACSEC_SA:
+      packMacsecSAAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_MACSEC_SC:
+      packMacsecSCAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_MIRROR_SESSION:
+      packMirrorSessionAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+      packNeighborEntryAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_NEXT_HOP:
+      packNextHopAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_NEXT_HOP_GROUP:
+      packNextHopGroupAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER:
+      packNextHopGroupMemberAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_PORT:
+      packPortAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_PORT_SERDES:
+      packPortSerdesAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_PORT_CONNECTOR:
+      packPortConnectorAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_QOS_MAP:
+      packQosMapAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_QUEUE:
+      packQueueAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+      packRouteEntryAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_ROUTER_INTERFACE:
+      packRouterInterfaceAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_SAMPLEPACKET:
+      packSamplePacketAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_SCHEDULER:
+      packSchedulerAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_SWITCH:
+      packSwitchAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_SYSTEM_PORT:
+      packSystemPortAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_TAM:
+      packTamAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_TAM_EVENT:
+      packTamEventAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_TAM_EVENT_ACTION:
+      packTamEventActionAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_TAM_REPORT:
+      packTamReportAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_TUNNEL:
+      packTunnelAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_TUNNEL_TERM_TABLE_ENTRY:
+      packTunnelTermAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_VIRTUAL_ROUTER:
+      packVirtualRouterAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_VLAN:
+      packVlanAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_VLAN_MEMBER:
+      packVlanMemberAttributes(attr_list, attr_count, record);
+      break;
+    case SAI_OBJECT_TYPE_WRED:
+      packWredAttributes(attr_list, attr_count, record);
+      break;
+    default:
+      // Same as setAttrList, there is nothing to tell about the value of
+      // attributes of other object types, keep their raw value.
+      for (int i = 0; i < attr_count; ++i) {
+        packAttribute(attr_list[i], 0, record);
+      }
+      break;
+  }
+}
+
+void SaiTracer::packAttribute(
+    const sai_attribute_t& attr,
+    std::size_t typeIndex,
+    BinaryTraceRecord& record) {
+  auto listType = BinaryTraceListType::NONE;
+  if (auto iter = listTypeMap_.find(typeIndex); iter != listTypeMap_.end()) {
+    listType = iter->second;
+  } else if (
+      primitiveFuncMap_.find(typeIndex) == primitiveFuncMap_.end() &&
+      attributeFuncMap_.find(typeIndex) == attributeFuncMap_.end() &&
+      (attr.id == SAI_SWITCH_ATTR_SWITCH_HARDWARE_INFO ||
+       attr.id == SAI_SWITCH_ATTR_FIRMWARE_PATH_NAME)) {
+    // Same fallback as SET_SAI_STRING_ATTRIBUTES
+    listType = BinaryTraceListType::S8;
+  }
+  // Enough entries for the largest list checkListCount would let through
+  record.appendAttribute(
+      attr, listType, FLAGS_default_list_size * sizeof(int));
+}
+
 string SaiTracer::createFnCall(
     const string& fn_name,
     const string& var1,
@@ -1611,7 +2085,8 @@ string SaiTracer::rvCheck(sai_status_t rv) {
 }
 
 string SaiTracer::logTimeAndRv(sai_status_t rv, sai_object_id_t object_id) {
-  auto now = std::chrono::system_clock::now();
+  // When converting a binary log, log the time of the original call
+  auto now = convertedCallTime_.value_or(std::chrono::system_clock::now());
   auto now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
                     now.time_since_epoch()) %
       1000;
@@ -1676,6 +2151,17 @@ uint32_t SaiTracer::checkListCount(
 }
 
 void SaiTracer::logPostInvocation(sai_status_t rv, sai_object_id_t object_id) {
+  if (!FLAGS_enable_replayer) {
+    return;
+  }
+
+  if (FLAGS_enable_binary_replayer_log) {
+    BinaryTraceRecord record(
+        BinaryTraceOp::POST_INVOCATION, SAI_OBJECT_TYPE_NULL, rv, object_id);
+    writeBinaryRecord(record);
+    return;
+  }
+
   vector<string> lines;
   // Log current timestamp, object id and return value
   lines.push_back(logTimeAndRv(rv, object_id));
@@ -1686,6 +2172,249 @@ void SaiTracer::logPostInvocation(sai_status_t rv, sai_object_id_t object_id) {
   writeToFile(lines);
 }
 
+template <typename ConvertFn>
+void SaiTracer::convertEntryRecord(
+    BinaryTraceRecordReader& record,
+    ConvertFn convert) {
+  switch (record.header().objectType) {
+    case SAI_OBJECT_TYPE_ROUTE_ENTRY: {
+      auto entry = record.read<sai_route_entry_t>();
+      convert(&entry);
+      break;
+    }
+    case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY: {
+      auto entry = record.read<sai_neighbor_entry_t>();
+      convert(&entry);
+      break;
+    }
+    case SAI_OBJECT_TYPE_FDB_ENTRY: {
+      auto entry = record.read<sai_fdb_entry_t>();
+      convert(&entry);
+      break;
+    }
+    case SAI_OBJECT_TYPE_INSEG_ENTRY: {
+      auto entry = record.read<sai_inseg_entry_t>();
+      convert(&entry);
+      break;
+    }
+    default:
+      throw FbossError(
+          "Unexpected object type ",
+          record.header().objectType,
+          " for entry in binary SAI replayer log");
+  }
+}
+
+void SaiTracer::convertBinaryLog(BinaryTraceParser& parser) {
+  for (auto record = parser.nextRecord(); !record.empty();
+       record = parser.nextRecord()) {
+    convertBinaryRecord(record);
+  }
+  convertedCallTime_.reset();
+}
+
+void SaiTracer::convertBinaryRecord(folly::ByteRange data) {
+  BinaryTraceRecordReader record(data);
+  const auto& header = record.header();
+  convertedCallTime_ = std::chrono::system_clock::time_point(
+      std::chrono::microseconds(header.timeUs));
+  auto objectId = header.objectId;
+
+  switch (header.op) {
+    case BinaryTraceOp::API_INITIALIZE: {
+      auto size = record.read<int>();
+      vector<string> strings;
+      for (int i = 0; i < 2 * size; ++i) {
+        strings.push_back(record.readString());
+      }
+      vector<const char*> variables;
+      vector<const char*> values;
+      for (int i = 0; i < size; ++i) {
+        variables.push_back(strings[2 * i].c_str());
+        values.push_back(strings[2 * i + 1].c_str());
+      }
+      logApiInitialize(variables.data(), values.data(), size);
+      break;
+    }
+    case BinaryTraceOp::API_UNINITIALIZE:
+      logApiUninitialize();
+      break;
+    case BinaryTraceOp::API_QUERY: {
+      auto apiId = record.read<sai_api_t>();
+      logApiQuery(apiId, record.readString());
+      break;
+    }
+    case BinaryTraceOp::GET_OBJECT_KEY: {
+      auto objects = record.readArray<sai_object_key_t>();
+      logGetObjectKeyFn(header.objectType, objects.size(), objects.data());
+      break;
+    }
+    case BinaryTraceOp::SWITCH_CREATE: {
+      auto attrs = record.readAttributes();
+      logSwitchCreateFn(&objectId, attrs.size(), attrs.data(), header.rv);
+      break;
+    }
+    case BinaryTraceOp::CREATE: {
+      auto fnName = record.readString();
+      auto switchId = record.read<sai_object_id_t>();
+      auto attrs = record.readAttributes();
+      logCreateFn(
+          fnName,
+          &objectId,
+          switchId,
+          attrs.size(),
+          attrs.data(),
+          header.objectType);
+      break;
+    }
+    case BinaryTraceOp::POST_INVOCATION:
+      logPostInvocation(header.rv, objectId);
+      break;
+    case BinaryTraceOp::REMOVE:
+      logRemoveFn(record.readString(), objectId, header.objectType, header.rv);
+      break;
+    case BinaryTraceOp::SET_ATTR: {
+      auto fnName = record.readString();
+      auto attrs = record.readAttributes();
+      logSetAttrFn(
+          fnName, objectId, attrs.data(), header.objectType, header.rv);
+      break;
+    }
+    case BinaryTraceOp::GET_ATTR: {
+      auto fnName = record.readString();
+      auto attrs = record.readAttributes();
+      logGetAttrFn(
+          fnName,
+          objectId,
+          attrs.size(),
+          attrs.data(),
+          header.objectType,
+          header.rv);
+      break;
+    }
+    case BinaryTraceOp::BULK_SET_ATTR: {
+      auto fnName = record.readString();
+      auto mode = record.read<sai_bulk_op_error_mode_t>();
+      auto objectIds = record.readArray<sai_object_id_t>();
+      auto objectStatuses = record.readArray<sai_status_t>();
+      auto attrs = record.readAttributes();
+      logBulkSetAttrFn(
+          fnName,
+          objectIds.size(),
+          objectIds.data(),
+          attrs.data(),
+          mode,
+          objectStatuses.data(),
+          header.objectType,
+          header.rv);
+      break;
+    }
+    case BinaryTraceOp::ENTRY_CREATE:
+      convertEntryRecord(
+          record,
+          [this, &record, &header](const auto* entry) {
+            auto attrs = record.readAttributes();
+            using EntryT = std::remove_cv_t<
+                std::remove_pointer_t<decltype(entry)>>;
+            if constexpr (std::is_same_v<EntryT, sai_route_entry_t>) {
+              logRouteEntryCreateFn(
+                  entry, attrs.size(), attrs.data(), header.rv);
+            } else if constexpr (std::is_same_v<
+                                     EntryT,
+                                     sai_neighbor_entry_t>) {
+              logNeighborEntryCreateFn(
+                  entry, attrs.size(), attrs.data(), header.rv);
+            } else if constexpr (std::is_same_v<EntryT, sai_fdb_entry_t>) {
+              logFdbEntryCreateFn(
+                  entry, attrs.size(), attrs.data(), header.rv);
+            } else {
+              logInsegEntryCreateFn(
+                  entry, attrs.size(), attrs.data(), header.rv);
+            }
+          });
+      break;
+    case BinaryTraceOp::ENTRY_REMOVE:
+      convertEntryRecord(record, [this, &header](const auto* entry) {
+        using EntryT =
+            std::remove_cv_t<std::remove_pointer_t<decltype(entry)>>;
+        if constexpr (std::is_same_v<EntryT, sai_route_entry_t>) {
+          logRouteEntryRemoveFn(entry, header.rv);
+        } else if constexpr (std::is_same_v<EntryT, sai_neighbor_entry_t>) {
+          logNeighborEntryRemoveFn(entry, header.rv);
+        } else if constexpr (std::is_same_v<EntryT, sai_fdb_entry_t>) {
+          logFdbEntryRemoveFn(entry, header.rv);
+        } else {
+          logInsegEntryRemoveFn(entry, header.rv);
+        }
+      });
+      break;
+    case BinaryTraceOp::ENTRY_SET_ATTR:
+      convertEntryRecord(
+          record, [this, &record, &header](const auto* entry) {
+            auto attrs = record.readAttributes();
+            using EntryT = std::remove_cv_t<
+                std::remove_pointer_t<decltype(entry)>>;
+            if constexpr (std::is_same_v<EntryT, sai_route_entry_t>) {
+              logRouteEntrySetAttrFn(entry, attrs.data(), header.rv);
+            } else if constexpr (std::is_same_v<
+                                     EntryT,
+                                     sai_neighbor_entry_t>) {
+              logNeighborEntrySetAttrFn(entry, attrs.data(), header.rv);
+            } else if constexpr (std::is_same_v<EntryT, sai_fdb_entry_t>) {
+              logFdbEntrySetAttrFn(entry, attrs.data(), header.rv);
+            } else {
+              logInsegEntrySetAttrFn(entry, attrs.data(), header.rv);
+            }
+          });
+      break;
+    case BinaryTraceOp::SEND_HOSTIF_PACKET: {
+      auto buffer = record.readArray<uint8_t>();
+      auto attrs = record.readAttributes();
+      logSendHostifPacketFn(
+          objectId,
+          buffer.size(),
+          buffer.data(),
+          attrs.size(),
+          attrs.data(),
+          header.rv);
+      break;
+    }
+    case BinaryTraceOp::GET_STATS: {
+      auto fnName = record.readString();
+      auto mode = record.read<int>();
+      auto counterIds = record.readArray<sai_stat_id_t>();
+      auto counters = record.readArray<uint64_t>();
+      logGetStatsFn(
+          fnName,
+          objectId,
+          counterIds.size(),
+          counterIds.data(),
+          counters.data(),
+          header.objectType,
+          header.rv,
+          mode);
+      break;
+    }
+    case BinaryTraceOp::CLEAR_STATS: {
+      auto fnName = record.readString();
+      auto counterIds = record.readArray<sai_stat_id_t>();
+      logClearStatsFn(
+          fnName,
+          objectId,
+          counterIds.size(),
+          counterIds.data(),
+          header.objectType,
+          header.rv);
+      break;
+    }
+    default:
+      throw FbossError(
+          "Unknown op ",
+          static_cast<int>(header.op),
+          " in binary SAI replayer log");
+  }
+}
+
 void SaiTracer::setupGlobals() {
   // TODO(zecheng): Handle list size that's larger than 512 bytes.
   vector<string> globalVar = {to<string>(
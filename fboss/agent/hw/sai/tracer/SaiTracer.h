@@ -9,14 +9,17 @@
  */
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <memory>
+#include <optional>
 #include <tuple>
 #include <typeindex>
 
 #include "fboss/agent/AsyncLogger.h"
 #include "fboss/agent/hw/sai/api/SaiVersion.h"
 #include "fboss/agent/hw/sai/api/Traits.h"
+#include "fboss/agent/hw/sai/tracer/BinaryTrace.h"
 #include "fboss/agent/hw/sai/tracer/Utils.h"
 
 #include <folly/File.h>
@@ -31,6 +34,7 @@ extern "C" {
 
 DECLARE_bool(enable_replayer);
 DECLARE_bool(enable_packet_log);
+DECLARE_bool(enable_binary_replayer_log);
 
 using PrimitiveFunction = std::string (*)(const sai_attribute_t*, int);
 using AttributeFunction =
@@ -60,6 +64,11 @@ class SaiTracer {
 
   void logApiQuery(sai_api_t api_id, const std::string& api_var);
 
+  void logGetObjectKeyFn(
+      sai_object_type_t object_type,
+      uint32_t object_count,
+      const sai_object_key_t* object_list);
+
   void logSwitchCreateFn(
       sai_object_id_t* switch_id,
       uint32_t attr_count,
@@ -200,6 +209,18 @@ class SaiTracer {
 
   void logPostInvocation(sai_status_t rv, sai_object_id_t object_id);
 
+  /*
+   * Generate the C program out of the current boot of a log written with
+   * --enable_binary_replayer_log, by replaying its records through the
+   * log functions above.
+   */
+  void convertBinaryLog(BinaryTraceParser& parser);
+
+  void packAttribute(
+      const sai_attribute_t& attr,
+      std::size_t typeIndex,
+      BinaryTraceRecord& record);
+
   sai_acl_api_t* aclApi_;
   sai_bridge_api_t* bridgeApi_;
   sai_buffer_api_t* bufferApi_;
@@ -276,6 +297,19 @@ class SaiTracer {
 
   };
 
+  // Lists to copy into binary logs, keyed the same as listFuncMap_
+  std::unordered_map<std::size_t, BinaryTraceListType> listTypeMap_{
+      {TYPE_INDEX(std::vector<sai_object_id_t>),
+       BinaryTraceListType::OBJECT_ID},
+      {TYPE_INDEX(std::vector<sai_uint32_t>), BinaryTraceListType::U32},
+      {TYPE_INDEX(std::vector<sai_int32_t>), BinaryTraceListType::S32},
+      {TYPE_INDEX(std::vector<sai_qos_map_t>), BinaryTraceListType::QOS_MAP},
+      {TYPE_INDEX(AclEntryActionSaiObjectIdList),
+       BinaryTraceListType::ACL_ACTION_OBJECT_ID},
+      {TYPE_INDEX(std::vector<sai_system_port_config_t>),
+       BinaryTraceListType::SYSTEM_PORT_CONFIG},
+  };
+
  private:
   // Helper methods for variables and attribute list
   std::vector<std::string> setAttrList(
@@ -283,6 +317,12 @@ class SaiTracer {
       uint32_t attr_count,
       sai_object_type_t object_type);
 
+  void packAttrList(
+      BinaryTraceRecord& record,
+      const sai_attribute_t* attr_list,
+      uint32_t attr_count,
+      sai_object_type_t object_type);
+
   std::string createFnCall(
       const std::string& fn_name,
       const std::string& var1,
@@ -320,10 +360,19 @@ class SaiTracer {
 
   void writeFooter();
 
+  // Binary log helpers
+  void writeBinaryHeader();
+  void writeBinaryRecord(BinaryTraceRecord& record);
+  void convertBinaryRecord(folly::ByteRange data);
+  template <typename ConvertFn>
+  void convertEntryRecord(BinaryTraceRecordReader& record, ConvertFn convert);
+
   uint32_t maxAttrCount_;
   uint32_t maxListCount_;
   uint32_t numCalls_;
   std::unique_ptr<AsyncLogger> asyncLogger_;
+  // Time of the original call while converting a binary log
+  std::optional<std::chrono::system_clock::time_point> convertedCallTime_;
 
   // Variables mappings in generated C code
   // varCounts map from object type to the current counter
@@ -515,7 +564,11 @@ class SaiTracer {
   void set##obj_type##Attributes(                \
       const sai_attribute_t* attr_list,          \
       uint32_t attr_count,                       \
-      std::vector<std::string>& attrLines);
+      std::vector<std::string>& attrLines);      \
+  void pack##obj_type##Attributes(               \
+      const sai_attribute_t* attr_list,          \
+      uint32_t attr_count,                       \
+      BinaryTraceRecord& record);
 
 #define WRAP_CREATE_FUNC(obj_type, sai_obj_type, api_type)                 \
   sai_status_t wrap_create_##obj_type(                                     \
@@ -815,20 +868,39 @@ class SaiTracer {
   }                                                                          \
   }
 
+// Binary log counterpart of set##obj_type##Attributes, only needs to know
+// which attributes point to lists
+#define PACK_SAI_ATTRIBUTES(obj_type)                                 \
+  void pack##obj_type##Attributes(                                    \
+      const sai_attribute_t* attr_list,                               \
+      uint32_t attr_count,                                            \
+      BinaryTraceRecord& record) {                                    \
+    for (int i = 0; i < attr_count; ++i) {                            \
+      auto iter = _##obj_type##Map.find(attr_list[i].id);             \
+      SaiTracer::getInstance()->packAttribute(                        \
+          attr_list[i],                                               \
+          iter != _##obj_type##Map.end() ? iter->second.second : 0,   \
+          record);                                                    \
+    }                                                                 \
+  }
+
 // TODO - Combine this to once macro once the SAI SDK dependency is gone
 #define SET_SAI_ATTRIBUTES(obj_type)   \
   SET_SAI_REGULAR_ATTRIBUTES(obj_type) \
-  SET_SAI_STRING_ATTRIBUTES(obj_type)
+  SET_SAI_STRING_ATTRIBUTES(obj_type)  \
+  PACK_SAI_ATTRIBUTES(obj_type)
 
 #if SAI_API_VERSION >= SAI_VERSION(1, 10, 2)
-#define SET_SAI_ATTRIBUTES_ACL_COUNTER(obj_type) \
-  SET_SAI_REGULAR_ATTRIBUTES(obj_type)           \
-  SET_SAI_STRING_ATTRIBUTES_ACL_COUNTER(obj_type)
+#define SET_SAI_ATTRIBUTES_ACL_COUNTER(obj_type)  \
+  SET_SAI_REGULAR_ATTRIBUTES(obj_type)            \
+  SET_SAI_STRING_ATTRIBUTES_ACL_COUNTER(obj_type) \
+  PACK_SAI_ATTRIBUTES(obj_type)
 #else
 #define SET_SAI_ATTRIBUTES_ACL_COUNTER(obj_type) \
   SET_SAI_REGULAR_ATTRIBUTES(obj_type)           \
   }                                              \
-  }
+  }                                              \
+  PACK_SAI_ATTRIBUTES(obj_type)
 #endif
 
 } // namespace facebook::fboss
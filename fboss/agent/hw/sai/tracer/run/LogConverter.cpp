@@ -0,0 +1,73 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/agent/hw/sai/tracer/BinaryTrace.h"
+#include "fboss/agent/hw/sai/tracer/SaiTracer.h"
+
+#include <folly/FileUtil.h>
+#include <folly/init/Init.h>
+#include <folly/logging/xlog.h>
+#include <gflags/gflags.h>
+
+DECLARE_bool(enable_get_attr_log);
+DECLARE_string(sai_log);
+DECLARE_int32(default_list_size);
+DECLARE_int32(default_list_count);
+
+DEFINE_string(
+    binary_log,
+    "",
+    "Binary SAI replayer log, as written with --enable_binary_replayer_log");
+
+DEFINE_string(output, "sai_replayer.log", "Path of the generated C code");
+
+/*
+ * Turn a binary SAI replayer log into the same C program the replayer
+ * would have logged in text mode, e.g.
+ *   sai_replayer_log_converter --binary_log sai_replayer.log.bin \
+ *     --output sai_replayer.log
+ */
+int main(int argc, char** argv) {
+  folly::init(&argc, &argv, true);
+  if (FLAGS_binary_log.empty()) {
+    XLOG(ERR) << "--binary_log is required";
+    return 1;
+  }
+
+  std::string log;
+  if (!folly::readFile(FLAGS_binary_log.c_str(), log)) {
+    XLOG(ERR) << "Failed to read " << FLAGS_binary_log;
+    return 1;
+  }
+  facebook::fboss::BinaryTraceParser parser(
+      folly::ByteRange(folly::StringPiece(log)));
+
+  // Generate the code with the flags the log was written with
+  const auto& header = parser.fileHeader();
+  FLAGS_enable_replayer = true;
+  FLAGS_enable_binary_replayer_log = false;
+  FLAGS_enable_get_attr_log = header.enableGetAttrLog;
+  FLAGS_enable_packet_log = header.enablePacketLog;
+  FLAGS_default_list_size = header.defaultListSize;
+  FLAGS_default_list_count = header.defaultListCount;
+  FLAGS_sai_log = FLAGS_output;
+
+  XLOG(INFO) << "Converting log of boot:\n" << parser.bootHeader();
+  facebook::fboss::SaiTracer::getInstance()->convertBinaryLog(parser);
+  int laterBoots = 0;
+  while (parser.nextBoot()) {
+    ++laterBoots;
+  }
+  if (laterBoots) {
+    XLOG(WARN) << "Ignoring " << laterBoots
+               << " later boots, only the first boot is converted";
+  }
+  return 0;
+}
@@ -0,0 +1,203 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/agent/FbossError.h"
+#include "fboss/agent/hw/sai/tracer/BinaryTrace.h"
+#include "fboss/agent/hw/sai/tracer/SaiTracer.h"
+
+#include <cstring>
+
+#include <folly/Conv.h>
+#include <folly/FileUtil.h>
+#include <gflags/gflags.h>
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+DECLARE_string(sai_log);
+
+#define TEST_BINARY_LOG "/tmp/sai_binary_trace_test.bin"
+#define TEST_CONVERTED_LOG "/tmp/sai_binary_trace_test.log"
+
+using namespace facebook::fboss;
+
+namespace {
+
+constexpr auto kVariable = "SAI_KEY_INIT_CONFIG_FILE";
+// Records of this size start with "//", like AsyncLogger's boot header
+constexpr uint32_t kSlashSlashRecordSize = 0x2F2F;
+
+// Value making the API_INITIALIZE record kSlashSlashRecordSize bytes
+std::string slashSlashValue() {
+  auto size = kSlashSlashRecordSize - sizeof(BinaryTraceRecordHeader) -
+      sizeof(int) - sizeof(uint32_t) - strlen(kVariable) - sizeof(uint32_t);
+  return std::string(size, 'x');
+}
+
+std::string readLog(const char* path) {
+  std::string log;
+  EXPECT_TRUE(folly::readFile(path, log));
+  std::remove(path);
+  return log;
+}
+
+} // namespace
+
+class BinaryTraceTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    FLAGS_enable_replayer = true;
+  }
+
+  // Log the calls of one boot in binary, returning the log
+  std::string writeBoot(
+      const std::string& value,
+      sai_api_t api,
+      const std::string& apiVar) {
+    FLAGS_enable_binary_replayer_log = true;
+    FLAGS_sai_log = TEST_BINARY_LOG;
+    {
+      SaiTracer tracer;
+      const char* variables[] = {kVariable};
+      const char* values[] = {value.c_str()};
+      tracer.logApiInitialize(variables, values, 1);
+      tracer.logApiQuery(api, apiVar);
+    }
+    return readLog(TEST_BINARY_LOG);
+  }
+
+  // Generate the C program of the parser's current boot
+  std::string convert(BinaryTraceParser& parser) {
+    FLAGS_enable_binary_replayer_log = false;
+    FLAGS_sai_log = TEST_CONVERTED_LOG;
+    {
+      SaiTracer tracer;
+      tracer.convertBinaryLog(parser);
+    }
+    return readLog(TEST_CONVERTED_LOG);
+  }
+
+  gflags::FlagSaver flagSaver;
+};
+
+TEST_F(BinaryTraceTest, recordRoundTrip) {
+  BinaryTraceRecord record(
+      BinaryTraceOp::REMOVE,
+      SAI_OBJECT_TYPE_ROUTE_ENTRY,
+      SAI_STATUS_FAILURE,
+      5);
+  record.append<uint16_t>(7);
+  record.appendString("remove_route_entry");
+  std::vector<sai_object_id_t> objects{1, 2, 3};
+  record.appendArray(objects.data(), objects.size());
+  std::vector<sai_uint32_t> list{10, 20, 30};
+  sai_attribute_t attr;
+  attr.id = 4;
+  attr.value.u32list.count = list.size();
+  attr.value.u32list.list = list.data();
+  record.append<uint32_t>(1);
+  // Only the first two entries get logged
+  record.appendAttribute(attr, BinaryTraceListType::U32, 2);
+  auto data = record.finish();
+
+  BinaryTraceRecordReader reader(folly::ByteRange(data));
+  EXPECT_EQ(reader.header().size, data.size());
+  EXPECT_EQ(reader.header().op, BinaryTraceOp::REMOVE);
+  EXPECT_EQ(reader.header().objectType, SAI_OBJECT_TYPE_ROUTE_ENTRY);
+  EXPECT_EQ(reader.header().rv, SAI_STATUS_FAILURE);
+  EXPECT_EQ(reader.header().objectId, 5);
+  EXPECT_EQ(reader.read<uint16_t>(), 7);
+  EXPECT_EQ(reader.readString(), "remove_route_entry");
+  EXPECT_EQ(reader.readArray<sai_object_id_t>(), objects);
+  auto attrs = reader.readAttributes();
+  ASSERT_EQ(attrs.size(), 1);
+  EXPECT_EQ(attrs[0].id, 4);
+  EXPECT_EQ(attrs[0].value.u32list.count, 3);
+  EXPECT_NE(attrs[0].value.u32list.list, list.data());
+  EXPECT_EQ(attrs[0].value.u32list.list[0], 10);
+  EXPECT_EQ(attrs[0].value.u32list.list[1], 20);
+  // Nothing left to read
+  EXPECT_THROW(reader.read<uint8_t>(), FbossError);
+}
+
+TEST_F(BinaryTraceTest, bootsAppendedToLog) {
+  auto log = writeBoot(slashSlashValue(), SAI_API_ROUTE, "routeApi");
+  log += writeBoot("config", SAI_API_PORT, "portApi");
+  BinaryTraceParser parser{folly::ByteRange(folly::StringPiece(log))};
+
+  // First boot, with a record that looks like a boot header
+  EXPECT_TRUE(parser.bootHeader().startsWith("// Start of a "));
+  EXPECT_EQ(parser.fileHeader().version, BinaryTraceFileHeader::kVersion);
+  auto record = parser.nextRecord();
+  EXPECT_EQ(record.size(), kSlashSlashRecordSize);
+  EXPECT_TRUE(folly::StringPiece(record).startsWith("//"));
+  EXPECT_EQ(
+      BinaryTraceRecordReader(record).header().op,
+      BinaryTraceOp::API_INITIALIZE);
+  EXPECT_EQ(
+      BinaryTraceRecordReader(parser.nextRecord()).header().op,
+      BinaryTraceOp::API_QUERY);
+  EXPECT_TRUE(parser.nextRecord().empty());
+
+  // Second boot
+  EXPECT_TRUE(parser.nextBoot());
+  EXPECT_TRUE(parser.bootHeader().startsWith("// Start of a "));
+  EXPECT_EQ(
+      BinaryTraceRecordReader(parser.nextRecord()).header().op,
+      BinaryTraceOp::API_INITIALIZE);
+  EXPECT_EQ(
+      BinaryTraceRecordReader(parser.nextRecord()).header().op,
+      BinaryTraceOp::API_QUERY);
+  EXPECT_TRUE(parser.nextRecord().empty());
+  EXPECT_FALSE(parser.nextBoot());
+}
+
+TEST_F(BinaryTraceTest, convertBoots) {
+  auto value = slashSlashValue();
+  auto log = writeBoot(value, SAI_API_ROUTE, "routeApi");
+  log += writeBoot("config", SAI_API_PORT, "portApi");
+  BinaryTraceParser parser{folly::ByteRange(folly::StringPiece(log))};
+
+  // Same code as text logging would have written
+  auto code = convert(parser);
+  EXPECT_NE(
+      code.find(folly::to<std::string>(
+          "kSaiProfileValues.emplace(\"", kVariable, "\",\"", value, "\")")),
+      std::string::npos);
+  EXPECT_NE(
+      code.find(folly::to<std::string>(
+          "sai_api_query((sai_api_t)", SAI_API_ROUTE, ",(void**)&routeApi)")),
+      std::string::npos);
+  EXPECT_EQ(code.find("portApi"), std::string::npos);
+
+  ASSERT_TRUE(parser.nextBoot());
+  code = convert(parser);
+  EXPECT_NE(
+      code.find(folly::to<std::string>(
+          "kSaiProfileValues.emplace(\"", kVariable, "\",\"config\")")),
+      std::string::npos);
+  EXPECT_NE(
+      code.find(folly::to<std::string>(
+          "sai_api_query((sai_api_t)", SAI_API_PORT, ",(void**)&portApi)")),
+      std::string::npos);
+  EXPECT_EQ(code.find("routeApi"), std::string::npos);
+}
+
+TEST_F(BinaryTraceTest, malformedLog) {
+  std::string text = "// Start of a coldboot\n";
+  EXPECT_THROW(
+      BinaryTraceParser{folly::ByteRange(folly::StringPiece(text))},
+      FbossError);
+
+  auto log = writeBoot("config", SAI_API_PORT, "portApi");
+  log.resize(log.size() - 1);
+  BinaryTraceParser parser{folly::ByteRange(folly::StringPiece(log))};
+  parser.nextRecord();
+  EXPECT_THROW(parser.nextRecord(), FbossError);
+}
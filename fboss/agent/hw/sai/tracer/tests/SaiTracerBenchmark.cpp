@@ -0,0 +1,99 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/agent/hw/sai/api/RouteApi.h"
+#include "fboss/agent/hw/sai/fake/FakeSai.h"
+#include "fboss/agent/hw/sai/tracer/SaiTracer.h"
+
+#include <folly/Benchmark.h>
+#include <folly/IPAddressV6.h>
+#include <folly/init/Init.h>
+
+DECLARE_string(sai_log);
+
+/*
+ * Cost of tracing route programming on the calling thread, with the
+ * replayer disabled, logging C code, and logging binary records.
+ */
+
+namespace facebook::fboss {
+
+namespace {
+
+void programRoutes(unsigned iters, int numRoutes, bool replayer, bool binary) {
+  folly::BenchmarkSuspender suspender;
+  auto fs = FakeSai::getInstance();
+  RouteApi routeApi;
+  std::vector<SaiRouteTraits::RouteEntry> routes;
+  routes.reserve(numRoutes);
+  for (int i = 0; i < numRoutes; ++i) {
+    auto bytes = folly::IPAddressV6("2401:db00::").toByteArray();
+    bytes[4] = i >> 8;
+    bytes[5] = i & 0xff;
+    folly::CIDRNetwork prefix(folly::IPAddressV6(bytes), 48);
+    routes.emplace_back(0, 0, prefix);
+  }
+  SaiRouteTraits::Attributes::PacketAction packetAction{
+      SAI_PACKET_ACTION_FORWARD};
+  SaiRouteTraits::Attributes::NextHopId nextHopId(5);
+
+  FLAGS_enable_replayer = replayer;
+  FLAGS_enable_binary_replayer_log = binary;
+  for (unsigned iter = 0; iter < iters; ++iter) {
+    suspender.dismiss();
+    for (const auto& route : routes) {
+#if SAI_API_VERSION >= SAI_VERSION(1, 10, 0)
+      routeApi.create<SaiRouteTraits>(
+          route, {packetAction, nextHopId, std::nullopt, std::nullopt});
+#else
+      routeApi.create<SaiRouteTraits>(
+          route, {packetAction, nextHopId, std::nullopt});
+#endif
+    }
+    for (const auto& route : routes) {
+      routeApi.remove(route);
+    }
+    suspender.rehire();
+  }
+  // Keep the tracer singleton logging for the next run
+  FLAGS_enable_replayer = true;
+  FLAGS_enable_binary_replayer_log = false;
+}
+
+} // namespace
+
+void routesNoTracing(unsigned iters, int numRoutes) {
+  programRoutes(iters, numRoutes, false, false);
+}
+
+void routesTextTracing(unsigned iters, int numRoutes) {
+  programRoutes(iters, numRoutes, true, false);
+}
+
+void routesBinaryTracing(unsigned iters, int numRoutes) {
+  programRoutes(iters, numRoutes, true, true);
+}
+
+BENCHMARK_PARAM(routesNoTracing, 10000);
+BENCHMARK_RELATIVE_PARAM(routesTextTracing, 10000);
+BENCHMARK_RELATIVE_PARAM(routesBinaryTracing, 10000);
+
+} // namespace facebook::fboss
+
+int main(int argc, char** argv) {
+  // Route api calls go through the tracer's wrappers only if it is enabled
+  // by the time the api gets queried
+  FLAGS_enable_replayer = true;
+  FLAGS_sai_log = "/tmp/sai_tracer_benchmark.log";
+  folly::init(&argc, &argv, true);
+  sai_api_initialize(0, nullptr);
+  folly::runBenchmarks();
+  return 0;
+}
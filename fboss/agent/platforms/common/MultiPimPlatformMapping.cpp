@@ -20,7 +20,13 @@ namespace facebook {
 namespace fboss {
 MultiPimPlatformMapping::MultiPimPlatformMapping(
     const std::string& jsonPlatformMappingStr)
-    : PlatformMapping(jsonPlatformMappingStr) {
+    : MultiPimPlatformMapping(
+          apache::thrift::SimpleJSONSerializer::deserialize<
+              cfg::PlatformMapping>(jsonPlatformMappingStr)) {}
+
+MultiPimPlatformMapping::MultiPimPlatformMapping(
+    const cfg::PlatformMapping& mapping)
+    : PlatformMapping(mapping) {
   for (auto& port : platformPorts_) {
     int portPimID = getPimID(port.second);
 
@@ -17,6 +17,7 @@ namespace fboss {
 class MultiPimPlatformMapping : public PlatformMapping {
  public:
   explicit MultiPimPlatformMapping(const std::string& jsonPlatformMappingStr);
+  explicit MultiPimPlatformMapping(const cfg::PlatformMapping& mapping);
 
   PlatformMapping* getPimPlatformMapping(uint8_t pimID);
 
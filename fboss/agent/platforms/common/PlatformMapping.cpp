@@ -143,6 +143,11 @@ std::string PlatformPortProfileConfigMatcher::toString() const {
   return str;
 }
 
+cfg::PlatformMapping platformMappingFromBlob(folly::ByteRange blob) {
+  return apache::thrift::CompactSerializer::deserialize<cfg::PlatformMapping>(
+      blob);
+}
+
 PlatformMapping::PlatformMapping(const std::string& jsonPlatformMappingStr) {
   init(apache::thrift::SimpleJSONSerializer::deserialize<cfg::PlatformMapping>(
       jsonPlatformMappingStr));
@@ -14,12 +14,21 @@
 #include "fboss/lib/phy/gen-cpp2/phy_types.h"
 #include "fboss/qsfp_service/if/gen-cpp2/transceiver_types.h"
 
+#include <folly/Range.h>
+
 namespace facebook {
 namespace fboss {
 
 cfg::PlatformPortConfigOverrideFactor buildPlatformPortConfigOverrideFactor(
     const TransceiverInfo& transceiverInfo);
 
+/*
+ * Deserialize a platform mapping serialized with thrift's compact protocol,
+ * as generated from the platform mapping json at build time by
+ * platform_mapping_blob_gen
+ */
+cfg::PlatformMapping platformMappingFromBlob(folly::ByteRange blob);
+
 class PlatformMapping;
 class PlatformPortProfileConfigMatcher {
  public:
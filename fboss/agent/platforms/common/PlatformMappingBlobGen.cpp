@@ -0,0 +1,122 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+/*
+ * Build time converter of platform mapping json into a C++ source file
+ * defining a function which returns the mapping serialized with thrift's
+ * compact protocol. Parsing happens once here rather than at every agent
+ * and qsfp_service start, and the compact encoding takes a fraction of the
+ * space of the json in the binaries.
+ */
+
+#include "fboss/agent/gen-cpp2/platform_config_types.h"
+
+#include <folly/Conv.h>
+#include <folly/FileUtil.h>
+#include <folly/Format.h>
+#include <folly/init/Init.h>
+#include <folly/logging/xlog.h>
+#include <gflags/gflags.h>
+#include <thrift/lib/cpp2/protocol/Serializer.h>
+
+DEFINE_string(json, "", "Platform mapping json file to convert");
+DEFINE_string(output, "", "C++ source file to generate");
+DEFINE_string(
+    function,
+    "",
+    "Name of the generated function returning the serialized mapping, in "
+    "the facebook::fboss namespace");
+DEFINE_bool(
+    raw_json,
+    false,
+    "Have the generated function return the json text as is instead, for "
+    "tests checking the serialized mapping against it");
+
+namespace {
+constexpr auto kBytesPerLine = 16;
+constexpr auto kRawJsonDelimiter = "platform_mapping_json";
+
+std::string generateSource(const std::string& blob) {
+  std::string source = folly::sformat(
+      "// @"
+      "generated by platform_mapping_blob_gen from {}\n"
+      "// Do not modify, edit the json instead.\n\n"
+      "#include <folly/Range.h>\n\n"
+      "namespace facebook::fboss {{\n\n"
+      "folly::ByteRange {}() {{\n"
+      "  static constexpr unsigned char kBlob[] = {{",
+      FLAGS_json,
+      FLAGS_function);
+  for (size_t i = 0; i < blob.size(); ++i) {
+    source += (i % kBytesPerLine) ? " " : "\n      ";
+    source += folly::sformat("{:#04x},", static_cast<uint8_t>(blob[i]));
+  }
+  source +=
+      "\n  };\n"
+      "  return folly::ByteRange(kBlob, sizeof(kBlob));\n"
+      "}\n\n"
+      "} // namespace facebook::fboss\n";
+  return source;
+}
+
+std::string generateRawJsonSource(const std::string& json) {
+  return folly::sformat(
+      "// @"
+      "generated by platform_mapping_blob_gen from {}\n"
+      "// Do not modify, edit the json instead.\n\n"
+      "#include <folly/Range.h>\n\n"
+      "namespace facebook::fboss {{\n\n"
+      "folly::StringPiece {}() {{\n"
+      "  return R\"{}({}){}\";\n"
+      "}}\n\n"
+      "}} // namespace facebook::fboss\n",
+      FLAGS_json,
+      FLAGS_function,
+      kRawJsonDelimiter,
+      json,
+      kRawJsonDelimiter);
+}
+} // namespace
+
+int main(int argc, char** argv) {
+  folly::init(&argc, &argv, true);
+  if (FLAGS_json.empty() || FLAGS_output.empty() || FLAGS_function.empty()) {
+    XLOG(ERR) << "--json, --output and --function are all required";
+    return 1;
+  }
+
+  std::string json;
+  if (!folly::readFile(FLAGS_json.c_str(), json)) {
+    XLOG(ERR) << "Failed to read " << FLAGS_json;
+    return 1;
+  }
+  // Also validates the json, so that a broken mapping fails the build
+  // rather than the agent's start
+  auto mapping = apache::thrift::SimpleJSONSerializer::deserialize<
+      facebook::fboss::cfg::PlatformMapping>(json);
+  auto blob = apache::thrift::CompactSerializer::serialize<std::string>(
+      mapping);
+
+  if (FLAGS_raw_json &&
+      json.find(folly::to<std::string>(")", kRawJsonDelimiter, "\"")) !=
+          std::string::npos) {
+    XLOG(ERR) << FLAGS_json << " can't be embedded in a raw string literal";
+    return 1;
+  }
+  auto source = FLAGS_raw_json ? generateRawJsonSource(json)
+                               : generateSource(blob);
+  if (!folly::writeFile(source, FLAGS_output.c_str())) {
+    XLOG(ERR) << "Failed to write " << FLAGS_output;
+    return 1;
+  }
+  XLOG(INFO) << FLAGS_json << ": " << json.size() << " bytes of json, "
+             << blob.size() << " bytes serialized";
+  return 0;
+}
@@ -0,0 +1,122 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/agent/platforms/common/fuji/Fuji16QPimPlatformMapping.h"
+#include "fboss/agent/platforms/common/sandia/Sandia8DDPimPlatformMapping.h"
+#include "fboss/agent/platforms/common/wedge400/Wedge400PlatformMapping.h"
+#include "fboss/agent/platforms/common/yamp/Yamp16QPimPlatformMapping.h"
+
+#include <folly/Benchmark.h>
+#include <folly/init/Init.h>
+#include <thrift/lib/cpp2/protocol/Serializer.h>
+
+#include <iostream>
+
+/*
+ * Cost of constructing platform mappings, as done at agent and qsfp_service
+ * start, from the compact thrift blobs generated at build time versus from
+ * the json they used to embed.
+ */
+
+using namespace facebook::fboss;
+
+namespace {
+
+template <typename Mapping>
+const std::string& getJson() {
+  static const auto json =
+      apache::thrift::SimpleJSONSerializer::serialize<std::string>(
+          Mapping().toThrift());
+  return json;
+}
+
+template <typename Mapping>
+const std::string& getBlob() {
+  static const auto blob =
+      apache::thrift::CompactSerializer::serialize<std::string>(
+          Mapping().toThrift());
+  return blob;
+}
+
+template <typename Mapping, typename BaseMapping>
+void fromJson(unsigned iters) {
+  folly::BenchmarkSuspender suspender;
+  const auto& json = getJson<Mapping>();
+  suspender.dismiss();
+  for (unsigned i = 0; i < iters; ++i) {
+    BaseMapping mapping(json);
+    folly::doNotOptimizeAway(mapping);
+  }
+}
+
+template <typename Mapping>
+void fromBlob(unsigned iters) {
+  for (unsigned i = 0; i < iters; ++i) {
+    Mapping mapping;
+    folly::doNotOptimizeAway(mapping);
+  }
+}
+
+template <typename Mapping>
+void printSizes(const std::string& name) {
+  std::cout << name << ": " << getJson<Mapping>().size()
+            << " bytes of json, " << getBlob<Mapping>().size()
+            << " bytes of blob" << std::endl;
+}
+
+} // namespace
+
+BENCHMARK(Yamp16QPimFromJson, iters) {
+  fromJson<Yamp16QPimPlatformMapping, MultiPimPlatformMapping>(iters);
+}
+
+BENCHMARK_RELATIVE(Yamp16QPimFromBlob, iters) {
+  fromBlob<Yamp16QPimPlatformMapping>(iters);
+}
+
+BENCHMARK_DRAW_LINE();
+
+BENCHMARK(Fuji16QPimFromJson, iters) {
+  fromJson<Fuji16QPimPlatformMapping, MultiPimPlatformMapping>(iters);
+}
+
+BENCHMARK_RELATIVE(Fuji16QPimFromBlob, iters) {
+  fromBlob<Fuji16QPimPlatformMapping>(iters);
+}
+
+BENCHMARK_DRAW_LINE();
+
+BENCHMARK(Sandia8DDPimFromJson, iters) {
+  fromJson<Sandia8DDPimPlatformMapping, MultiPimPlatformMapping>(iters);
+}
+
+BENCHMARK_RELATIVE(Sandia8DDPimFromBlob, iters) {
+  fromBlob<Sandia8DDPimPlatformMapping>(iters);
+}
+
+BENCHMARK_DRAW_LINE();
+
+BENCHMARK(Wedge400FromJson, iters) {
+  fromJson<Wedge400PlatformMapping, PlatformMapping>(iters);
+}
+
+BENCHMARK_RELATIVE(Wedge400FromBlob, iters) {
+  fromBlob<Wedge400PlatformMapping>(iters);
+}
+
+int main(int argc, char** argv) {
+  folly::init(&argc, &argv, true);
+  printSizes<Yamp16QPimPlatformMapping>("Yamp16QPim");
+  printSizes<Fuji16QPimPlatformMapping>("Fuji16QPim");
+  printSizes<Sandia8DDPimPlatformMapping>("Sandia8DDPim");
+  printSizes<Wedge400PlatformMapping>("Wedge400");
+  folly::runBenchmarks();
+  return 0;
+}
@@ -27,8 +27,15 @@
 
 #include <gtest/gtest.h>
 #include <thrift/lib/cpp/util/EnumUtils.h>
+#include <thrift/lib/cpp2/protocol/Serializer.h>
 #include <optional>
 
+namespace facebook::fboss {
+// Generated at build time from Yamp16QPimPlatformMapping.json
+folly::ByteRange yamp16QPimPlatformMappingBlob();
+folly::StringPiece yamp16QPimPlatformMappingJson();
+} // namespace facebook::fboss
+
 namespace facebook::fboss::test {
 
 cfg::PlatformPortProfileConfigEntry createPlatformPortProfileConfigEntry(
@@ -1306,4 +1313,24 @@ TEST_F(PlatformMappingTest, VerifyYampXphyLinePolaritySwap) {
   verifyXphyLinePolaritySwapByProfile(
       mapping.get(), mapping->getPlatformPorts(), expectedPolaritySwap);
 }
+
+TEST_F(PlatformMappingTest, VerifyBlobMatchesJsonPlatformMapping) {
+  // The checked in json the blob got generated from
+  auto json = yamp16QPimPlatformMappingJson().str();
+  auto jsonThrift =
+      apache::thrift::SimpleJSONSerializer::deserialize<cfg::PlatformMapping>(
+          json);
+
+  EXPECT_EQ(
+      platformMappingFromBlob(yamp16QPimPlatformMappingBlob()), jsonThrift);
+
+  Yamp16QPimPlatformMapping mapping;
+  MultiPimPlatformMapping jsonMapping(json);
+  EXPECT_EQ(mapping.toThrift(), jsonMapping.toThrift());
+  for (auto pimID = 2; pimID <= 9; ++pimID) {
+    EXPECT_EQ(
+        jsonMapping.getPimPlatformMapping(pimID)->toThrift(),
+        mapping.getPimPlatformMapping(pimID)->toThrift());
+  }
+}
 } // namespace facebook::fboss::test
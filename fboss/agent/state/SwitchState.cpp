@@ -18,6 +18,7 @@
 #include "fboss/agent/state/BufferPoolConfig.h"
 #include "fboss/agent/state/BufferPoolConfigMap.h"
 #include "fboss/agent/state/ControlPlane.h"
+#include "fboss/agent/state/ForwardingInformationBaseContainer.h"
 #include "fboss/agent/state/Interface.h"
 #include "fboss/agent/state/InterfaceMap.h"
 #include "fboss/agent/state/IpTunnel.h"
@@ -39,6 +40,8 @@
 #include "folly/IPAddress.h"
 #include "folly/IPAddressV4.h"
 
+#include <folly/futures/Future.h>
+
 using std::make_shared;
 using std::shared_ptr;
 using std::chrono::seconds;
@@ -71,6 +74,7 @@ constexpr auto kAclTableGroups = "aclTableGroups";
 constexpr auto kSystemPorts = "systemPorts";
 constexpr auto kTunnels = "ipTunnels";
 constexpr auto kTeFlows = "teFlows";
+
 } // namespace
 
 // TODO: it might be worth splitting up limits for ecmp/ucmp
@@ -81,6 +85,63 @@ DEFINE_uint32(
 
 namespace facebook::fboss {
 
+namespace {
+
+using FibV4Thrift =
+    decltype(std::declval<ForwardingInformationBaseV4>().toThrift());
+using FibV6Thrift =
+    decltype(std::declval<ForwardingInformationBaseV6>().toThrift());
+using FibMapThrift =
+    decltype(std::declval<ForwardingInformationBaseMap>().toThrift());
+
+struct FibContainerFutures {
+  std::shared_ptr<ForwardingInformationBaseContainer> container;
+  folly::Future<FibV4Thrift> fibV4;
+  folly::Future<FibV6Thrift> fibV6;
+};
+
+// Converts on executor, or right away on the calling thread if it is null
+template <typename Fn>
+folly::Future<std::invoke_result_t<Fn>> convertOn(
+    folly::Executor* executor,
+    Fn&& fn) {
+  if (!executor) {
+    return folly::makeFuture(fn());
+  }
+  return folly::via(folly::getKeepAliveToken(executor), std::forward<Fn>(fn));
+}
+
+// FIBs make up most of a large state, so each VRF's v4 and v6 FIBs get
+// converted separately rather than the FIB map as a whole
+std::vector<FibContainerFutures> convertFibsOn(
+    folly::Executor* executor,
+    const ForwardingInformationBaseMap& fibs) {
+  std::vector<FibContainerFutures> futures;
+  for (const auto& container : fibs) {
+    auto fibV4 = convertOn(
+        executor, [container] { return container->getFibV4()->toThrift(); });
+    auto fibV6 = convertOn(
+        executor, [container] { return container->getFibV6()->toThrift(); });
+    futures.push_back({container, std::move(fibV4), std::move(fibV6)});
+  }
+  return futures;
+}
+
+FibMapThrift collectFibs(std::vector<FibContainerFutures> futures) {
+  FibMapThrift fibs;
+  for (auto& [container, fibV4, fibV6] : futures) {
+    state::FibContainerFields fields;
+    fields.vrf() = container->getID();
+    fields.fibV4() = std::move(fibV4).get();
+    fields.fibV6() = std::move(fibV6).get();
+    fibs[ForwardingInformationBaseMap::getNodeThriftKey(container)] =
+        std::move(fields);
+  }
+  return fibs;
+}
+
+} // namespace
+
 SwitchStateFields::SwitchStateFields()
     : ports(make_shared<PortMap>()),
       aggPorts(make_shared<AggregatePortMap>()),
@@ -104,10 +165,37 @@ SwitchStateFields::SwitchStateFields()
       remoteInterfaces(make_shared<InterfaceMap>()) {}
 
 state::SwitchState SwitchStateFields::toThrift() const {
+  return toThrift(nullptr);
+}
+
+state::SwitchState SwitchStateFields::toThrift(
+    folly::Executor* executor) const {
+  // Kick off the large maps first, so that they get converted while the
+  // rest of the state is. Results only get assigned on this thread, as
+  // setting fields of the same thrift struct concurrently races on its
+  // isset bits. The tasks hold on to the maps they convert, in case this
+  // throws before they are done.
+  auto portMap =
+      convertOn(executor, [ports = ports] { return ports->toThrift(); });
+  auto vlanMap =
+      convertOn(executor, [vlans = vlans] { return vlans->toThrift(); });
+  auto aclMap =
+      convertOn(executor, [acls = acls] { return acls->toThrift(); });
+  auto interfaceMap = convertOn(
+      executor, [interfaces = interfaces] { return interfaces->toThrift(); });
+  auto labelFibMap = convertOn(
+      executor, [labelFib = labelFib] { return labelFib->toThrift(); });
+  auto remoteSystemPortMap =
+      convertOn(executor, [remoteSystemPorts = remoteSystemPorts] {
+        return remoteSystemPorts->toThrift();
+      });
+  auto remoteInterfaceMap =
+      convertOn(executor, [remoteInterfaces = remoteInterfaces] {
+        return remoteInterfaces->toThrift();
+      });
+  auto fibFutures = convertFibsOn(executor, *fibs);
+
   auto state = state::SwitchState();
-  state.portMap() = ports->toThrift();
-  state.vlanMap() = vlans->toThrift();
-  state.aclMap() = acls->toThrift();
   state.transceiverMap() = transceivers->toThrift();
   state.systemPortMap() = systemPorts->toThrift();
   state.ipTunnelMap() = ipTunnels->toThrift();
@@ -136,8 +224,6 @@ state::SwitchState SwitchStateFields::toThrift() const {
   if (pfcWatchdogRecoveryAction) {
     state.pfcWatchdogRecoveryAction() = *pfcWatchdogRecoveryAction;
   }
-  state.fibs() = fibs->toThrift();
-  state.labelFib() = labelFib->toThrift();
   state.qosPolicyMap() = qosPolicies->toThrift();
   if (defaultDataPlaneQosPolicy) {
     state.defaultDataPlaneQosPolicy() = defaultDataPlaneQosPolicy->toThrift();
@@ -148,15 +234,21 @@ state::SwitchState SwitchStateFields::toThrift() const {
   if (aclTableGroups) {
     state.aclTableGroupMap() = aclTableGroups->toThrift();
   }
-  state.interfaceMap() = interfaces->toThrift();
   if (qcmCfg) {
     state.qcmCfg() = qcmCfg->toThrift();
   }
   state.loadBalancerMap() = loadBalancers->toThrift();
   state.switchSettings() = switchSettings->toThrift();
+
+  state.portMap() = std::move(portMap).get();
+  state.vlanMap() = std::move(vlanMap).get();
+  state.aclMap() = std::move(aclMap).get();
+  state.interfaceMap() = std::move(interfaceMap).get();
+  state.labelFib() = std::move(labelFibMap).get();
+  state.fibs() = collectFibs(std::move(fibFutures));
   // Remote objects
-  state.remoteSystemPortMap() = remoteSystemPorts->toThrift();
-  state.remoteInterfaceMap() = remoteInterfaces->toThrift();
+  state.remoteSystemPortMap() = std::move(remoteSystemPortMap).get();
+  state.remoteInterfaceMap() = std::move(remoteInterfaceMap).get();
   return state;
 }
 
@@ -12,6 +12,7 @@
 #include <chrono>
 #include <memory>
 
+#include <folly/Executor.h>
 #include <folly/FBString.h>
 #include <folly/Memory.h>
 #include <folly/dynamic.h>
@@ -85,6 +86,13 @@ struct SwitchStateFields
   }
 
   state::SwitchState toThrift() const override;
+  /*
+   * Same as toThrift(), but converting the large maps, and each VRF's v4
+   * and v6 FIBs, concurrently on executor. Blocks until done, so must not
+   * be called from one of executor's threads. Converts on the calling
+   * thread only if executor is null.
+   */
+  state::SwitchState toThrift(folly::Executor* executor) const;
   static SwitchStateFields fromThrift(const state::SwitchState& state);
 
   // Used for testing thrifty conversion
@@ -195,6 +203,10 @@ class SwitchState : public NodeBaseT<SwitchState, SwitchStateFields> {
     return this->getFields()->toThrift();
   }
 
+  state::SwitchState toThrift(folly::Executor* executor) const {
+    return this->getFields()->toThrift(executor);
+  }
+
   static std::shared_ptr<SwitchState> fromThrift(
       const state::SwitchState& obj) {
     auto fields = SwitchStateFields::fromThrift(obj);
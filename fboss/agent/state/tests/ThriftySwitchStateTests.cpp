@@ -14,6 +14,7 @@
 #include "fboss/agent/state/AggregatePortMap.h"
 #include "fboss/agent/state/ArpResponseTable.h"
 #include "fboss/agent/state/BufferPoolConfig.h"
+#include "fboss/agent/state/ForwardingInformationBaseContainer.h"
 #include "fboss/agent/state/InterfaceMap.h"
 #include "fboss/agent/state/PortDescriptor.h"
 #include "fboss/agent/state/SwitchState.h"
@@ -22,6 +23,8 @@
 #include "folly/IPAddress.h"
 #include "folly/IPAddressV4.h"
 
+#include <folly/executors/CPUThreadPoolExecutor.h>
+
 using namespace facebook::fboss;
 using folly::IPAddressV4;
 using folly::IPAddressV6;
@@ -334,3 +337,45 @@ TEST(ThriftySwitchState, ExtraFields) {
 
   EXPECT_EQ(fields, SwitchStateFields::fromThrift(fields.toThrift()));
 }
+
+TEST(ThriftySwitchState, ParallelToThrift) {
+  auto state = SwitchState();
+
+  auto vlan = std::make_shared<Vlan>(VlanID(1), "vlan1");
+  auto arpTable = std::make_shared<ArpTable>();
+  for (uint32_t i = 1; i <= 100; ++i) {
+    arpTable->addEntry(
+        IPAddressV4::fromLongHBO(0x0a000000 + i),
+        MacAddress::fromHBO(0x020000000000 + i),
+        PortDescriptor(PortID(1)),
+        InterfaceID(1));
+  }
+  vlan->setArpTable(arpTable);
+  state.addVlan(vlan);
+
+  auto fibs = std::make_shared<ForwardingInformationBaseMap>();
+  for (auto vrf : {0, 1}) {
+    auto fibV4 = std::make_shared<ForwardingInformationBaseV4>();
+    auto fibV6 = std::make_shared<ForwardingInformationBaseV6>();
+    for (uint32_t i = 0; i < 100; ++i) {
+      RoutePrefixV4 prefixV4(
+          IPAddressV4::fromLongHBO(0x14000000 + (i << 8)), 24);
+      fibV4->addNode(
+          std::make_shared<RouteV4>(RouteFields<IPAddressV4>(prefixV4)));
+      RoutePrefixV6 prefixV6(
+          IPAddressV6(folly::to<std::string>("2401:", i, "::")), 64);
+      fibV6->addNode(
+          std::make_shared<RouteV6>(RouteFields<IPAddressV6>(prefixV6)));
+    }
+    auto container =
+        std::make_shared<ForwardingInformationBaseContainer>(RouterID(vrf));
+    container->setFib(fibV4);
+    container->setFib(fibV6);
+    fibs->addNode(container);
+  }
+  state.resetForwardingInformationBases(fibs);
+
+  folly::CPUThreadPoolExecutor executor(4);
+  EXPECT_EQ(state.toThrift(&executor), state.toThrift());
+  EXPECT_EQ(state.toThrift(nullptr), state.toThrift());
+}
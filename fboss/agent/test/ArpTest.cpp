@@ -37,6 +37,7 @@
 #include "fboss/agent/test/TestUtils.h"
 
 #include <boost/range/combine.hpp>
+#include <gflags/gflags.h>
 #include <gtest/gtest.h>
 #include <array>
 #include <future>
@@ -860,6 +861,56 @@ TEST(ArpTest, FlushEntry) {
       thriftHandler.flushNeighborEntry(std::move(binAddrPtr), 123), FbossError);
 }
 
+TEST(ArpTest, BatchedTableUpdates) {
+  gflags::FlagSaver flagSaver;
+  auto handle = setupTestHandle();
+  auto sw = handle->getSw();
+  VlanID vlanID(1);
+  auto hasEntry = [&](StringPiece ip) {
+    waitForStateUpdates(sw);
+    auto arpTable = sw->getState()->getVlans()->getVlan(vlanID)->getArpTable();
+    return arpTable->getEntryIf(IPAddressV4(ip)) != nullptr;
+  };
+
+  // Resolve the route nexthops first, so that their probes do not add
+  // pending entries to the batches below
+  EXPECT_HW_CALL(sw, stateChanged(_)).Times(testing::AtLeast(1));
+  sendArpReply(handle.get(), "10.0.0.22", "02:10:20:30:40:22", 4);
+  sendArpReply(handle.get(), "10.0.0.23", "02:10:20:30:40:23", 4);
+  EXPECT_TRUE(hasEntry("10.0.0.22"));
+  EXPECT_TRUE(hasEntry("10.0.0.23"));
+
+  // Only commit batches once full
+  FLAGS_neighbor_update_batch_interval_ms = 3600 * 1000;
+  FLAGS_neighbor_update_batch_size = 4;
+  CounterCache counters(sw);
+
+  sendArpReply(handle.get(), "10.0.0.11", "02:10:20:30:40:11", 2);
+  sendArpReply(handle.get(), "10.0.0.15", "02:10:20:30:40:15", 3);
+  sendArpReply(handle.get(), "10.0.0.7", "02:10:20:30:40:07", 1);
+  EXPECT_FALSE(hasEntry("10.0.0.11"));
+  EXPECT_FALSE(hasEntry("10.0.0.15"));
+  EXPECT_FALSE(hasEntry("10.0.0.7"));
+
+  // The 4th entry fills the batch, committing all of them in one update
+  sendArpReply(handle.get(), "10.0.0.8", "02:10:20:30:40:08", 1);
+  EXPECT_TRUE(hasEntry("10.0.0.11"));
+  EXPECT_TRUE(hasEntry("10.0.0.15"));
+  EXPECT_TRUE(hasEntry("10.0.0.7"));
+  EXPECT_TRUE(hasEntry("10.0.0.8"));
+  counters.update();
+  counters.checkDelta(
+      SwitchStats::kCounterPrefix + "neighbor_update_batches.sum", 1);
+
+  // Batches not filling up get committed once the oldest change in them
+  // has waited for the batch interval
+  FLAGS_neighbor_update_batch_interval_ms = 50;
+  sendArpReply(handle.get(), "10.0.0.12", "02:10:20:30:40:12", 2);
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  waitForNeighborCacheThread(sw);
+  EXPECT_TRUE(hasEntry("10.0.0.12"));
+}
+
 TEST(ArpTest, PendingArp) {
   auto handle = setupTestHandle();
   auto sw = handle->getSw();
@@ -0,0 +1,94 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/agent/AsyncLogger.h"
+
+#include <folly/Benchmark.h>
+#include <folly/init/Init.h>
+#include <gflags/gflags.h>
+
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+DECLARE_bool(async_logger_nonblocking);
+DECLARE_string(async_logger_overflow_policy);
+
+using namespace facebook::fboss;
+
+namespace {
+constexpr auto kBenchmarkLog = "/tmp/async_logger_benchmark";
+// Roughly the size of a traced SAI call
+constexpr auto kRecordSize = 256;
+} // namespace
+
+/*
+ * Throughput of threads logging concurrently, iters being the total number
+ * of records logged.
+ */
+void appendLogs(
+    unsigned iters,
+    int numThreads,
+    bool nonBlocking,
+    const std::string& overflowPolicy) {
+  folly::BenchmarkSuspender suspender;
+  gflags::FlagSaver flagSaver;
+  FLAGS_async_logger_nonblocking = nonBlocking;
+  FLAGS_async_logger_overflow_policy = overflowPolicy;
+  AsyncLogger logger(kBenchmarkLog, 100, AsyncLogger::SAI_REPLAYER);
+  logger.startFlushThread();
+  std::string record(kRecordSize, '.');
+
+  suspender.dismiss();
+  std::vector<std::thread> threads;
+  for (int i = 0; i < numThreads; ++i) {
+    threads.emplace_back([&]() {
+      for (unsigned j = 0; j < iters / numThreads; ++j) {
+        logger.appendLog(record.c_str(), record.size());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  suspender.rehire();
+
+  logger.forceFlush();
+  logger.stopFlushThread();
+  folly::doNotOptimizeAway(logger.getDropCount());
+}
+
+void blocking(unsigned iters, int numThreads) {
+  appendLogs(iters, numThreads, false, "drop");
+}
+
+void nonBlockingDrop(unsigned iters, int numThreads) {
+  appendLogs(iters, numThreads, true, "drop");
+}
+
+void nonBlockingWait(unsigned iters, int numThreads) {
+  appendLogs(iters, numThreads, true, "wait");
+}
+
+BENCHMARK_PARAM(blocking, 1);
+BENCHMARK_RELATIVE_PARAM(nonBlockingDrop, 1);
+BENCHMARK_RELATIVE_PARAM(nonBlockingWait, 1);
+BENCHMARK_PARAM(blocking, 4);
+BENCHMARK_RELATIVE_PARAM(nonBlockingDrop, 4);
+BENCHMARK_RELATIVE_PARAM(nonBlockingWait, 4);
+BENCHMARK_PARAM(blocking, 16);
+BENCHMARK_RELATIVE_PARAM(nonBlockingDrop, 16);
+BENCHMARK_RELATIVE_PARAM(nonBlockingWait, 16);
+
+int main(int argc, char** argv) {
+  folly::init(&argc, &argv, true);
+  folly::runBenchmarks();
+  std::remove(kBenchmarkLog);
+  return 0;
+}
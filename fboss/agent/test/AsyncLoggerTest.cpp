@@ -11,9 +11,15 @@
 #include "fboss/agent/AsyncLogger.h"
 
 #include <folly/CPortability.h>
+#include <folly/FileUtil.h>
+#include <gflags/gflags.h>
 #include <gtest/gtest.h>
 #include <stdio.h>
 
+DECLARE_bool(async_logger_nonblocking);
+DECLARE_int32(async_logger_num_buffers);
+DECLARE_string(async_logger_overflow_policy);
+
 #define TEST_LOG "/tmp/sai_logger_test"
 
 // Test string size that's larger than half of the buffer,
@@ -26,8 +32,7 @@ using namespace facebook::fboss;
 class AsyncLoggerTest : public ::testing::Test {
  public:
   void SetUp() override {
-    asyncLogger = std::make_unique<AsyncLogger>(
-        TEST_LOG, logTimeout, AsyncLogger::BCM_CINTER);
+    asyncLogger = std::make_unique<AsyncLogger>(TEST_LOG, logTimeout, srcType);
     asyncLogger->startFlushThread();
   }
 
@@ -40,6 +45,7 @@ class AsyncLoggerTest : public ::testing::Test {
   std::condition_variable cv;
   std::mutex latch;
   uint32_t logTimeout = 100;
+  AsyncLogger::LoggerSrcType srcType = AsyncLogger::BCM_CINTER;
 };
 
 // Skip this test in tsan mode because of the slow down introduced by
@@ -133,3 +139,126 @@ TEST_F(AsyncLoggerTest, concurrentWaitTest) {
   // Therefore, the flush count should be equal or greater than two.
   EXPECT_GE(asyncLogger->getFlushCount(), 2);
 }
+
+/*
+ * Runs with each source type and overflow policy. The SAI replayer log
+ * never drops, whatever the policy.
+ */
+class NonBlockingAsyncLoggerTest
+    : public AsyncLoggerTest,
+      public ::testing::WithParamInterface<
+          std::tuple<AsyncLogger::LoggerSrcType, std::string>> {
+ public:
+  void SetUp() override {
+    srcType = std::get<0>(GetParam());
+    FLAGS_async_logger_nonblocking = true;
+    FLAGS_async_logger_num_buffers = 2;
+    FLAGS_async_logger_overflow_policy = std::get<1>(GetParam());
+    AsyncLoggerTest::SetUp();
+  }
+
+  std::string readLog() {
+    std::string log;
+    folly::readFile(TEST_LOG, log);
+    return log;
+  }
+
+  size_t logSize() {
+    return readLog().size();
+  }
+
+  bool dropsOnOverflow() {
+    return srcType != AsyncLogger::SAI_REPLAYER &&
+        FLAGS_async_logger_overflow_policy == "drop";
+  }
+
+ private:
+  gflags::FlagSaver flagSaver_;
+};
+
+TEST_P(NonBlockingAsyncLoggerTest, forceflushTest) {
+  asyncLogger->forceFlush();
+  auto headerSize = logSize();
+
+  std::string str = "TestString";
+  asyncLogger->appendLog(str.c_str(), str.size());
+  asyncLogger->forceFlush();
+  EXPECT_EQ(logSize(), headerSize + str.size());
+}
+
+TEST_P(NonBlockingAsyncLoggerTest, concurrentAppendTest) {
+  asyncLogger->forceFlush();
+  auto headerSize = logSize();
+
+  // Enough appends to go around the ring several times
+  constexpr auto kThreads = 4;
+  constexpr auto kAppends = 1000;
+  std::string str(1000, '.');
+  std::vector<std::thread> threads;
+  {
+    // Stall flushes, so that the ring fills up
+    auto stall = asyncLogger->lockLogFileForTesting();
+    for (int i = 0; i < kThreads; ++i) {
+      threads.emplace_back([&]() {
+        for (int j = 0; j < kAppends; ++j) {
+          asyncLogger->appendLog(str.c_str(), str.size());
+        }
+      });
+    }
+    if (dropsOnOverflow()) {
+      for (auto& thread : threads) {
+        thread.join();
+      }
+    } else {
+      // Appends wait for the stall to end
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+  }
+  for (auto& thread : threads) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+  asyncLogger->forceFlush();
+
+  auto drops = asyncLogger->getDropCount();
+  if (dropsOnOverflow()) {
+    EXPECT_GT(drops, 0);
+  } else {
+    EXPECT_EQ(drops, 0);
+  }
+  EXPECT_EQ(
+      logSize() + drops * str.size(),
+      headerSize + kThreads * kAppends * str.size());
+}
+
+TEST_P(NonBlockingAsyncLoggerTest, oversizedTest) {
+  asyncLogger->forceFlush();
+  auto header = readLog();
+
+  // Too large to ever fit in a buffer
+  std::string before = "before";
+  std::string str(AsyncLogger::kBufferSize + 1, '.');
+  std::string after = "after";
+  asyncLogger->appendLog(before.c_str(), before.size());
+  asyncLogger->appendLog(str.c_str(), str.size());
+  asyncLogger->appendLog(after.c_str(), after.size());
+  asyncLogger->forceFlush();
+
+  if (dropsOnOverflow()) {
+    EXPECT_EQ(asyncLogger->getDropCount(), 1);
+    EXPECT_EQ(readLog(), header + before + after);
+  } else {
+    // Written out in order with the logs around it
+    EXPECT_EQ(asyncLogger->getDropCount(), 0);
+    EXPECT_EQ(readLog(), header + before + str + after);
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(
+    NonBlockingAsyncLoggerTest,
+    NonBlockingAsyncLoggerTest,
+    ::testing::Values(
+        std::make_tuple(AsyncLogger::BCM_CINTER, "wait"),
+        std::make_tuple(AsyncLogger::BCM_CINTER, "drop"),
+        std::make_tuple(AsyncLogger::SAI_REPLAYER, "drop")));
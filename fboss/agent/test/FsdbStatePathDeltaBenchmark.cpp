@@ -0,0 +1,135 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/agent/FsdbStatePathDeltaConverter.h"
+#include "fboss/agent/FsdbThriftDeltaBuilder.h"
+#include "fboss/agent/state/SwitchState.h"
+#include "fboss/agent/state/Vlan.h"
+#include "fboss/agent/state/VlanMap.h"
+
+#include <folly/Benchmark.h>
+#include <folly/Format.h>
+#include <folly/init/Init.h>
+
+#include <iostream>
+
+/*
+ * Cost of publishing a neighbor change to fsdb, on a vlan with 50k
+ * neighbors: encoding the whole vlan the change belongs to, versus
+ * converting the StateDelta into per-entry deltas.
+ */
+
+using namespace facebook::fboss;
+using folly::IPAddressV4;
+using folly::IPAddressV6;
+using folly::MacAddress;
+
+namespace {
+
+constexpr auto kNumNeighbors = 50000;
+const VlanID kVlan(1);
+
+IPAddressV4 arpIp(int i) {
+  return IPAddressV4::fromLongHBO(0x0a000000 + i);
+}
+
+std::shared_ptr<SwitchState> buildState() {
+  auto state = std::make_shared<SwitchState>();
+  state->addVlan(std::make_shared<Vlan>(kVlan, std::string("vlan1")));
+  auto vlan = state->getVlans()->getVlan(kVlan);
+  auto arpTable = vlan->getArpTable()->modify(kVlan, &state);
+  auto ndpTable = vlan->getNdpTable()->modify(kVlan, &state);
+  for (int i = 0; i < kNumNeighbors / 2; ++i) {
+    auto mac = MacAddress::fromHBO(0x020000000000 + i);
+    auto port = PortDescriptor(PortID(i % 64 + 1));
+    arpTable->addEntry(arpIp(i), mac, port, InterfaceID(1));
+    auto ip6 = IPAddressV6(folly::sformat("2401:db00::{:x}", i));
+    ndpTable->addEntry(ip6, mac, port, InterfaceID(1));
+  }
+  state->publish();
+  return state;
+}
+
+// A neighbor moving to another port
+std::shared_ptr<SwitchState> changeNeighbor(
+    const std::shared_ptr<SwitchState>& state,
+    int i) {
+  auto newState = state;
+  auto ip = arpIp(i % (kNumNeighbors / 2));
+  auto arpTable =
+      newState->getVlans()->getVlan(kVlan)->getArpTable()->modify(
+          kVlan, &newState);
+  auto entry = arpTable->getEntry(ip);
+  arpTable->updateEntry(
+      ip,
+      entry->getMac(),
+      PortDescriptor(PortID(entry->getPort().phyPortID() + 100)),
+      entry->getIntfID());
+  newState->publish();
+  return newState;
+}
+
+size_t vlanBytes(const StateDelta& delta) {
+  auto vlan = delta.newState()->getVlans()->getVlan(kVlan);
+  return thrift_cow::serialize<apache::thrift::type_class::structure>(
+             FsdbThriftDeltaBuilder::kProtocol, vlan->getFields()->toThrift())
+      .size();
+}
+
+size_t pathDeltaBytes(
+    const FsdbStatePathDeltaConverter& converter,
+    const StateDelta& delta) {
+  size_t bytes = 0;
+  for (const auto& unit : converter.computeDeltas(delta)) {
+    bytes += unit.oldState().value_or("").size();
+    bytes += unit.newState().value_or("").size();
+    for (const auto& tok : *unit.path()->raw()) {
+      bytes += tok.size();
+    }
+  }
+  return bytes;
+}
+
+} // namespace
+
+BENCHMARK(wholeVlan, iters) {
+  folly::BenchmarkSuspender suspender;
+  auto state = buildState();
+  for (unsigned i = 0; i < iters; ++i) {
+    StateDelta delta(state, changeNeighbor(state, i));
+    suspender.dismiss();
+    folly::doNotOptimizeAway(vlanBytes(delta));
+    suspender.rehire();
+  }
+}
+
+BENCHMARK_RELATIVE(pathDeltas, iters) {
+  folly::BenchmarkSuspender suspender;
+  auto state = buildState();
+  FsdbStatePathDeltaConverter converter({"agent", "switchState"});
+  for (unsigned i = 0; i < iters; ++i) {
+    StateDelta delta(state, changeNeighbor(state, i));
+    suspender.dismiss();
+    folly::doNotOptimizeAway(pathDeltaBytes(converter, delta));
+    suspender.rehire();
+  }
+}
+
+int main(int argc, char** argv) {
+  folly::init(&argc, &argv, true);
+  folly::runBenchmarks();
+
+  auto state = buildState();
+  StateDelta delta(state, changeNeighbor(state, 0));
+  FsdbStatePathDeltaConverter converter({"agent", "switchState"});
+  std::cout << "Bytes per neighbor change: whole vlan " << vlanBytes(delta)
+            << ", path deltas " << pathDeltaBytes(converter, delta)
+            << std::endl;
+  return 0;
+}
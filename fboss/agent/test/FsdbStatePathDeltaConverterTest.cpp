@@ -0,0 +1,146 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/agent/FsdbStatePathDeltaConverter.h"
+#include "fboss/agent/state/SwitchState.h"
+#include "fboss/agent/state/Vlan.h"
+#include "fboss/agent/state/VlanMap.h"
+
+#include <gtest/gtest.h>
+#include <map>
+#include <thrift/lib/cpp2/protocol/Serializer.h>
+
+using namespace facebook::fboss;
+using folly::IPAddressV4;
+using folly::MacAddress;
+
+namespace {
+
+const std::vector<std::string> kSwitchStatePath{"agent", "switchState"};
+const VlanID kVlan(1);
+
+std::vector<std::string> arpEntryPath(const std::string& ip) {
+  return {"agent", "switchState", "vlanMap", "1", "arpTable", ip};
+}
+
+std::shared_ptr<SwitchState> buildState() {
+  auto state = std::make_shared<SwitchState>();
+  state->addVlan(std::make_shared<Vlan>(kVlan, std::string("vlan1")));
+  auto arpTable =
+      state->getVlans()->getVlan(kVlan)->getArpTable()->modify(kVlan, &state);
+  arpTable->addEntry(
+      IPAddressV4("10.0.0.1"),
+      MacAddress("02:00:00:00:00:01"),
+      PortDescriptor(PortID(1)),
+      InterfaceID(1));
+  arpTable->addEntry(
+      IPAddressV4("10.0.0.2"),
+      MacAddress("02:00:00:00:00:02"),
+      PortDescriptor(PortID(2)),
+      InterfaceID(1));
+  state->publish();
+  return state;
+}
+
+std::map<std::vector<std::string>, fsdb::OperDeltaUnit> deltasByPath(
+    const std::vector<fsdb::OperDeltaUnit>& deltas) {
+  std::map<std::vector<std::string>, fsdb::OperDeltaUnit> byPath;
+  for (const auto& unit : deltas) {
+    byPath.emplace(*unit.path()->raw(), unit);
+  }
+  return byPath;
+}
+
+} // namespace
+
+TEST(FsdbStatePathDeltaConverterTest, neighborEntryDeltas) {
+  FsdbStatePathDeltaConverter converter(kSwitchStatePath);
+  auto oldState = buildState();
+  auto newState = oldState;
+  auto arpTable =
+      newState->getVlans()->getVlan(kVlan)->getArpTable()->modify(
+          kVlan, &newState);
+  arpTable->updateEntry(
+      IPAddressV4("10.0.0.1"),
+      MacAddress("02:00:00:00:00:11"),
+      PortDescriptor(PortID(1)),
+      InterfaceID(1));
+  arpTable->removeEntry(IPAddressV4("10.0.0.2"));
+  arpTable->addEntry(
+      IPAddressV4("10.0.0.3"),
+      MacAddress("02:00:00:00:00:03"),
+      PortDescriptor(PortID(3)),
+      InterfaceID(1));
+  newState->publish();
+
+  // one delta per entry, nothing for the vlan itself
+  auto byPath = deltasByPath(
+      converter.computeDeltas(StateDelta(oldState, newState)));
+  ASSERT_EQ(byPath.size(), 3);
+
+  const auto& changed = byPath.at(arpEntryPath("10.0.0.1"));
+  ASSERT_TRUE(changed.oldState().has_value());
+  ASSERT_TRUE(changed.newState().has_value());
+  auto entry =
+      apache::thrift::BinarySerializer::deserialize<state::NeighborEntryFields>(
+          changed.newState()->toStdString());
+  EXPECT_EQ(*entry.mac(), "02:00:00:00:00:11");
+
+  const auto& removed = byPath.at(arpEntryPath("10.0.0.2"));
+  EXPECT_TRUE(removed.oldState().has_value());
+  EXPECT_FALSE(removed.newState().has_value());
+
+  const auto& added = byPath.at(arpEntryPath("10.0.0.3"));
+  EXPECT_FALSE(added.oldState().has_value());
+  EXPECT_TRUE(added.newState().has_value());
+}
+
+TEST(FsdbStatePathDeltaConverterTest, vlanAttributeDeltas) {
+  FsdbStatePathDeltaConverter converter(kSwitchStatePath);
+  auto oldState = buildState();
+  auto newState = oldState;
+  newState->getVlans()->getVlan(kVlan)->modify(&newState)->setName("vlan2");
+  newState->publish();
+
+  // only the changed leaf, the neighbor tables are left alone
+  auto deltas = converter.computeDeltas(StateDelta(oldState, newState));
+  ASSERT_EQ(deltas.size(), 1);
+  EXPECT_EQ(
+      *deltas[0].path()->raw(),
+      (std::vector<std::string>{
+          "agent", "switchState", "vlanMap", "1", "vlanName"}));
+  EXPECT_TRUE(deltas[0].oldState().has_value());
+  EXPECT_TRUE(deltas[0].newState().has_value());
+}
+
+TEST(FsdbStatePathDeltaConverterTest, addedAndRemovedVlans) {
+  FsdbStatePathDeltaConverter converter(kSwitchStatePath);
+  auto oldState = buildState();
+  auto newState = oldState->clone();
+  auto vlans = std::make_shared<VlanMap>();
+  vlans->addVlan(std::make_shared<Vlan>(VlanID(2), std::string("vlan2")));
+  newState->resetVlans(vlans);
+  newState->publish();
+
+  // whole vlans, neighbors included
+  auto byPath = deltasByPath(
+      converter.computeDeltas(StateDelta(oldState, newState)));
+  ASSERT_EQ(byPath.size(), 2);
+  const auto& removed = byPath.at({"agent", "switchState", "vlanMap", "1"});
+  ASSERT_TRUE(removed.oldState().has_value());
+  EXPECT_FALSE(removed.newState().has_value());
+  auto vlan =
+      apache::thrift::BinarySerializer::deserialize<state::VlanFields>(
+          removed.oldState()->toStdString());
+  EXPECT_EQ(vlan.arpTable()->size(), 2);
+
+  const auto& added = byPath.at({"agent", "switchState", "vlanMap", "2"});
+  EXPECT_FALSE(added.oldState().has_value());
+  EXPECT_TRUE(added.newState().has_value());
+}
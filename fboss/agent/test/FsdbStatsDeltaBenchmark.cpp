@@ -0,0 +1,120 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/agent/FsdbStatsDeltaGenerator.h"
+
+#include <folly/Benchmark.h>
+#include <folly/Conv.h>
+#include <folly/init/Init.h>
+#include <thrift/lib/cpp2/protocol/Serializer.h>
+
+#include <iostream>
+
+/*
+ * Cost of publishing the stats of a 500 port chassis to fsdb, between two
+ * publishes of which a tenth of the ports see traffic: encoding a full
+ * snapshot as done today, versus computing and encoding deltas.
+ */
+
+using namespace facebook::fboss;
+
+namespace {
+
+constexpr auto kNumPorts = 500;
+constexpr auto kActivePortsEvery = 10;
+
+AgentStats buildStats() {
+  AgentStats stats;
+  for (int i = 0; i < kNumPorts; ++i) {
+    HwPortStats portStats;
+    portStats.inBytes_() = i;
+    portStats.outBytes_() = i;
+    portStats.inUnicastPkts_() = i;
+    portStats.outUnicastPkts_() = i;
+    stats.hwPortStats()->emplace(
+        folly::to<std::string>("eth", i / 4 + 1, "/", i % 4 + 1, "/1"),
+        std::move(portStats));
+  }
+  return stats;
+}
+
+// Counters of active ports go up between publishes
+void updateStats(AgentStats& stats) {
+  int i = 0;
+  for (auto& [port, portStats] : *stats.hwPortStats()) {
+    if (i++ % kActivePortsEvery == 0) {
+      *portStats.inBytes_() += 1000;
+      *portStats.outBytes_() += 1000;
+      *portStats.inUnicastPkts_() += 10;
+      *portStats.outUnicastPkts_() += 10;
+    }
+  }
+}
+
+size_t fullSnapshotBytes(const AgentStats& stats) {
+  return apache::thrift::BinarySerializer::serialize<std::string>(stats)
+      .size();
+}
+
+size_t deltaBytes(
+    FsdbStatsDeltaGenerator& generator,
+    const AgentStats& stats) {
+  size_t bytes = 0;
+  for (const auto& unit : generator.computeDeltas(stats)) {
+    bytes += unit.newState().value_or("").size();
+    for (const auto& tok : *unit.path()->raw()) {
+      bytes += tok.size();
+    }
+  }
+  return bytes;
+}
+
+FsdbStatsDeltaGenerator makeGenerator() {
+  // never resync within the benchmark
+  return FsdbStatsDeltaGenerator({"agent"}, std::chrono::hours(24));
+}
+
+} // namespace
+
+BENCHMARK(fullSnapshot, iters) {
+  folly::BenchmarkSuspender suspender;
+  auto stats = buildStats();
+  for (unsigned i = 0; i < iters; ++i) {
+    updateStats(stats);
+    suspender.dismiss();
+    folly::doNotOptimizeAway(fullSnapshotBytes(stats));
+    suspender.rehire();
+  }
+}
+
+BENCHMARK_RELATIVE(deltas, iters) {
+  folly::BenchmarkSuspender suspender;
+  auto stats = buildStats();
+  auto generator = makeGenerator();
+  generator.computeDeltas(stats);
+  for (unsigned i = 0; i < iters; ++i) {
+    updateStats(stats);
+    suspender.dismiss();
+    folly::doNotOptimizeAway(deltaBytes(generator, stats));
+    suspender.rehire();
+  }
+}
+
+int main(int argc, char** argv) {
+  folly::init(&argc, &argv, true);
+  folly::runBenchmarks();
+
+  auto stats = buildStats();
+  auto generator = makeGenerator();
+  generator.computeDeltas(stats);
+  updateStats(stats);
+  std::cout << "Bytes per publish: full snapshot " << fullSnapshotBytes(stats)
+            << ", deltas " << deltaBytes(generator, stats) << std::endl;
+  return 0;
+}
@@ -0,0 +1,99 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/agent/FsdbStatsDeltaGenerator.h"
+
+#include <gtest/gtest.h>
+#include <map>
+#include <thrift/lib/cpp2/protocol/Serializer.h>
+
+using namespace facebook::fboss;
+
+namespace {
+
+const std::vector<std::string> kStatsPath{"agent"};
+
+AgentStats buildStats() {
+  AgentStats stats;
+  HwPortStats portStats;
+  portStats.inBytes_() = 100;
+  portStats.outBytes_() = 200;
+  stats.hwPortStats()->emplace("eth1/1/1", portStats);
+  stats.hwPortStats()->emplace("eth1/2/1", portStats);
+  stats.linkFlaps() = 1;
+  return stats;
+}
+
+// hwPortStats is unordered, so sort deltas by path
+std::map<std::vector<std::string>, fsdb::OperDeltaUnit> deltasByPath(
+    const std::vector<fsdb::OperDeltaUnit>& deltas) {
+  std::map<std::vector<std::string>, fsdb::OperDeltaUnit> byPath;
+  for (const auto& unit : deltas) {
+    byPath.emplace(*unit.path()->raw(), unit);
+  }
+  return byPath;
+}
+
+} // namespace
+
+TEST(FsdbStatsDeltaGeneratorTest, fullSyncThenChangedCounters) {
+  FsdbStatsDeltaGenerator generator(kStatsPath, std::chrono::hours(1));
+  auto stats = buildStats();
+
+  // first publish replaces the whole stats tree
+  auto deltas = generator.computeDeltas(stats);
+  ASSERT_EQ(deltas.size(), 1);
+  EXPECT_EQ(*deltas[0].path()->raw(), kStatsPath);
+  EXPECT_EQ(
+      apache::thrift::BinarySerializer::deserialize<AgentStats>(
+          deltas[0].newState()->toStdString()),
+      stats);
+
+  EXPECT_TRUE(generator.computeDeltas(stats).empty());
+
+  stats.hwPortStats()->at("eth1/2/1").inBytes_() = 300;
+  stats.hwPortStats()->erase("eth1/1/1");
+  stats.hwPortStats()->emplace("eth1/3/1", HwPortStats());
+  stats.linkFlaps() = 2;
+  auto byPath = deltasByPath(generator.computeDeltas(stats));
+  std::vector<std::vector<std::string>> paths;
+  for (const auto& [path, unit] : byPath) {
+    paths.push_back(path);
+  }
+  EXPECT_EQ(
+      paths,
+      (std::vector<std::vector<std::string>>{
+          {"agent", "hwPortStats", "eth1/1/1"},
+          {"agent", "hwPortStats", "eth1/2/1", "inBytes_"},
+          {"agent", "hwPortStats", "eth1/3/1"},
+          {"agent", "linkFlaps"}}));
+  // removals carry the old state, changes only the new one
+  const auto& removed = byPath.begin()->second;
+  EXPECT_TRUE(removed.oldState().has_value());
+  EXPECT_FALSE(removed.newState().has_value());
+  const auto& changed = byPath.rbegin()->second;
+  EXPECT_FALSE(changed.oldState().has_value());
+  EXPECT_TRUE(changed.newState().has_value());
+
+  // resync after reset
+  generator.reset();
+  deltas = generator.computeDeltas(stats);
+  ASSERT_EQ(deltas.size(), 1);
+  EXPECT_EQ(*deltas[0].path()->raw(), kStatsPath);
+}
+
+TEST(FsdbStatsDeltaGeneratorTest, periodicFullSync) {
+  FsdbStatsDeltaGenerator generator(kStatsPath, std::chrono::seconds(0));
+  auto stats = buildStats();
+  generator.computeDeltas(stats);
+  stats.linkFlaps() = 2;
+  auto deltas = generator.computeDeltas(stats);
+  ASSERT_EQ(deltas.size(), 1);
+  EXPECT_EQ(*deltas[0].path()->raw(), kStatsPath);
+}
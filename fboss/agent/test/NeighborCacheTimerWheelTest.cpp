@@ -0,0 +1,237 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/agent/NeighborCacheTimerWheel.h"
+
+#include <folly/Random.h>
+#include <folly/io/async/EventBase.h>
+#include <folly/logging/xlog.h>
+#include <gtest/gtest.h>
+#include <sys/resource.h>
+#include <memory>
+#include <vector>
+
+using namespace facebook::fboss;
+using namespace std::chrono;
+
+namespace {
+
+constexpr auto kTick = milliseconds(10);
+
+class TestClient : public NeighborCacheTimerWheel::Client {
+ public:
+  using Client::Client;
+
+  int batches{0};
+  int lastBatchSize{0};
+  int expiredSinceBatch{0};
+
+ private:
+  void timeoutsExpired() noexcept override {
+    ++batches;
+    lastBatchSize = expiredSinceBatch;
+    expiredSinceBatch = 0;
+  }
+};
+
+class TestTimer : public NeighborCacheTimerWheel::Callback {
+ public:
+  TestTimer(NeighborCacheTimerWheel* wheel, TestClient* client)
+      : Callback(wheel, client), client_(client) {}
+
+  void schedule(milliseconds timeout) {
+    scheduledAt = steady_clock::now();
+    scheduleTimeout(timeout);
+  }
+
+  steady_clock::time_point scheduledAt;
+  steady_clock::time_point firedAt;
+  int fired{0};
+
+ private:
+  void timeoutExpired() noexcept override {
+    firedAt = steady_clock::now();
+    ++fired;
+    ++client_->expiredSinceBatch;
+  }
+
+  TestClient* client_;
+};
+
+microseconds cpuTime() {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return seconds(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+      microseconds(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+}
+
+} // namespace
+
+TEST(NeighborCacheTimerWheelTest, timersNeverFireEarly) {
+  folly::EventBase evb;
+  NeighborCacheTimerWheel wheel(&evb, kTick);
+  TestClient client(&wheel);
+
+  // Spanning the lowest two levels of the wheel with 1ms ticks
+  NeighborCacheTimerWheel fineWheel(&evb, milliseconds(1));
+  TestClient fineClient(&fineWheel);
+
+  std::vector<std::pair<std::unique_ptr<TestTimer>, milliseconds>> timers;
+  for (auto timeout : {0, 1, 9, 10, 11, 25, 100, 300, 1000}) {
+    timers.emplace_back(
+        std::make_unique<TestTimer>(&wheel, &client), milliseconds(timeout));
+    timers.emplace_back(
+        std::make_unique<TestTimer>(&fineWheel, &fineClient),
+        milliseconds(timeout));
+  }
+  for (auto& [timer, timeout] : timers) {
+    timer->schedule(timeout);
+  }
+  EXPECT_EQ(wheel.numScheduled(), timers.size() / 2);
+  evb.loop();
+
+  EXPECT_EQ(wheel.numScheduled(), 0);
+  EXPECT_EQ(fineWheel.numScheduled(), 0);
+  for (auto& [timer, timeout] : timers) {
+    EXPECT_EQ(timer->fired, 1);
+    EXPECT_GE(timer->firedAt - timer->scheduledAt, timeout);
+  }
+}
+
+TEST(NeighborCacheTimerWheelTest, rescheduleAndCancel) {
+  folly::EventBase evb;
+  NeighborCacheTimerWheel wheel(&evb, kTick);
+  TestClient client(&wheel);
+  TestTimer rescheduled(&wheel, &client);
+  TestTimer cancelled(&wheel, &client);
+  auto destroyed = std::make_unique<TestTimer>(&wheel, &client);
+
+  rescheduled.schedule(milliseconds(20));
+  rescheduled.schedule(milliseconds(200));
+  cancelled.schedule(milliseconds(20));
+  cancelled.cancelTimeout();
+  destroyed->schedule(milliseconds(20));
+  destroyed.reset();
+  EXPECT_EQ(wheel.numScheduled(), 1);
+  EXPECT_TRUE(rescheduled.isScheduled());
+  EXPECT_FALSE(cancelled.isScheduled());
+  evb.loop();
+
+  EXPECT_EQ(rescheduled.fired, 1);
+  EXPECT_GE(rescheduled.firedAt - rescheduled.scheduledAt, milliseconds(200));
+  EXPECT_EQ(cancelled.fired, 0);
+}
+
+TEST(NeighborCacheTimerWheelTest, clientsGetOneCallPerTick) {
+  folly::EventBase evb;
+  NeighborCacheTimerWheel wheel(&evb, seconds(1));
+  std::vector<std::unique_ptr<TestClient>> clients;
+  std::vector<std::unique_ptr<TestTimer>> timers;
+  for (int i = 0; i < 3; ++i) {
+    clients.push_back(std::make_unique<TestClient>(&wheel));
+    for (int j = 0; j < 10; ++j) {
+      timers.push_back(
+          std::make_unique<TestTimer>(&wheel, clients.back().get()));
+    }
+  }
+
+  // With 1s ticks, all timers expire on the next one
+  for (auto& timer : timers) {
+    timer->schedule(milliseconds(0));
+  }
+  evb.loop();
+
+  for (auto& client : clients) {
+    EXPECT_EQ(client->batches, 1);
+    EXPECT_EQ(client->lastBatchSize, 10);
+  }
+}
+
+TEST(NeighborCacheTimerWheelTest, probesArePacedPerInterface) {
+  folly::EventBase evb;
+  NeighborCacheTimerWheel wheel(&evb, kTick, 10);
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(wheel.consumeProbeToken(InterfaceID(1)));
+  }
+  EXPECT_FALSE(wheel.consumeProbeToken(InterfaceID(1)));
+  EXPECT_TRUE(wheel.consumeProbeToken(InterfaceID(2)));
+
+  NeighborCacheTimerWheel unpaced(&evb, kTick);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_TRUE(unpaced.consumeProbeToken(InterfaceID(1)));
+  }
+}
+
+/*
+ * 100k entries spread over 100 vlans, going stale over 0.5 to 1.5s as
+ * REACHABLE entries with a 1s base timeout do. Compares the cpu time and
+ * number of updates, i.e. state updates neighbor caches issue, against
+ * one AsyncTimeout per entry.
+ */
+TEST(NeighborCacheTimerWheelTest, scale) {
+  constexpr int kEntries = 100000;
+  constexpr int kClients = 100;
+  std::vector<milliseconds> timeouts;
+  for (int i = 0; i < kEntries; ++i) {
+    timeouts.emplace_back(500 + folly::Random::rand32(1000));
+  }
+
+  folly::EventBase evb;
+  NeighborCacheTimerWheel wheel(&evb, kTick);
+  std::vector<std::unique_ptr<TestClient>> clients;
+  std::vector<std::unique_ptr<TestTimer>> timers;
+  for (int i = 0; i < kClients; ++i) {
+    clients.push_back(std::make_unique<TestClient>(&wheel));
+  }
+  for (int i = 0; i < kEntries; ++i) {
+    timers.push_back(
+        std::make_unique<TestTimer>(&wheel, clients[i % kClients].get()));
+  }
+
+  auto wheelStart = cpuTime();
+  for (int i = 0; i < kEntries; ++i) {
+    timers[i]->schedule(timeouts[i]);
+  }
+  evb.loop();
+  auto wheelCpu = cpuTime() - wheelStart;
+
+  int fired{0};
+  for (auto& timer : timers) {
+    fired += timer->fired;
+  }
+  int wheelUpdates{0};
+  for (auto& client : clients) {
+    wheelUpdates += client->batches;
+  }
+  EXPECT_EQ(fired, kEntries);
+  // At most one update per client per tick, over the second timers expire
+  // in plus the time it took to schedule them
+  EXPECT_LE(wheelUpdates, kClients * (seconds(2) / kTick));
+
+  std::vector<std::unique_ptr<folly::AsyncTimeout>> asyncTimeouts;
+  int asyncUpdates{0};
+  for (int i = 0; i < kEntries; ++i) {
+    asyncTimeouts.push_back(
+        folly::AsyncTimeout::make(evb, [&]() noexcept { ++asyncUpdates; }));
+  }
+  auto asyncStart = cpuTime();
+  for (int i = 0; i < kEntries; ++i) {
+    asyncTimeouts[i]->scheduleTimeout(timeouts[i]);
+  }
+  evb.loop();
+  auto asyncCpu = cpuTime() - asyncStart;
+  EXPECT_EQ(asyncUpdates, kEntries);
+
+  XLOG(INFO) << "Timer wheel: "
+             << duration_cast<milliseconds>(wheelCpu).count() << "ms cpu, "
+             << wheelUpdates << " updates";
+  XLOG(INFO) << "AsyncTimeout per entry: "
+             << duration_cast<milliseconds>(asyncCpu).count() << "ms cpu, "
+             << asyncUpdates << " updates";
+}
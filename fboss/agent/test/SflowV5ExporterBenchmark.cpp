@@ -0,0 +1,116 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/agent/hw/SflowV5Exporter.h"
+
+#include <folly/Benchmark.h>
+#include <folly/init/Init.h>
+#include <thrift/lib/cpp2/protocol/Serializer.h>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+/*
+ * Cost of exporting sFlow samples to two collectors: one thrift serialized
+ * SflowPacketInfo per datagram and collector, as done by default, versus
+ * batching samples into sFlow v5 datagrams. Collectors are local UDP
+ * sockets that are never read, so the kernel drops what overflows them.
+ */
+
+using namespace facebook::fboss;
+
+namespace {
+
+constexpr auto kNumCollectors = 2;
+
+struct Sink {
+  Sink() {
+    fd = socket(AF_INET, SOCK_DGRAM, 0);
+    folly::SocketAddress bindAddr("127.0.0.1", 0);
+    sockaddr_storage storage;
+    auto len = bindAddr.getAddress(&storage);
+    bind(fd, reinterpret_cast<sockaddr*>(&storage), len);
+    address.setFromLocalAddress(folly::NetworkSocket::fromFd(fd));
+  }
+  ~Sink() {
+    close(fd);
+  }
+  int fd;
+  folly::SocketAddress address;
+};
+
+SflowPacketInfo makePacket(int i) {
+  SflowPacketInfo info;
+  *info.ingressSampled() = true;
+  info.srcPort() = i % 64;
+  info.vlan() = 1;
+  info.frameLength() = 1500;
+  info.packetData() = std::string(128, 'a');
+  return info;
+}
+
+} // namespace
+
+BENCHMARK(thriftPerSample, iters) {
+  folly::BenchmarkSuspender suspender;
+  std::vector<std::unique_ptr<Sink>> sinks;
+  std::vector<sockaddr_storage> addrs(kNumCollectors);
+  std::vector<socklen_t> addrLens(kNumCollectors);
+  for (int i = 0; i < kNumCollectors; ++i) {
+    sinks.push_back(std::make_unique<Sink>());
+    addrLens[i] = sinks.back()->address.getAddress(&addrs[i]);
+  }
+  auto fd = socket(AF_INET, SOCK_DGRAM, 0);
+  auto info = makePacket(0);
+  suspender.dismiss();
+
+  for (unsigned i = 0; i < iters; ++i) {
+    info.srcPort() = i % 64;
+    std::string output;
+    apache::thrift::BinarySerializer::serialize(info, &output);
+    for (int c = 0; c < kNumCollectors; ++c) {
+      sendto(
+          fd,
+          output.data(),
+          output.size(),
+          MSG_DONTWAIT,
+          reinterpret_cast<sockaddr*>(&addrs[c]),
+          addrLens[c]);
+    }
+  }
+
+  suspender.rehire();
+  close(fd);
+}
+
+BENCHMARK_RELATIVE(sflowV5Batched, iters) {
+  folly::BenchmarkSuspender suspender;
+  std::vector<std::unique_ptr<Sink>> sinks;
+  SflowV5Exporter exporter(1400, std::chrono::milliseconds(100));
+  exporter.setAgentAddress(folly::IPAddress("2401:db00::1"));
+  for (int i = 0; i < kNumCollectors; ++i) {
+    sinks.push_back(std::make_unique<Sink>());
+    exporter.addCollector(std::to_string(i), sinks.back()->address);
+  }
+  auto info = makePacket(0);
+  suspender.dismiss();
+
+  for (unsigned i = 0; i < iters; ++i) {
+    info.srcPort() = i % 64;
+    exporter.addFlowSample(info, 4096);
+  }
+  exporter.flush();
+  suspender.rehire();
+}
+
+int main(int argc, char** argv) {
+  folly::init(&argc, &argv, true);
+  folly::runBenchmarks();
+  return 0;
+}
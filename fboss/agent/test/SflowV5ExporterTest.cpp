@@ -0,0 +1,207 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/agent/hw/SflowV5Exporter.h"
+#include "fboss/agent/hw/gen-cpp2/hardware_stats_constants.h"
+
+#include <folly/Bits.h>
+#include <folly/ScopeGuard.h>
+#include <gtest/gtest.h>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <cstring>
+
+using namespace facebook::fboss;
+
+namespace {
+
+constexpr size_t kMaxDatagramSize = 1400;
+// Header with an IPv4 agent address
+constexpr size_t kV4HeaderSize = 28;
+// Flow sample with a 64 byte packet header record
+constexpr size_t kFlowSampleSize = 8 + 32 + 24 + 64;
+
+uint32_t getU32(const std::string& datagram, size_t offset) {
+  uint32_t value;
+  std::memcpy(&value, datagram.data() + offset, sizeof(value));
+  return folly::Endian::big(value);
+}
+
+SflowPacketInfo makePacket(int16_t srcPort) {
+  SflowPacketInfo info;
+  *info.ingressSampled() = true;
+  info.srcPort() = srcPort;
+  info.frameLength() = 1500;
+  info.packetData() = std::string(64, 'a');
+  return info;
+}
+
+std::unique_ptr<SflowV5Exporter> makeExporter(
+    std::chrono::milliseconds flushInterval = std::chrono::hours(1)) {
+  auto exporter =
+      std::make_unique<SflowV5Exporter>(kMaxDatagramSize, flushInterval);
+  exporter->setAgentAddress(folly::IPAddress("10.0.0.1"));
+  return exporter;
+}
+
+} // namespace
+
+TEST(SflowV5ExporterTest, flowSampleEncoding) {
+  auto exporter = makeExporter();
+  exporter->addFlowSample(makePacket(5), 1000);
+  exporter->addFlowSample(makePacket(5), 1000);
+
+  auto datagrams = exporter->getPendingDatagrams();
+  ASSERT_EQ(datagrams.size(), 1);
+  const auto& datagram = datagrams[0];
+  ASSERT_EQ(datagram.size(), kV4HeaderSize + 2 * kFlowSampleSize);
+  // version, IPv4 agent address, sub agent, sequence, uptime, samples
+  EXPECT_EQ(getU32(datagram, 0), 5);
+  EXPECT_EQ(getU32(datagram, 4), 1);
+  EXPECT_EQ(getU32(datagram, 8), 0x0a000001);
+  EXPECT_EQ(getU32(datagram, 16), 1);
+  EXPECT_EQ(getU32(datagram, 24), 2);
+
+  // second sample: format, length, sequence, source, rate, pool
+  auto sample = kV4HeaderSize + kFlowSampleSize;
+  EXPECT_EQ(getU32(datagram, sample), 1);
+  EXPECT_EQ(getU32(datagram, sample + 4), kFlowSampleSize - 8);
+  EXPECT_EQ(getU32(datagram, sample + 8), 2);
+  EXPECT_EQ(getU32(datagram, sample + 12), 5);
+  EXPECT_EQ(getU32(datagram, sample + 16), 1000);
+  EXPECT_EQ(getU32(datagram, sample + 20), 2000);
+  // raw packet header record: frame length and header length
+  auto record = sample + 40;
+  EXPECT_EQ(getU32(datagram, record), 1);
+  EXPECT_EQ(getU32(datagram, record + 12), 1500);
+  EXPECT_EQ(getU32(datagram, record + 20), 64);
+  EXPECT_EQ(datagram.substr(record + 24), std::string(64, 'a'));
+}
+
+TEST(SflowV5ExporterTest, counterSampleEncoding) {
+  auto exporter = makeExporter();
+  HwPortStats stats;
+  stats.inBytes_() = 1000;
+  stats.outBytes_() = hardware_stats_constants::STAT_UNINITIALIZED();
+  exporter->addCounterSample(PortID(7), stats, 100000000000, true);
+
+  auto datagrams = exporter->getPendingDatagrams();
+  ASSERT_EQ(datagrams.size(), 1);
+  const auto& datagram = datagrams[0];
+  ASSERT_EQ(datagram.size(), kV4HeaderSize + 8 + 12 + 8 + 88);
+  auto sample = kV4HeaderSize;
+  EXPECT_EQ(getU32(datagram, sample), 2);
+  EXPECT_EQ(getU32(datagram, sample + 12), 7);
+  // generic interface counters: ifIndex, ifType, ifSpeed, ifStatus and
+  // ifInOctets
+  auto record = sample + 20;
+  EXPECT_EQ(getU32(datagram, record), 1);
+  EXPECT_EQ(getU32(datagram, record + 4), 88);
+  EXPECT_EQ(getU32(datagram, record + 8), 7);
+  EXPECT_EQ(getU32(datagram, record + 12), 6);
+  EXPECT_EQ(getU32(datagram, record + 16), 0x17);
+  EXPECT_EQ(getU32(datagram, record + 20), 0x4876e800);
+  EXPECT_EQ(getU32(datagram, record + 28), 3);
+  EXPECT_EQ(getU32(datagram, record + 32), 0);
+  EXPECT_EQ(getU32(datagram, record + 36), 1000);
+  // unknown ifOutOctets
+  EXPECT_EQ(getU32(datagram, record + 64), 0xffffffff);
+  EXPECT_EQ(getU32(datagram, record + 68), 0xffffffff);
+}
+
+TEST(SflowV5ExporterTest, samplesPackedUpToMaxDatagramSize) {
+  auto exporter = makeExporter();
+  auto perDatagram = (kMaxDatagramSize - kV4HeaderSize) / kFlowSampleSize;
+  for (size_t i = 0; i < perDatagram + 1; ++i) {
+    exporter->addFlowSample(makePacket(1), 1000);
+  }
+  auto datagrams = exporter->getPendingDatagrams();
+  ASSERT_EQ(datagrams.size(), 2);
+  EXPECT_LE(datagrams[0].size(), kMaxDatagramSize);
+  EXPECT_EQ(getU32(datagrams[0], 24), perDatagram);
+  EXPECT_EQ(getU32(datagrams[1], 24), 1);
+  // datagram sequence numbers go up
+  EXPECT_EQ(getU32(datagrams[1], 16), getU32(datagrams[0], 16) + 1);
+}
+
+TEST(SflowV5ExporterTest, flushSendsToCollectors) {
+  auto receiver = socket(AF_INET, SOCK_DGRAM, 0);
+  ASSERT_NE(receiver, -1);
+  SCOPE_EXIT {
+    close(receiver);
+  };
+  timeval timeout{5, 0};
+  setsockopt(receiver, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  folly::SocketAddress bindAddr("127.0.0.1", 0);
+  sockaddr_storage storage;
+  auto len = bindAddr.getAddress(&storage);
+  ASSERT_EQ(bind(receiver, reinterpret_cast<sockaddr*>(&storage), len), 0);
+  folly::SocketAddress receiverAddr;
+  receiverAddr.setFromLocalAddress(folly::NetworkSocket::fromFd(receiver));
+
+  auto exporter = makeExporter();
+  exporter->addCollector("collector", receiverAddr);
+  EXPECT_TRUE(exporter->hasCollector("collector"));
+  for (int i = 0; i < 3; ++i) {
+    exporter->addFlowSample(makePacket(1), 1000);
+  }
+  // nothing is due for an hour
+  exporter->flushIfDue();
+  EXPECT_EQ(exporter->getDatagramsSent(), 0);
+
+  exporter->flush();
+  EXPECT_EQ(exporter->getDatagramsSent(), 1);
+  EXPECT_EQ(exporter->getSamplesSent(), 3);
+  EXPECT_TRUE(exporter->getPendingDatagrams().empty());
+
+  std::string buf(kMaxDatagramSize, '\0');
+  auto received = recv(receiver, buf.data(), buf.size(), 0);
+  ASSERT_EQ(received, kV4HeaderSize + 3 * kFlowSampleSize);
+  EXPECT_EQ(getU32(buf, 0), 5);
+  EXPECT_EQ(getU32(buf, 24), 3);
+
+  // samples added past the flush interval go out right away
+  auto eager = makeExporter(std::chrono::milliseconds(0));
+  eager->addCollector("collector", receiverAddr);
+  eager->addFlowSample(makePacket(1), 1000);
+  EXPECT_EQ(eager->getDatagramsSent(), 1);
+  received = recv(receiver, buf.data(), buf.size(), 0);
+  EXPECT_EQ(received, kV4HeaderSize + kFlowSampleSize);
+
+  exporter->removeCollector("collector");
+  EXPECT_EQ(exporter->numCollectors(), 0);
+}
+
+TEST(SflowV5ExporterTest, heldBackSamplesFlushedWithoutNewSamples) {
+  auto receiver = socket(AF_INET, SOCK_DGRAM, 0);
+  ASSERT_NE(receiver, -1);
+  SCOPE_EXIT {
+    close(receiver);
+  };
+  timeval timeout{5, 0};
+  setsockopt(receiver, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  folly::SocketAddress bindAddr("127.0.0.1", 0);
+  sockaddr_storage storage;
+  auto len = bindAddr.getAddress(&storage);
+  ASSERT_EQ(bind(receiver, reinterpret_cast<sockaddr*>(&storage), len), 0);
+  folly::SocketAddress receiverAddr;
+  receiverAddr.setFromLocalAddress(folly::NetworkSocket::fromFd(receiver));
+
+  auto exporter = makeExporter(std::chrono::milliseconds(10));
+  exporter->addCollector("collector", receiverAddr);
+  exporter->addFlowSample(makePacket(1), 1000);
+
+  // no flush, nor any other sample, to send it out
+  std::string buf(kMaxDatagramSize, '\0');
+  auto received = recv(receiver, buf.data(), buf.size(), 0);
+  EXPECT_EQ(received, kV4HeaderSize + kFlowSampleSize);
+}
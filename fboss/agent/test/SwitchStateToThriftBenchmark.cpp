@@ -0,0 +1,126 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/agent/state/ArpTable.h"
+#include "fboss/agent/state/ForwardingInformationBaseContainer.h"
+#include "fboss/agent/state/NdpTable.h"
+#include "fboss/agent/state/PortDescriptor.h"
+#include "fboss/agent/state/Route.h"
+#include "fboss/agent/state/SwitchState.h"
+#include "fboss/agent/state/Vlan.h"
+
+#include <folly/Benchmark.h>
+#include <folly/Format.h>
+#include <folly/executors/CPUThreadPoolExecutor.h>
+#include <folly/init/Init.h>
+
+/*
+ * Cost of converting a large switch state to thrift, as done for warmboot
+ * and fsdb full syncs, on the calling thread versus on a worker pool.
+ * The state has 200k routes, split across two VRFs, and 50k neighbors.
+ */
+
+using namespace facebook::fboss;
+using folly::IPAddressV4;
+using folly::IPAddressV6;
+
+namespace {
+
+constexpr uint32_t kNumVrfs = 2;
+constexpr uint32_t kNumV4RoutesPerVrf = 75000;
+constexpr uint32_t kNumV6RoutesPerVrf = 25000;
+constexpr uint32_t kNumVlans = 10;
+constexpr uint32_t kNumNeighborsPerVlan = 5000;
+
+std::shared_ptr<ForwardingInformationBaseContainer> makeFibContainer(
+    RouterID vrf) {
+  auto fibV4 = std::make_shared<ForwardingInformationBaseV4>();
+  for (uint32_t i = 0; i < kNumV4RoutesPerVrf; ++i) {
+    RoutePrefixV4 prefix(IPAddressV4::fromLongHBO(0x0a000000 + (i << 8)), 24);
+    fibV4->addNode(std::make_shared<RouteV4>(RouteFields<IPAddressV4>(prefix)));
+  }
+  auto fibV6 = std::make_shared<ForwardingInformationBaseV6>();
+  for (uint32_t i = 0; i < kNumV6RoutesPerVrf; ++i) {
+    RoutePrefixV6 prefix(
+        IPAddressV6(folly::sformat("2401:db00:{:x}::", i)), 64);
+    fibV6->addNode(std::make_shared<RouteV6>(RouteFields<IPAddressV6>(prefix)));
+  }
+  auto container = std::make_shared<ForwardingInformationBaseContainer>(vrf);
+  container->setFib(fibV4);
+  container->setFib(fibV6);
+  return container;
+}
+
+std::shared_ptr<Vlan> makeVlan(uint32_t id) {
+  auto vlan = std::make_shared<Vlan>(VlanID(id), folly::to<std::string>(id));
+  auto arpTable = std::make_shared<ArpTable>();
+  auto ndpTable = std::make_shared<NdpTable>();
+  // half the neighbors are v4, half v6
+  for (uint32_t i = 0; i < kNumNeighborsPerVlan / 2; ++i) {
+    auto mac = folly::MacAddress::fromHBO(0x020000000000 + (id << 16) + i);
+    arpTable->addEntry(
+        IPAddressV4::fromLongHBO(0x64000000 + (id << 16) + i),
+        mac,
+        PortDescriptor(PortID(id)),
+        InterfaceID(id));
+    ndpTable->addEntry(
+        IPAddressV6(folly::sformat("2401:db00:ffff:{:x}::{:x}", id, i)),
+        mac,
+        PortDescriptor(PortID(id)),
+        InterfaceID(id));
+  }
+  vlan->setArpTable(arpTable);
+  vlan->setNdpTable(ndpTable);
+  return vlan;
+}
+
+std::shared_ptr<SwitchState> makeState() {
+  auto state = std::make_shared<SwitchState>();
+  auto fibs = std::make_shared<ForwardingInformationBaseMap>();
+  for (uint32_t vrf = 0; vrf < kNumVrfs; ++vrf) {
+    fibs->addNode(makeFibContainer(RouterID(vrf)));
+  }
+  state->resetForwardingInformationBases(fibs);
+  for (uint32_t vlan = 1; vlan <= kNumVlans; ++vlan) {
+    state->addVlan(makeVlan(vlan));
+  }
+  return state;
+}
+
+const std::shared_ptr<SwitchState>& getState() {
+  static const auto state = makeState();
+  return state;
+}
+
+void stateToThrift(unsigned iters, int numThreads) {
+  folly::BenchmarkSuspender suspender;
+  const auto& state = getState();
+  std::unique_ptr<folly::CPUThreadPoolExecutor> executor;
+  if (numThreads > 0) {
+    executor = std::make_unique<folly::CPUThreadPoolExecutor>(numThreads);
+  }
+  suspender.dismiss();
+  for (unsigned i = 0; i < iters; ++i) {
+    folly::doNotOptimizeAway(state->toThrift(executor.get()));
+  }
+}
+
+} // namespace
+
+BENCHMARK_PARAM(stateToThrift, 0);
+BENCHMARK_RELATIVE_PARAM(stateToThrift, 2);
+BENCHMARK_RELATIVE_PARAM(stateToThrift, 4);
+BENCHMARK_RELATIVE_PARAM(stateToThrift, 8);
+
+int main(int argc, char** argv) {
+  folly::init(&argc, &argv, true);
+  folly::runBenchmarks();
+  return 0;
+}
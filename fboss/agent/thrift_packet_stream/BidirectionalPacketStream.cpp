@@ -273,6 +273,29 @@ ssize_t BidirectionalPacketStream::send(TPacket&& packet) {
   return sz;
 }
 
+ssize_t BidirectionalPacketStream::send(
+    const std::string& l2Port,
+    const folly::IOBuf& buf) {
+  if (!clientConnected_.load()) {
+    STATS_err_send_client_not_connected.add(1);
+    XLOG(ERR) << "client not yet connected";
+    return -1;
+  }
+  try {
+    if (!PacketStreamService::broadcast(l2Port, buf)) {
+      XLOG(ERR) << "Port '" << l2Port << "' not Registered";
+      STATS_err_send_pkt_failed.add(1);
+      return -1;
+    }
+  } catch (const std::exception& ex) {
+    XLOG(ERR) << "send packet failed:" << ex.what();
+    STATS_err_send_pkt_failed.add(1);
+    return -1;
+  }
+  STATS_pkt_send_success.add(1);
+  return buf.computeChainDataLength();
+}
+
 // server calls. Right now supports one birectional connection so we don't
 // care about the client id.
 void BidirectionalPacketStream::clientConnected(const std::string& clientId) {
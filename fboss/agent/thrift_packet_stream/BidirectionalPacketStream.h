@@ -42,6 +42,9 @@ class BidirectionalPacketStream
   std::shared_ptr<AsyncPacketTransport> listen(const std::string& port);
   void close(const std::string& port);
   ssize_t send(TPacket&& packet);
+  // Send a packet received on l2Port to the client, if it registered the
+  // port. The TPacket is only built then, see PacketStreamService::broadcast
+  ssize_t send(const std::string& l2Port, const folly::IOBuf& buf);
 
   void setPacketAcceptor(BidirectionalPacketAcceptor* acceptor) {
     acceptor_.store(acceptor);
@@ -81,7 +81,39 @@ void PacketStreamService::send(const std::string& clientId, TPacket&& packet) {
       throw createTPacketException(
           TPacketErrorCode::PORT_NOT_REGISTERED, "PORT not registered");
     }
-    clientInfo.publisher_->next(packet);
+    clientInfo.publisher_->next(std::move(packet));
+    copiesSaved_.fetch_add(1, std::memory_order_relaxed);
+  });
+}
+
+size_t PacketStreamService::broadcast(
+    const std::string& l2Port,
+    const folly::IOBuf& buf) {
+  return clientMap_.withRLock([&](auto& lockedMap) {
+    std::vector<apache::thrift::ServerStreamPublisher<TPacket>*> publishers;
+    for (const auto& iter : lockedMap) {
+      const auto& clientInfo = iter.second;
+      if (clientInfo.publisher_ &&
+          clientInfo.portList_.find(l2Port) != clientInfo.portList_.end()) {
+        publishers.push_back(clientInfo.publisher_.get());
+      }
+    }
+    if (publishers.empty()) {
+      return publishers.size();
+    }
+    TPacket packet;
+    packet.timestamp() = time(nullptr);
+    packet.l2Port() = l2Port;
+    packet.buf() = buf.to<std::string>();
+    // The streams take the TPacket by value, so all but the last client
+    // get a full copy of it, buf included. The last one gets it moved
+    for (size_t i = 0; i + 1 < publishers.size(); ++i) {
+      publishers[i]->next(packet);
+    }
+    publishers.back()->next(std::move(packet));
+    // 1 build + (N - 1) copies instead of N builds + N copies
+    copiesSaved_.fetch_add(publishers.size(), std::memory_order_relaxed);
+    return publishers.size();
   });
 }
 
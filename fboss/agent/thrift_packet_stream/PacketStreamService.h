@@ -4,6 +4,9 @@
 
 #include <common/fb303/cpp/FacebookBase2.h>
 #include <fboss/agent/if/gen-cpp2/PacketStream.tcc>
+#include <folly/io/IOBuf.h>
+
+#include <atomic>
 namespace facebook {
 namespace fboss {
 class PacketStreamService : virtual public PacketStreamSvIf,
@@ -15,6 +18,18 @@ class PacketStreamService : virtual public PacketStreamSvIf,
 
   // helper functions.
   void send(const std::string& clientId, TPacket&& packet);
+  // Send buf to every client that registered l2Port. The TPacket is only
+  // built when some client wants the packet, and once for all of them.
+  // Returns the number of clients the packet was sent to.
+  size_t broadcast(const std::string& l2Port, const folly::IOBuf& buf);
+  // Payload copies avoided, against a baseline where every client gets a
+  // TPacket built from the packet, which the stream then copies: two copies
+  // per client. send() moves the TPacket in, saving one. broadcast() to N
+  // clients builds one TPacket, copies it into N - 1 streams and moves it
+  // into the last: N copies, saving N.
+  uint64_t getCopiesSaved() const {
+    return copiesSaved_.load(std::memory_order_relaxed);
+  }
   bool isClientConnected(const std::string& clientId);
   bool isPortRegistered(const std::string& clientId, const std::string& port);
 
@@ -55,6 +70,7 @@ class PacketStreamService : virtual public PacketStreamSvIf,
   };
   using ClientMap = std::unordered_map<std::string, ClientInfo>;
   folly::Synchronized<ClientMap> clientMap_;
+  std::atomic<uint64_t> copiesSaved_{0};
 };
 
 } // namespace fboss
@@ -261,6 +261,26 @@ TEST_F(PacketStreamTest, PacketSendMultiPort) {
   // clientReset(std::move(streamClient));
 }
 
+TEST_F(PacketStreamTest, PacketBroadcast) {
+  std::string port(*g_ports.begin());
+  auto baton = std::make_shared<folly::Baton<>>();
+  auto streamClient = std::make_unique<DerivedPacketStreamClient>(
+      g_client, clientThread_.getEventBase(), baton);
+  tryConnect(baton, *streamClient);
+  auto buf = folly::IOBuf::copyBuffer(g_pktCnt);
+  // no client registered the port yet
+  EXPECT_EQ(handler_->broadcast(port, *buf), 0);
+
+  EXPECT_NO_THROW(streamClient->registerPortToServer(port));
+  auto copiesSaved = handler_->getCopiesSaved();
+  baton->reset();
+  EXPECT_EQ(handler_->broadcast(port, *buf), 1);
+  EXPECT_TRUE(baton->try_wait_for(std::chrono::milliseconds(50)));
+  EXPECT_EQ(streamClient->getPckCnt(port), 1);
+  EXPECT_EQ(handler_->getCopiesSaved(), copiesSaved + 1);
+  clientReset(std::move(streamClient));
+}
+
 TEST_F(PacketStreamTest, PacketSendMultiPortPauseSend) {
   auto baton = std::make_shared<folly::Baton<>>();
   auto streamClient = std::make_unique<DerivedPacketStreamClient>(
@@ -56,6 +56,19 @@ void CmdGlobalOptions::init(CLI::App& app) {
       "--aggregate-hosts",
       aggregateAcrossDevices_,
       "whether to perform aggregation across all hosts or not");
+  app.add_option(
+         "--max-parallel-hosts",
+         maxParallelHosts_,
+         "Maximum number of hosts to query in parallel")
+      ->check(CLI::PositiveNumber);
+  app.add_flag(
+      "--progress",
+      progress_,
+      "Print progress to stderr as each host is done being queried");
+  app.add_flag(
+      "--timing",
+      timing_,
+      "Print a summary of the query latency of the hosts to stderr");
 
   initAdditional(app);
 }
@@ -437,6 +437,18 @@ class CmdGlobalOptions {
     return color_;
   }
 
+  int getMaxParallelHosts() const {
+    return maxParallelHosts_;
+  }
+
+  bool printProgress() const {
+    return progress_;
+  }
+
+  bool printTiming() const {
+    return timing_;
+  }
+
   // Setters for testing purposes
   void setSslPolicy(SSLPolicy& sslPolicy) {
     sslPolicy_ = sslPolicy;
@@ -482,6 +494,10 @@ class CmdGlobalOptions {
     aggregateAcrossDevices_ = acrossDevices;
   }
 
+  void setMaxParallelHosts(int maxParallelHosts) {
+    maxParallelHosts_ = maxParallelHosts;
+  }
+
   UnionList getFilters(cli::CliOptionResult& filterParsingEC) const;
   std::optional<AggregateOption> parseAggregate(
       cli::CliOptionResult& aggregateParsingEC) const;
@@ -514,6 +530,9 @@ class CmdGlobalOptions {
   std::string filter_;
   std::string aggregate_;
   bool aggregateAcrossDevices_{false};
+  int maxParallelHosts_{64};
+  bool progress_{false};
+  bool timing_{false};
 };
 
 } // namespace facebook::fboss
@@ -57,6 +57,7 @@
 #include "fboss/cli/fboss2/commands/show/transceiver/CmdShowTransceiver.h"
 #include "fboss/cli/fboss2/utils/CmdClientUtils.h"
 #include "fboss/cli/fboss2/utils/CmdUtils.h"
+#include "fboss/cli/fboss2/utils/HostQueryExecutor.h"
 #include "fboss/fsdb/if/gen-cpp2/fsdb_oper_types.h"
 #include "folly/futures/Future.h"
 #include "thrift/lib/cpp2/protocol/Serializer.h"
@@ -64,7 +65,6 @@
 #include <folly/Singleton.h>
 #include <folly/logging/xlog.h>
 #include <cstring>
-#include <future>
 #include <iostream>
 #include <stdexcept>
 
@@ -102,36 +102,33 @@
 template <typename CmdTypeT>
 void printTabular(
     CmdTypeT& cmd,
-    std::vector<std::shared_future<
-        std::tuple<std::string, typename CmdTypeT::RetType, std::string>>>&
-        results,
+    const std::tuple<std::string, typename CmdTypeT::RetType, std::string>&
+        result,
+    bool printHost,
     std::ostream& out,
     std::ostream& err) {
-  for (auto& result : results) {
-    auto [host, data, errStr] = result.get();
-    if (results.size() != 1) {
-      out << host << "::" << std::endl << std::string(80, '=') << std::endl;
-    }
+  const auto& [host, data, errStr] = result;
+  if (printHost) {
+    out << host << "::" << std::endl << std::string(80, '=') << std::endl;
+  }
 
-    if (errStr.empty()) {
-      cmd.printOutput(data);
-    } else {
-      err << errStr << std::endl << std::endl;
-    }
+  if (errStr.empty()) {
+    cmd.printOutput(data);
+  } else {
+    err << errStr << std::endl << std::endl;
   }
 }
 
 template <typename CmdTypeT>
 void printJson(
     const CmdTypeT& /* cmd */,
-    std::vector<std::shared_future<
-        std::tuple<std::string, typename CmdTypeT::RetType, std::string>>>&
+    const std::vector<
+        std::tuple<std::string, typename CmdTypeT::RetType, std::string>>&
         results,
     std::ostream& out,
     std::ostream& err) {
   std::map<std::string, typename CmdTypeT::RetType> hostResults;
-  for (auto& result : results) {
-    auto [host, data, errStr] = result.get();
+  for (const auto& [host, data, errStr] : results) {
     if (errStr.empty()) {
       hostResults[host] = data;
     } else {
@@ -149,13 +146,12 @@ template <typename CmdTypeT>
 void printAggregate(
     const std::optional<facebook::fboss::CmdGlobalOptions::AggregateOption>&
         parsedAgg,
-    std::vector<std::shared_future<
-        std::tuple<std::string, typename CmdTypeT::RetType, std::string>>>&
+    const std::vector<
+        std::tuple<std::string, typename CmdTypeT::RetType, std::string>>&
         results,
     const facebook::fboss::ValidAggMapType& validAggMap) {
   if (!parsedAgg->acrossHosts) {
-    for (auto& result : results) {
-      auto [host, data, errStr] = result.get();
+    for (const auto& [host, data, errStr] : results) {
       if (errStr.empty()) {
         std::cout << host << " Aggregation result:: "
                   << facebook::fboss::performAggregation<CmdTypeT>(
@@ -170,8 +166,7 @@ void printAggregate(
   } else {
     // double because aggregation results are doubles.
     std::vector<double> hostAggResults;
-    for (auto& result : results) {
-      auto [host, data, errStr] = result.get();
+    for (const auto& [host, data, errStr] : results) {
       if (errStr.empty()) {
         hostAggResults.push_back(facebook::fboss::performAggregation<CmdTypeT>(
             data, parsedAgg, validAggMap));
@@ -456,37 +451,54 @@ void CmdHandler<CmdTypeT, CmdTypeTraits>::runHelper() {
   }
 
   auto hosts = getHosts();
+  auto globalOptions = CmdGlobalOptions::getInstance();
+  utils::HostQueryExecutor<std::tuple<std::string, RetType, std::string>>
+      executor(globalOptions->getMaxParallelHosts());
+  utils::HostQueryReporter reporter(
+      hosts.size(),
+      executor.getMaxParallelHosts(),
+      globalOptions->printProgress(),
+      globalOptions->printTiming(),
+      std::cerr);
+
+  // Tabular output is printed as each host completes. JSON and aggregated
+  // output need the results of all the hosts.
+  bool streamOutput = !parsedAggregationInput.has_value() &&
+      !globalOptions->getFmt().isJson();
+  std::vector<std::tuple<std::string, RetType, std::string>> results(
+      hosts.size());
+  bool anyFailed = false;
+  executor.run(
+      hosts,
+      [&](const std::string& host) {
+        return asyncHandler(host, parsedFilters, validFilters);
+      },
+      [&](size_t hostIdx,
+          std::tuple<std::string, RetType, std::string>&& result,
+          std::chrono::milliseconds latency) {
+        bool success = std::get<2>(result).empty();
+        anyFailed |= !success;
+        reporter.hostDone(hosts[hostIdx], success, latency);
+        if (streamOutput) {
+          printTabular(
+              impl(), result, hosts.size() != 1, std::cout, std::cerr);
+        } else {
+          results[hostIdx] = std::move(result);
+        }
+      });
 
-  std::vector<std::shared_future<std::tuple<std::string, RetType, std::string>>>
-      futureList;
-
-  for (const auto& host : hosts) {
-    futureList.push_back(std::async(
-                             std::launch::async,
-                             &CmdHandler::asyncHandler,
-                             this,
-                             host,
-                             parsedFilters,
-                             validFilters)
-                             .share());
-  }
-
-  if (!parsedAggregationInput.has_value()) {
-    if (CmdGlobalOptions::getInstance()->getFmt().isJson()) {
-      printJson(impl(), futureList, std::cout, std::cerr);
+  if (!streamOutput) {
+    if (!parsedAggregationInput.has_value()) {
+      printJson(impl(), results, std::cout, std::cerr);
     } else {
-      printTabular(impl(), futureList, std::cout, std::cerr);
+      printAggregate<CmdTypeT>(parsedAggregationInput, results, validAggs);
     }
-  } else {
-    printAggregate<CmdTypeT>(parsedAggregationInput, futureList, validAggs);
   }
+  reporter.printSummary();
 
-  for (auto& fut : futureList) {
-    auto [host, data, errStr] = fut.get();
-    // exit with failure if any of the calls failed
-    if (!errStr.empty()) {
-      throw std::runtime_error("Error in command execution");
-    }
+  // exit with failure if any of the calls failed
+  if (anyFailed) {
+    throw std::runtime_error("Error in command execution");
   }
 }
 
@@ -0,0 +1,118 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include <folly/Benchmark.h>
+#include <folly/init/Init.h>
+#include <thrift/lib/cpp2/server/ThriftServer.h>
+#include <thrift/lib/cpp2/util/ScopedServerInterfaceThread.h>
+
+#include "fboss/agent/if/gen-cpp2/FbossCtrl.h"
+#include "fboss/cli/fboss2/CmdGlobalOptions.h"
+#include "fboss/cli/fboss2/utils/CmdClientUtils.h"
+#include "fboss/cli/fboss2/utils/HostInfo.h"
+#include "fboss/cli/fboss2/utils/HostQueryExecutor.h"
+
+#include <future>
+#include <thread>
+
+DEFINE_int32(num_hosts, 512, "Number of hosts to query per iteration");
+DEFINE_int32(num_ports, 128, "Number of ports reported by each host");
+DEFINE_int32(server_latency_us, 1000, "Time the fake agent takes per call");
+
+using namespace facebook::fboss;
+
+namespace {
+
+// Stands in for the agent of every queried host.
+class FakeAgentHandler : public FbossCtrlSvIf {
+ public:
+  void getAllPortInfo(std::map<int32_t, PortInfoThrift>& portInfo) override {
+    /* sleep override */
+    std::this_thread::sleep_for(
+        std::chrono::microseconds(FLAGS_server_latency_us));
+    for (int32_t portId = 1; portId <= FLAGS_num_ports; ++portId) {
+      PortInfoThrift port;
+      port.portId() = portId;
+      port.name() = folly::to<std::string>("eth1/", portId, "/1");
+      port.speedMbps() = 100000;
+      portInfo.emplace(portId, std::move(port));
+    }
+  }
+};
+
+std::unique_ptr<apache::thrift::ScopedServerInterfaceThread> fakeAgent;
+std::vector<std::string> hosts;
+
+// Like most show commands, talk to the agent of the host more than once.
+size_t queryHost(const std::string& host) {
+  HostInfo hostInfo(host, host, folly::IPAddressV6("::1"));
+  size_t numPorts = 0;
+  for (int i = 0; i < 2; ++i) {
+    auto client = utils::createClient<FbossCtrlAsyncClient>(hostInfo);
+    std::map<int32_t, PortInfoThrift> portInfo;
+    client->sync_getAllPortInfo(portInfo);
+    numPorts += portInfo.size();
+  }
+  return numPorts;
+}
+
+} // namespace
+
+// What CmdHandler used to do: a thread and fresh connections per host, and
+// the results gathered in host order.
+BENCHMARK(AsyncPerHost) {
+  std::vector<std::future<size_t>> futures;
+  for (const auto& host : hosts) {
+    futures.push_back(std::async(std::launch::async, queryHost, host));
+  }
+  size_t numPorts = 0;
+  for (auto& future : futures) {
+    numPorts += future.get();
+  }
+  folly::doNotOptimizeAway(numPorts);
+}
+
+void boundedExecutor(unsigned iters, size_t maxParallelHosts) {
+  utils::HostQueryExecutor<size_t> executor(maxParallelHosts);
+  for (unsigned i = 0; i < iters; ++i) {
+    size_t numPorts = 0;
+    executor.run(
+        hosts,
+        queryHost,
+        [&numPorts](size_t, size_t&& result, std::chrono::milliseconds) {
+          numPorts += result;
+        });
+    folly::doNotOptimizeAway(numPorts);
+  }
+}
+
+BENCHMARK_RELATIVE_PARAM(boundedExecutor, 16);
+BENCHMARK_RELATIVE_PARAM(boundedExecutor, 64);
+BENCHMARK_RELATIVE_PARAM(boundedExecutor, 256);
+
+int main(int argc, char** argv) {
+  folly::init(&argc, &argv, true);
+  fakeAgent = std::make_unique<apache::thrift::ScopedServerInterfaceThread>(
+      std::make_shared<FakeAgentHandler>(),
+      "::1",
+      0,
+      [](apache::thrift::ThriftServer& server) {
+        // Enough workers for the fake latency not to queue up calls.
+        server.setNumCPUWorkerThreads(256);
+      });
+  CmdGlobalOptions::getInstance()->setAgentThriftPort(
+      fakeAgent->getAddress().getPort());
+  for (int i = 0; i < FLAGS_num_hosts; ++i) {
+    hosts.push_back(folly::to<std::string>("fsw", i, ".test"));
+  }
+  folly::runBenchmarks();
+  fakeAgent.reset();
+  return 0;
+}
@@ -16,6 +16,31 @@
 
 namespace facebook::fboss::utils {
 
+thread_local ScopedClientChannelCache* ScopedClientChannelCache::current_ =
+    nullptr;
+
+ScopedClientChannelCache::ScopedClientChannelCache() : prev_(current_) {
+  current_ = this;
+}
+
+ScopedClientChannelCache::~ScopedClientChannelCache() {
+  current_ = prev_;
+}
+
+std::shared_ptr<apache::thrift::HeaderClientChannel>
+ScopedClientChannelCache::getChannel(
+    const folly::SocketAddress& addr,
+    folly::FunctionRef<apache::thrift::HeaderClientChannel::Ptr()> create) {
+  if (!current_) {
+    return create();
+  }
+  auto& channel = current_->channels_[addr];
+  if (!channel || !channel->good()) {
+    channel = create();
+  }
+  return channel;
+}
+
 template <>
 std::unique_ptr<facebook::fboss::FbossCtrlAsyncClient> createClient(
     const HostInfo& hostInfo) {
@@ -15,8 +15,11 @@
 #include "fboss/cli/fboss2/utils/HostInfo.h"
 #include "fboss/qsfp_service/if/gen-cpp2/QsfpService.h"
 
+#include <folly/SocketAddress.h>
+#include <folly/functional/Function.h>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 namespace facebook::fboss::utils {
 
@@ -24,6 +27,34 @@ static auto constexpr kConnTimeout = 1000;
 static auto constexpr kRecvTimeout = 45000;
 static auto constexpr kSendTimeout = 5000;
 
+// While in scope, clients created on this thread for the same host and
+// port share one connection instead of each opening their own. Meant to
+// wrap the queries made to a host, so that commands talking to the same
+// service several times do not pay for a connection setup every time.
+class ScopedClientChannelCache {
+ public:
+  ScopedClientChannelCache();
+  ~ScopedClientChannelCache();
+
+  // Returns the cached channel to addr if there is a cache in scope and
+  // the channel is still usable, else a channel made by create.
+  static std::shared_ptr<apache::thrift::HeaderClientChannel> getChannel(
+      const folly::SocketAddress& addr,
+      folly::FunctionRef<apache::thrift::HeaderClientChannel::Ptr()> create);
+
+ private:
+  ScopedClientChannelCache(const ScopedClientChannelCache&) = delete;
+  ScopedClientChannelCache& operator=(const ScopedClientChannelCache&) =
+      delete;
+
+  std::unordered_map<
+      folly::SocketAddress,
+      std::shared_ptr<apache::thrift::HeaderClientChannel>>
+      channels_;
+  ScopedClientChannelCache* prev_{nullptr};
+  static thread_local ScopedClientChannelCache* current_;
+};
+
 template <typename T>
 std::unique_ptr<T> createClient(const HostInfo& hostInfo);
 
@@ -35,13 +66,16 @@ template <typename Client>
 std::unique_ptr<Client> createPlaintextClient(
     const HostInfo& hostInfo,
     const int port) {
-  auto eb = folly::EventBaseManager::get()->getEventBase();
   auto addr = folly::SocketAddress(hostInfo.getIp(), port);
-  auto sock = folly::AsyncSocket::newSocket(eb, addr, kConnTimeout);
-  sock->setSendTimeout(kSendTimeout);
-  auto channel =
-      apache::thrift::HeaderClientChannel::newChannel(std::move(sock));
-  channel->setTimeout(kRecvTimeout);
+  auto channel = ScopedClientChannelCache::getChannel(addr, [&addr]() {
+    auto eb = folly::EventBaseManager::get()->getEventBase();
+    auto sock = folly::AsyncSocket::newSocket(eb, addr, kConnTimeout);
+    sock->setSendTimeout(kSendTimeout);
+    auto newChannel =
+        apache::thrift::HeaderClientChannel::newChannel(std::move(sock));
+    newChannel->setTimeout(kRecvTimeout);
+    return newChannel;
+  });
   return std::make_unique<Client>(std::move(channel));
 }
 
@@ -0,0 +1,80 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/cli/fboss2/utils/HostQueryExecutor.h"
+
+#include <fmt/format.h>
+#include <algorithm>
+
+namespace facebook::fboss::utils {
+
+HostQueryReporter::HostQueryReporter(
+    size_t numHosts,
+    size_t maxParallelHosts,
+    bool printProgress,
+    bool printTiming,
+    std::ostream& out)
+    : numHosts_(numHosts),
+      maxParallelHosts_(std::min(numHosts, maxParallelHosts)),
+      printProgress_(printProgress),
+      printTiming_(printTiming),
+      out_(out) {
+  latencies_.reserve(numHosts);
+}
+
+void HostQueryReporter::hostDone(
+    const std::string& host,
+    bool success,
+    std::chrono::milliseconds latency) {
+  numDone_++;
+  if (!success) {
+    numFailed_++;
+  }
+  latencies_.emplace_back(latency, host);
+  if (printProgress_) {
+    out_ << fmt::format(
+                "[{}/{}] {} {} in {} ms",
+                numDone_,
+                numHosts_,
+                host,
+                success ? "done" : "failed",
+                latency.count())
+         << std::endl;
+  }
+}
+
+void HostQueryReporter::printSummary() {
+  if (!printTiming_ || latencies_.empty()) {
+    return;
+  }
+  std::sort(latencies_.begin(), latencies_.end());
+  auto percentile = [this](size_t pct) {
+    return latencies_[(latencies_.size() - 1) * pct / 100].first.count();
+  };
+  out_ << fmt::format(
+              "Queried {} host(s), {} failed, in {} ms with up to {} in "
+              "parallel",
+              numDone_,
+              numFailed_,
+              watch_.elapsed().count(),
+              maxParallelHosts_)
+       << std::endl;
+  out_ << fmt::format(
+              "Per host latency: min {} ms, p50 {} ms, p90 {} ms, max {} ms "
+              "({})",
+              latencies_.front().first.count(),
+              percentile(50),
+              percentile(90),
+              latencies_.back().first.count(),
+              latencies_.back().second)
+       << std::endl;
+}
+
+} // namespace facebook::fboss::utils
@@ -0,0 +1,130 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#pragma once
+
+#include <folly/MPMCQueue.h>
+#include <folly/Try.h>
+#include <folly/executors/CPUThreadPoolExecutor.h>
+#include <folly/executors/thread_factory/NamedThreadFactory.h>
+#include <folly/stop_watch.h>
+
+#include "fboss/cli/fboss2/utils/CmdClientUtils.h"
+
+#include <chrono>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace facebook::fboss::utils {
+
+/*
+ * Runs a query against every host on a bounded number of threads, instead
+ * of a thread per host. Each worker keeps its EventBase across the hosts it
+ * queries, and the clients created while querying a host share their
+ * connections (see ScopedClientChannelCache).
+ *
+ * Results are handed back on the calling thread in the order the queries
+ * complete, so that output can be streamed rather than held back by the
+ * slowest host.
+ */
+template <typename ResultT>
+class HostQueryExecutor {
+ public:
+  using QueryFn = std::function<ResultT(const std::string& host)>;
+  using ResultFn = std::function<void(
+      size_t hostIdx,
+      ResultT&& result,
+      std::chrono::milliseconds latency)>;
+
+  explicit HostQueryExecutor(size_t maxParallelHosts)
+      : maxParallelHosts_(std::max<size_t>(maxParallelHosts, 1)) {}
+
+  // Calls query for each host and onResult with its result once it is
+  // available. An exception thrown by query is rethrown from here.
+  void run(
+      const std::vector<std::string>& hosts,
+      const QueryFn& query,
+      const ResultFn& onResult) const {
+    if (hosts.empty()) {
+      return;
+    }
+    std::vector<folly::Try<ResultT>> results(hosts.size());
+    std::vector<std::chrono::milliseconds> latencies(hosts.size());
+    // Indices of the hosts whose query completed. Sized so that workers
+    // never block on it.
+    folly::MPMCQueue<size_t> completed(hosts.size());
+
+    // Declared last so that the workers are joined before anything they
+    // write to goes away, even if onResult throws.
+    folly::CPUThreadPoolExecutor executor(
+        std::min(hosts.size(), maxParallelHosts_),
+        std::make_shared<folly::NamedThreadFactory>("HostQuery"));
+    for (size_t idx = 0; idx < hosts.size(); ++idx) {
+      executor.add([&, idx]() {
+        folly::stop_watch<std::chrono::milliseconds> watch;
+        {
+          ScopedClientChannelCache channelCache;
+          results[idx] =
+              folly::makeTryWith([&]() { return query(hosts[idx]); });
+        }
+        latencies[idx] = watch.elapsed();
+        completed.blockingWrite(idx);
+      });
+    }
+    for (size_t numCompleted = 0; numCompleted < hosts.size();
+         ++numCompleted) {
+      size_t idx;
+      completed.blockingRead(idx);
+      onResult(idx, std::move(results[idx]).value(), latencies[idx]);
+    }
+  }
+
+  size_t getMaxParallelHosts() const {
+    return maxParallelHosts_;
+  }
+
+ private:
+  const size_t maxParallelHosts_;
+};
+
+/*
+ * Reports the progress of a multi-host query as each host completes, and
+ * a summary of the per host latencies at the end.
+ */
+class HostQueryReporter {
+ public:
+  HostQueryReporter(
+      size_t numHosts,
+      size_t maxParallelHosts,
+      bool printProgress,
+      bool printTiming,
+      std::ostream& out);
+
+  void hostDone(
+      const std::string& host,
+      bool success,
+      std::chrono::milliseconds latency);
+
+  void printSummary();
+
+ private:
+  const size_t numHosts_;
+  const size_t maxParallelHosts_;
+  const bool printProgress_;
+  const bool printTiming_;
+  std::ostream& out_;
+  folly::stop_watch<std::chrono::milliseconds> watch_;
+  size_t numDone_{0};
+  size_t numFailed_{0};
+  std::vector<std::pair<std::chrono::milliseconds, std::string>> latencies_;
+};
+
+} // namespace facebook::fboss::utils
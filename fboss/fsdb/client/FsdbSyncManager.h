@@ -5,11 +5,13 @@
 #include <fboss/fsdb/common/Utils.h>
 #include <fboss/fsdb/if/gen-cpp2/fsdb_oper_types.h>
 #include <fboss/thrift_cow/visitors/DeltaVisitor.h>
+#include <fboss/thrift_cow/visitors/ParallelDeltaVisitor.h>
 #include <fboss/thrift_storage/CowStorage.h>
 #include "fboss/fsdb/client/FsdbPubSubManager.h"
 #include "fboss/fsdb/client/FsdbStreamClient.h"
 #include "fboss/thrift_storage/CowStorageMgr.h"
 
+#include <folly/executors/CPUThreadPoolExecutor.h>
 #include <folly/io/async/EventBase.h>
 #include <atomic>
 #include <memory>
@@ -72,7 +74,12 @@ class FsdbSyncManager2 {
         publishDeltas_(publishDeltas),
         storage_([this](const auto& oldState, const auto& newState) {
           processDelta(oldState, newState);
-        }) {}
+        }) {
+    if (publishDeltas_ && FLAGS_fsdb_publish_delta_threads > 0) {
+      deltaExecutor_ = std::make_unique<folly::CPUThreadPoolExecutor>(
+          FLAGS_fsdb_publish_delta_threads);
+    }
+  }
 
   ~FsdbSyncManager2() {
     CHECK(!pubSubMgr_) << "Syncer not stopped";
@@ -179,26 +186,39 @@ class FsdbSyncManager2 {
   void publishDelta(
       const std::shared_ptr<CowState>& oldState,
       const std::shared_ptr<CowState>& newState) {
-    std::vector<OperDeltaUnit> deltas;
-    auto processChange = [this, &deltas](
-                             const std::vector<std::string>& path,
-                             auto oldNode,
-                             auto newNode,
-                             thrift_cow::DeltaElemTag /* visitTag */) {
+    auto buildDeltaUnit = [this](
+                              const std::vector<std::string>& path,
+                              auto oldNode,
+                              auto newNode,
+                              thrift_cow::DeltaElemTag /* visitTag */) {
       std::vector<std::string> fullPath;
       fullPath.reserve(basePath_.size() + path.size());
       fullPath.insert(fullPath.end(), basePath_.begin(), basePath_.end());
       fullPath.insert(fullPath.end(), path.begin(), path.end());
       // TODO: metadata
-      deltas.push_back(
-          buildOperDeltaUnit(fullPath, oldNode, newNode, OperProtocol::BINARY));
+      return buildOperDeltaUnit(
+          fullPath, oldNode, newNode, OperProtocol::BINARY);
     };
 
-    thrift_cow::RootDeltaVisitor::visit(
-        oldState,
-        newState,
-        thrift_cow::DeltaVisitMode::MINIMAL,
-        std::move(processChange));
+    std::vector<OperDeltaUnit> deltas;
+    if (deltaExecutor_) {
+      // Deltas come out in the same order as when diffing sequentially
+      thrift_cow::ParallelDeltaVisitOptions options;
+      options.executor = deltaExecutor_.get();
+      options.numTasks = deltaExecutor_->numThreads() * 4;
+      deltas = thrift_cow::RootParallelDeltaVisitor::visit<OperDeltaUnit>(
+          oldState,
+          newState,
+          thrift_cow::DeltaVisitMode::MINIMAL,
+          options,
+          buildDeltaUnit);
+    } else {
+      thrift_cow::RootDeltaVisitor::visit(
+          oldState,
+          newState,
+          thrift_cow::DeltaVisitMode::MINIMAL,
+          [&](auto&&... args) { deltas.push_back(buildDeltaUnit(args...)); });
+    }
 
     publish(createDelta(std::move(deltas)));
   }
@@ -225,6 +245,8 @@ class FsdbSyncManager2 {
   bool publishDeltas_;
   CowStorageManager storage_;
   std::atomic_bool readyForPublishing_ = false;
+  // Computes deltas of published states, with --fsdb_publish_delta_threads
+  std::unique_ptr<folly::CPUThreadPoolExecutor> deltaExecutor_;
 };
 
 } // namespace facebook::fboss::fsdb
@@ -16,3 +16,8 @@ DEFINE_bool(
     subscribe_to_stats_from_fsdb,
     false,
     "Whether to subscribe to stats from fsdb");
+DEFINE_int32(
+    fsdb_publish_delta_threads,
+    0,
+    "Number of threads to compute deltas of large published trees on, "
+    "0 to compute them on the publishing thread");
@@ -8,3 +8,4 @@ DECLARE_int32(fsdbPort);
 DECLARE_bool(publish_stats_to_fsdb);
 DECLARE_bool(publish_state_to_fsdb);
 DECLARE_bool(subscribe_to_stats_from_fsdb);
+DECLARE_int32(fsdb_publish_delta_threads);
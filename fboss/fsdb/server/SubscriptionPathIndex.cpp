@@ -0,0 +1,226 @@
+// Copyright 2004-present Facebook. All Rights Reserved.
+
+#include "fboss/fsdb/server/SubscriptionPathIndex.h"
+
+#include "fboss/fsdb/if/gen-cpp2/fsdb_common_types.h"
+
+#include <algorithm>
+
+namespace facebook::fboss::fsdb {
+
+struct SubscriptionPathIndex::Node {
+  struct RegexChild {
+    explicit RegexChild(const std::string& pattern) : regex(pattern) {}
+    re2::RE2 regex;
+    std::unique_ptr<Node> node{std::make_unique<Node>()};
+  };
+
+  bool empty() const {
+    return raw.empty() && !any && regex.empty() && subscriptions.empty();
+  }
+
+  std::unordered_map<std::string, std::unique_ptr<Node>> raw;
+  std::unique_ptr<Node> any;
+  // Keyed by pattern, so that subscriptions to the same regex share nodes
+  std::unordered_map<std::string, std::unique_ptr<RegexChild>> regex;
+  // Subscriptions with a path ending here
+  std::vector<SubscriptionId> subscriptions;
+};
+
+namespace {
+
+FsdbException invalidPath(const std::string& message) {
+  FsdbException e;
+  e.message() = message;
+  e.errorCode() = FsdbErrorCode::INVALID_PATH;
+  return e;
+}
+
+// Checks every element up front, so that a bad one doesn't leave the trie
+// with the nodes of the elements before it
+void validatePath(const SubscriptionPathIndex::ExtPath& path) {
+  for (const auto& elem : path) {
+    if (auto regex = elem.regex_ref()) {
+      if (!re2::RE2(*regex).ok()) {
+        throw invalidPath("Invalid regex in path: " + *regex);
+      }
+    } else if (!elem.any_ref() && !elem.raw_ref()) {
+      throw invalidPath("Unset path element");
+    }
+  }
+}
+
+template <typename Node, typename Ids>
+void collectSubtree(const Node& node, Ids& ids) {
+  ids.insert(ids.end(), node.subscriptions.begin(), node.subscriptions.end());
+  for (const auto& [tok, child] : node.raw) {
+    collectSubtree(*child, ids);
+  }
+  if (node.any) {
+    collectSubtree(*node.any, ids);
+  }
+  for (const auto& [pattern, child] : node.regex) {
+    collectSubtree(*child->node, ids);
+  }
+}
+
+} // namespace
+
+SubscriptionPathIndex::SubscriptionPathIndex()
+    : root_(std::make_unique<Node>()) {}
+
+SubscriptionPathIndex::~SubscriptionPathIndex() = default;
+
+void SubscriptionPathIndex::add(SubscriptionId id, const Path& path) {
+  ExtPath extPath;
+  extPath.reserve(path.size());
+  for (const auto& tok : path) {
+    extPath.emplace_back().set_raw(tok);
+  }
+  add(id, extPath);
+}
+
+void SubscriptionPathIndex::add(SubscriptionId id, const ExtPath& path) {
+  validatePath(path);
+  auto node = root_.get();
+  for (const auto& elem : path) {
+    node = findOrAddChild(*node, elem);
+  }
+  node->subscriptions.push_back(id);
+  subscriptionPaths_[id].push_back(path);
+}
+
+void SubscriptionPathIndex::remove(SubscriptionId id) {
+  auto itr = subscriptionPaths_.find(id);
+  if (itr == subscriptionPaths_.end()) {
+    return;
+  }
+  for (const auto& path : itr->second) {
+    removePath(path, id);
+  }
+  subscriptionPaths_.erase(itr);
+}
+
+SubscriptionPathIndex::Node* SubscriptionPathIndex::findOrAddChild(
+    Node& node,
+    const OperPathElem& elem) {
+  if (elem.any_ref()) {
+    if (!node.any) {
+      node.any = std::make_unique<Node>();
+    }
+    return node.any.get();
+  } else if (auto raw = elem.raw_ref()) {
+    auto& child = node.raw[*raw];
+    if (!child) {
+      child = std::make_unique<Node>();
+    }
+    return child.get();
+  } else if (auto regex = elem.regex_ref()) {
+    auto& child = node.regex[*regex];
+    if (!child) {
+      child = std::make_unique<Node::RegexChild>(*regex);
+    }
+    return child->node.get();
+  }
+  throw invalidPath("Unset path element");
+}
+
+void SubscriptionPathIndex::removePath(const ExtPath& path, SubscriptionId id) {
+  // nodes along the path, to prune the ones left empty bottom up
+  std::vector<std::pair<Node*, const OperPathElem*>> parents;
+  auto node = root_.get();
+  for (const auto& elem : path) {
+    parents.emplace_back(node, &elem);
+    node = findOrAddChild(*node, elem);
+  }
+
+  auto& subscriptions = node->subscriptions;
+  auto itr = std::find(subscriptions.begin(), subscriptions.end(), id);
+  if (itr != subscriptions.end()) {
+    subscriptions.erase(itr);
+  }
+
+  for (auto it = parents.rbegin(); it != parents.rend() && node->empty();
+       ++it) {
+    auto [parent, elem] = *it;
+    if (elem->any_ref()) {
+      parent->any.reset();
+    } else if (auto raw = elem->raw_ref()) {
+      parent->raw.erase(*raw);
+    } else if (auto regex = elem->regex_ref()) {
+      parent->regex.erase(*regex);
+    }
+    node = parent;
+  }
+}
+
+void SubscriptionPathIndex::collectMatches(
+    const Path& path,
+    std::vector<SubscriptionId>& ids) const {
+  std::vector<const Node*> active{root_.get()};
+  std::vector<const Node*> next;
+  for (const auto& tok : path) {
+    next.clear();
+    for (auto node : active) {
+      // subscribed paths ending above the published one
+      ids.insert(
+          ids.end(), node->subscriptions.begin(), node->subscriptions.end());
+      if (auto itr = node->raw.find(tok); itr != node->raw.end()) {
+        next.push_back(itr->second.get());
+      }
+      if (node->any) {
+        next.push_back(node->any.get());
+      }
+      for (const auto& [pattern, child] : node->regex) {
+        if (re2::RE2::FullMatch(tok, child->regex)) {
+          next.push_back(child->node.get());
+        }
+      }
+    }
+    active.swap(next);
+    if (active.empty()) {
+      return;
+    }
+  }
+  // subscribed paths at or below the published one
+  for (auto node : active) {
+    collectSubtree(*node, ids);
+  }
+}
+
+std::vector<SubscriptionPathIndex::SubscriptionId> SubscriptionPathIndex::match(
+    const Path& path) const {
+  std::vector<SubscriptionId> ids;
+  collectMatches(path, ids);
+  std::sort(ids.begin(), ids.end());
+  ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+  return ids;
+}
+
+std::unordered_map<SubscriptionPathIndex::SubscriptionId, OperDelta>
+SubscriptionPathIndex::route(const OperDelta& delta) const {
+  std::unordered_map<SubscriptionId, OperDelta> deltas;
+  std::vector<SubscriptionId> ids;
+  for (const auto& unit : *delta.changes()) {
+    ids.clear();
+    collectMatches(*unit.path()->raw(), ids);
+    // a subscription matching through several of its paths gets the
+    // change once
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    for (auto id : ids) {
+      auto [itr, inserted] = deltas.try_emplace(id);
+      auto& subscriptionDelta = itr->second;
+      if (inserted) {
+        subscriptionDelta.protocol() = *delta.protocol();
+        if (delta.metadata()) {
+          subscriptionDelta.metadata() = *delta.metadata();
+        }
+      }
+      subscriptionDelta.changes()->push_back(unit);
+    }
+  }
+  return deltas;
+}
+
+} // namespace facebook::fboss::fsdb
@@ -0,0 +1,76 @@
+// Copyright 2004-present Facebook. All Rights Reserved.
+
+#pragma once
+
+#include "fboss/fsdb/if/gen-cpp2/fsdb_oper_types.h"
+
+#include <re2/re2.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook::fboss::fsdb {
+
+/*
+ * Index of subscribed paths, wildcards included, to route published
+ * deltas to their subscribers.
+ *
+ * Subscribed paths are kept in a trie with one level per path element.
+ * A published path gets matched against every subscription in a single
+ * walk down the trie, following at each level the raw child for the path
+ * token, the wildcard child and any regex child matching the token. A
+ * subscription matches a published path if either one is a prefix of the
+ * other: changes below a subscribed path, as well as changes to its
+ * parents replacing it, are of interest to the subscriber.
+ *
+ * Not thread safe, callers serialize access as with the rest of the
+ * server's publisher and subscriber bookkeeping.
+ */
+class SubscriptionPathIndex {
+ public:
+  using SubscriptionId = uint64_t;
+  using Path = std::vector<std::string>;
+  using ExtPath = std::vector<OperPathElem>;
+
+  SubscriptionPathIndex();
+  ~SubscriptionPathIndex();
+
+  // A subscription may subscribe to multiple paths, as extended
+  // subscriptions do
+  void add(SubscriptionId id, const Path& path);
+  void add(SubscriptionId id, const ExtPath& path);
+  void remove(SubscriptionId id);
+
+  size_t numSubscriptions() const {
+    return subscriptionPaths_.size();
+  }
+
+  // Subscriptions with a path matching path
+  std::vector<SubscriptionId> match(const Path& path) const;
+
+  /*
+   * Split delta into per subscription deltas, each with only the changes
+   * matching one of the subscription's paths, in publish order. Only
+   * subscriptions with matching changes get a delta.
+   */
+  std::unordered_map<SubscriptionId, OperDelta> route(
+      const OperDelta& delta) const;
+
+ private:
+  struct Node;
+
+  // Appends the subscriptions matching path to ids, once per matching
+  // subscribed path
+  void collectMatches(const Path& path, std::vector<SubscriptionId>& ids)
+      const;
+
+  Node* findOrAddChild(Node& node, const OperPathElem& elem);
+  void removePath(const ExtPath& path, SubscriptionId id);
+
+  std::unique_ptr<Node> root_;
+  std::unordered_map<SubscriptionId, std::vector<ExtPath>> subscriptionPaths_;
+};
+
+} // namespace facebook::fboss::fsdb
@@ -0,0 +1,166 @@
+// (c) Facebook, Inc. and its affiliates. Confidential and proprietary.
+
+#include "fboss/fsdb/server/SubscriptionPathIndex.h"
+
+#include <folly/Benchmark.h>
+#include <folly/Conv.h>
+#include <folly/init/Init.h>
+
+#include <memory>
+
+/*
+ * Cost of routing a published delta to 1k subscriptions on overlapping
+ * paths, wildcards included, comparing matching every change against
+ * every subscription with routing through the index.
+ */
+
+using namespace facebook::fboss::fsdb;
+
+namespace {
+
+constexpr auto kNumSubscriptions = 1000;
+constexpr auto kNumPorts = 256;
+
+OperPathElem elem(const std::string& tok) {
+  OperPathElem elem;
+  if (tok == "*") {
+    elem.set_any(true);
+  } else if (tok.front() == '~') {
+    elem.set_regex(tok.substr(1));
+  } else {
+    elem.set_raw(tok);
+  }
+  return elem;
+}
+
+std::string portName(int port) {
+  return folly::to<std::string>("eth", port / 4 + 1, "/", port % 4 + 1, "/1");
+}
+
+// Mix of subscriptions to single ports, to fields of every port, and to
+// groups of ports through regexes
+std::vector<SubscriptionPathIndex::ExtPath> subscribedPaths() {
+  std::vector<SubscriptionPathIndex::ExtPath> paths;
+  for (int i = 0; i < kNumSubscriptions; ++i) {
+    std::vector<std::string> toks{"agent", "switchState", "portMaps"};
+    switch (i % 4) {
+      case 0:
+      case 1:
+        toks.push_back(portName(i % kNumPorts));
+        break;
+      case 2:
+        toks.push_back("*");
+        toks.push_back(folly::to<std::string>("field", i % 16));
+        break;
+      case 3:
+        toks.push_back(folly::to<std::string>("~eth", i % 64 + 1, "/.*"));
+        break;
+    }
+    SubscriptionPathIndex::ExtPath path;
+    for (const auto& tok : toks) {
+      path.push_back(elem(tok));
+    }
+    paths.push_back(std::move(path));
+  }
+  return paths;
+}
+
+OperDelta buildDelta(int numChanges) {
+  OperDelta delta;
+  delta.protocol() = OperProtocol::BINARY;
+  for (int i = 0; i < numChanges; ++i) {
+    OperDeltaUnit unit;
+    unit.path()->raw() = {
+        "agent",
+        "switchState",
+        "portMaps",
+        portName(i * 7 % kNumPorts),
+        folly::to<std::string>("field", i % 16)};
+    unit.newState() = "state";
+    delta.changes()->push_back(std::move(unit));
+  }
+  return delta;
+}
+
+// A subscription as matched without the index, regexes compiled upfront
+struct Subscription {
+  explicit Subscription(const SubscriptionPathIndex::ExtPath& extPath)
+      : path(extPath) {
+    for (const auto& elem : path) {
+      auto regex = elem.regex_ref();
+      regexes.push_back(
+          regex ? std::make_unique<re2::RE2>(*regex) : nullptr);
+    }
+  }
+
+  bool matches(const std::vector<std::string>& published) const {
+    auto len = std::min(path.size(), published.size());
+    for (size_t i = 0; i < len; ++i) {
+      const auto& tok = published[i];
+      if (auto raw = path[i].raw_ref()) {
+        if (*raw != tok) {
+          return false;
+        }
+      } else if (regexes[i] && !re2::RE2::FullMatch(tok, *regexes[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  SubscriptionPathIndex::ExtPath path;
+  std::vector<std::unique_ptr<re2::RE2>> regexes;
+};
+
+} // namespace
+
+void routeLinear(unsigned iters, int numChanges) {
+  folly::BenchmarkSuspender suspender;
+  std::vector<Subscription> subscriptions;
+  for (const auto& path : subscribedPaths()) {
+    subscriptions.emplace_back(path);
+  }
+  auto delta = buildDelta(numChanges);
+  suspender.dismiss();
+
+  for (unsigned iter = 0; iter < iters; ++iter) {
+    std::unordered_map<SubscriptionPathIndex::SubscriptionId, OperDelta>
+        deltas;
+    for (const auto& unit : *delta.changes()) {
+      for (size_t id = 0; id < subscriptions.size(); ++id) {
+        if (subscriptions[id].matches(*unit.path()->raw())) {
+          deltas[id].changes()->push_back(unit);
+        }
+      }
+    }
+    folly::doNotOptimizeAway(deltas);
+  }
+}
+
+void routeIndexed(unsigned iters, int numChanges) {
+  folly::BenchmarkSuspender suspender;
+  SubscriptionPathIndex index;
+  auto paths = subscribedPaths();
+  for (size_t id = 0; id < paths.size(); ++id) {
+    index.add(id, paths[id]);
+  }
+  auto delta = buildDelta(numChanges);
+  suspender.dismiss();
+
+  for (unsigned iter = 0; iter < iters; ++iter) {
+    folly::doNotOptimizeAway(index.route(delta));
+  }
+}
+
+BENCHMARK_PARAM(routeLinear, 10);
+BENCHMARK_RELATIVE_PARAM(routeIndexed, 10);
+BENCHMARK_PARAM(routeLinear, 100);
+BENCHMARK_RELATIVE_PARAM(routeIndexed, 100);
+BENCHMARK_PARAM(routeLinear, 1000);
+BENCHMARK_RELATIVE_PARAM(routeIndexed, 1000);
+
+int main(int argc, char** argv) {
+  folly::init(&argc, &argv, true);
+  folly::runBenchmarks();
+  return 0;
+}
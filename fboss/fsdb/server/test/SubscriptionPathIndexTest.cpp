@@ -0,0 +1,159 @@
+// (c) Facebook, Inc. and its affiliates. Confidential and proprietary.
+
+#include "fboss/fsdb/server/SubscriptionPathIndex.h"
+#include "fboss/fsdb/if/gen-cpp2/fsdb_common_types.h"
+
+#include <gtest/gtest.h>
+
+namespace facebook::fboss::fsdb::test {
+namespace {
+
+using Ids = std::vector<SubscriptionPathIndex::SubscriptionId>;
+
+OperPathElem raw(const std::string& tok) {
+  OperPathElem elem;
+  elem.set_raw(tok);
+  return elem;
+}
+
+OperPathElem any() {
+  OperPathElem elem;
+  elem.set_any(true);
+  return elem;
+}
+
+OperPathElem regex(const std::string& pattern) {
+  OperPathElem elem;
+  elem.set_regex(pattern);
+  return elem;
+}
+
+OperDeltaUnit deltaUnit(const std::vector<std::string>& path) {
+  OperDeltaUnit unit;
+  unit.path()->raw() = path;
+  return unit;
+}
+
+std::vector<std::vector<std::string>> unitPaths(const OperDelta& delta) {
+  std::vector<std::vector<std::string>> paths;
+  for (const auto& unit : *delta.changes()) {
+    paths.push_back(*unit.path()->raw());
+  }
+  return paths;
+}
+
+} // namespace
+
+class SubscriptionPathIndexTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    index_.add(1, {"agent", "switchState", "portMaps"});
+    index_.add(
+        2,
+        SubscriptionPathIndex::ExtPath{
+            raw("agent"), raw("switchState"), raw("portMaps"), any(), any()});
+    index_.add(
+        3,
+        SubscriptionPathIndex::ExtPath{
+            raw("agent"), any(), raw("portMaps"), regex("eth1/.*")});
+    index_.add(4, {"agent", "switchState", "vlanMaps"});
+    index_.add(5, {"qsfp_service"});
+  }
+
+  SubscriptionPathIndex index_;
+};
+
+TEST_F(SubscriptionPathIndexTest, matchBelowAndAboveSubscribedPaths) {
+  // below subscribed paths
+  EXPECT_EQ(
+      index_.match({"agent", "switchState", "portMaps", "eth1/1/1", "id"}),
+      (Ids{1, 2, 3}));
+  EXPECT_EQ(
+      index_.match({"agent", "switchState", "portMaps", "eth2/1/1", "id"}),
+      (Ids{1, 2}));
+  EXPECT_EQ(
+      index_.match({"agent", "switchState", "portMaps", "eth2/1/1"}),
+      (Ids{1, 2}));
+  // parents of subscribed paths
+  EXPECT_EQ(index_.match({"agent", "switchState"}), (Ids{1, 2, 3, 4}));
+  EXPECT_EQ(index_.match({"agent"}), (Ids{1, 2, 3, 4}));
+  EXPECT_EQ(index_.match({}), (Ids{1, 2, 3, 4, 5}));
+  // unrelated paths
+  EXPECT_EQ(index_.match({"agent", "config"}), (Ids{3}));
+  EXPECT_EQ(index_.match({"bgp"}), Ids{});
+}
+
+TEST_F(SubscriptionPathIndexTest, remove) {
+  // a second path for the same subscription is only matched once
+  index_.add(1, {"agent", "switchState", "vlanMaps"});
+  EXPECT_EQ(index_.numSubscriptions(), 5);
+  EXPECT_EQ(index_.match({"agent", "switchState"}), (Ids{1, 2, 3, 4}));
+
+  index_.remove(1);
+  index_.remove(3);
+  EXPECT_EQ(index_.numSubscriptions(), 3);
+  EXPECT_EQ(
+      index_.match({"agent", "switchState", "portMaps", "eth1/1/1", "id"}),
+      (Ids{2}));
+  EXPECT_EQ(index_.match({"agent", "switchState"}), (Ids{2, 4}));
+
+  index_.remove(2);
+  index_.remove(4);
+  index_.remove(5);
+  index_.remove(5);
+  EXPECT_EQ(index_.numSubscriptions(), 0);
+  EXPECT_EQ(index_.match({}), Ids{});
+}
+
+TEST_F(SubscriptionPathIndexTest, invalidRegex) {
+  EXPECT_THROW(
+      index_.add(6, SubscriptionPathIndex::ExtPath{raw("agent"), regex("(")}),
+      FsdbException);
+  // nothing gets added ahead of the bad element either
+  EXPECT_THROW(
+      index_.add(
+          6,
+          SubscriptionPathIndex::ExtPath{
+              raw("bgp"), raw("peers"), regex("peer1"), regex("(")}),
+      FsdbException);
+  EXPECT_THROW(
+      index_.add(6, SubscriptionPathIndex::ExtPath{raw("bgp"), OperPathElem()}),
+      FsdbException);
+  EXPECT_EQ(index_.numSubscriptions(), 5);
+  EXPECT_EQ(index_.match({"agent", "switchState"}), (Ids{1, 2, 3, 4}));
+  EXPECT_EQ(index_.match({"bgp", "peers", "peer1"}), Ids{});
+}
+
+TEST_F(SubscriptionPathIndexTest, route) {
+  OperDelta delta;
+  delta.protocol() = OperProtocol::BINARY;
+  delta.changes() = {
+      deltaUnit({"agent", "switchState", "portMaps", "eth1/1/1", "id"}),
+      deltaUnit({"agent", "switchState", "vlanMaps", "1"}),
+      deltaUnit({"agent", "switchState", "portMaps", "eth2/1/1", "id"}),
+      deltaUnit({"bgp"}),
+  };
+
+  auto deltas = index_.route(delta);
+  EXPECT_EQ(deltas.size(), 4);
+  using Paths = std::vector<std::vector<std::string>>;
+  auto expectPaths = [&](SubscriptionPathIndex::SubscriptionId id,
+                         const Paths& expected) {
+    ASSERT_EQ(deltas.count(id), 1);
+    EXPECT_EQ(*deltas[id].protocol(), OperProtocol::BINARY);
+    EXPECT_EQ(unitPaths(deltas[id]), expected);
+  };
+  expectPaths(
+      1,
+      {{"agent", "switchState", "portMaps", "eth1/1/1", "id"},
+       {"agent", "switchState", "portMaps", "eth2/1/1", "id"}});
+  expectPaths(
+      2,
+      {{"agent", "switchState", "portMaps", "eth1/1/1", "id"},
+       {"agent", "switchState", "portMaps", "eth2/1/1", "id"}});
+  expectPaths(3, {{"agent", "switchState", "portMaps", "eth1/1/1", "id"}});
+  expectPaths(4, {{"agent", "switchState", "vlanMaps", "1"}});
+  EXPECT_EQ(deltas.count(5), 0);
+}
+
+} // namespace facebook::fboss::fsdb::test
@@ -0,0 +1,224 @@
+// Copyright 2004-present Facebook. All Rights Reserved.
+#include "fboss/lib/ShardedTimeSeriesWithMinMax.h"
+
+#include <folly/concurrency/CacheLocality.h>
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+#include <thread>
+
+namespace facebook::fboss {
+
+namespace detail {
+/*
+ * Atomically replace the stored value if the new value is preferred
+ * by cmp, e.g. std::greater to keep the maximum.
+ */
+template <class T, class Compare>
+void atomicUpdate(std::atomic<T>& stored, T value, Compare cmp) {
+  T cur = stored.load(std::memory_order_relaxed);
+  while (cmp(value, cur) &&
+         !stored.compare_exchange_weak(
+             cur, value, std::memory_order_relaxed)) {
+  }
+}
+
+inline void atomicAdd(std::atomic<double>& stored, double value) {
+  double cur = stored.load(std::memory_order_relaxed);
+  while (!stored.compare_exchange_weak(
+      cur, cur + value, std::memory_order_relaxed)) {
+  }
+}
+} // namespace detail
+
+template <class ValueType>
+ShardedTimeSeriesWithMinMax<ValueType>::ShardedTimeSeriesWithMinMax(
+    Duration interval,
+    Duration bucketInterval,
+    size_t numShards)
+    : interval_(interval),
+      bucketInterval_(bucketInterval),
+      // One more bucket than the interval spans, so that the bucket being
+      // filled never overwrites one that is still within the interval.
+      numBuckets_(interval.count() / bucketInterval.count() + 1),
+      numShards_(
+          numShards
+              ? numShards
+              : std::max<size_t>(std::thread::hardware_concurrency(), 1)),
+      buckets_(std::make_unique<Bucket[]>(numBuckets_ * numShards_)) {
+  assert(interval.count() >= bucketInterval.count());
+  assert(bucketInterval.count() > 0);
+}
+
+template <class ValueType>
+int64_t ShardedTimeSeriesWithMinMax<ValueType>::toEpoch(Time t) const {
+  return std::chrono::duration_cast<Duration>(t.time_since_epoch()).count() /
+      bucketInterval_.count();
+}
+
+template <class ValueType>
+typename ShardedTimeSeriesWithMinMax<ValueType>::Time
+ShardedTimeSeriesWithMinMax<ValueType>::bucketStart(int64_t epoch) const {
+  return Time(epoch * bucketInterval_);
+}
+
+/*
+ * Returns the bucket of the calling thread's shard covering the epoch,
+ * resetting it first if it was last used for an older epoch.
+ */
+template <class ValueType>
+typename ShardedTimeSeriesWithMinMax<ValueType>::Bucket*
+ShardedTimeSeriesWithMinMax<ValueType>::getBucket(int64_t epoch) {
+  auto shard = folly::AccessSpreader<>::current(numShards_);
+  auto& bucket = buckets_[shard * numBuckets_ + epoch % numBuckets_];
+  while (true) {
+    auto cur = bucket.epoch.load(std::memory_order_acquire);
+    if (cur == epoch) {
+      return &bucket;
+    }
+    if (cur > epoch) {
+      // Already reused for a newer slice of time.
+      return nullptr;
+    }
+    if (cur == kResetting) {
+      std::this_thread::yield();
+      continue;
+    }
+    if (bucket.epoch.compare_exchange_weak(
+            cur, kResetting, std::memory_order_acq_rel)) {
+      bucket.max.store(
+          std::numeric_limits<ValueType>::lowest(), std::memory_order_relaxed);
+      bucket.min.store(
+          std::numeric_limits<ValueType>::max(), std::memory_order_relaxed);
+      bucket.sum.store(0, std::memory_order_relaxed);
+      bucket.count.store(0, std::memory_order_relaxed);
+      bucket.epoch.store(epoch, std::memory_order_release);
+      return &bucket;
+    }
+  }
+}
+
+template <class ValueType>
+void ShardedTimeSeriesWithMinMax<ValueType>::addValue(const ValueType& value) {
+  addValue(value, std::chrono::system_clock::now());
+}
+
+template <class ValueType>
+void ShardedTimeSeriesWithMinMax<ValueType>::addValue(
+    const ValueType& value,
+    Time t) {
+  if (t < std::chrono::system_clock::now() - interval_) {
+    return;
+  }
+  auto bucket = getBucket(toEpoch(t));
+  if (!bucket) {
+    return;
+  }
+  detail::atomicUpdate(bucket->max, value, std::greater<ValueType>());
+  detail::atomicUpdate(bucket->min, value, std::less<ValueType>());
+  detail::atomicAdd(bucket->sum, static_cast<double>(value));
+  bucket->count.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <class ValueType>
+typename ShardedTimeSeriesWithMinMax<ValueType>::Summary
+ShardedTimeSeriesWithMinMax<ValueType>::summarize(int64_t first, int64_t last)
+    const {
+  Summary summary;
+  for (size_t i = 0; i < numBuckets_ * numShards_; ++i) {
+    const auto& bucket = buckets_[i];
+    auto epoch = bucket.epoch.load(std::memory_order_acquire);
+    if (epoch < first || epoch > last) {
+      continue;
+    }
+    auto max = bucket.max.load(std::memory_order_relaxed);
+    auto min = bucket.min.load(std::memory_order_relaxed);
+    auto sum = bucket.sum.load(std::memory_order_relaxed);
+    auto count = bucket.count.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    // Skip buckets reset while we were reading them, or not yet
+    // holding a value.
+    if (bucket.epoch.load(std::memory_order_relaxed) != epoch || !count) {
+      continue;
+    }
+    summary.max = std::max(summary.max, max);
+    summary.min = std::min(summary.min, min);
+    summary.sum += sum;
+    summary.count += count;
+  }
+  return summary;
+}
+
+template <class ValueType>
+typename ShardedTimeSeriesWithMinMax<ValueType>::Summary
+ShardedTimeSeriesWithMinMax<ValueType>::summarizeWindow() const {
+  // Same as TimeSeriesWithMinMax, buckets which started more than an
+  // interval ago are out of the window.
+  auto first = toEpoch(std::chrono::system_clock::now() - interval_) + 1;
+  auto summary = summarize(first, std::numeric_limits<int64_t>::max());
+  if (!summary.count) {
+    throw std::runtime_error("Empty Buffer!");
+  }
+  return summary;
+}
+
+template <class ValueType>
+typename ShardedTimeSeriesWithMinMax<ValueType>::Summary
+ShardedTimeSeriesWithMinMax<ValueType>::summarizeRange(Time start, Time end)
+    const {
+  // Buckets starting within [start, end).
+  auto first = toEpoch(start);
+  if (bucketStart(first) < start) {
+    ++first;
+  }
+  auto last = toEpoch(end);
+  if (bucketStart(last) >= end) {
+    --last;
+  }
+  first = std::max(
+      first, toEpoch(std::chrono::system_clock::now() - interval_) + 1);
+  auto summary = summarize(first, last);
+  if (!summary.count) {
+    throw std::runtime_error("Bad range specified");
+  }
+  return summary;
+}
+
+template <class ValueType>
+ValueType ShardedTimeSeriesWithMinMax<ValueType>::getMax() const {
+  return summarizeWindow().max;
+}
+
+template <class ValueType>
+ValueType ShardedTimeSeriesWithMinMax<ValueType>::getMin() const {
+  return summarizeWindow().min;
+}
+
+template <class ValueType>
+double ShardedTimeSeriesWithMinMax<ValueType>::getAverage() const {
+  auto summary = summarizeWindow();
+  return summary.sum / summary.count;
+}
+
+template <class ValueType>
+ValueType ShardedTimeSeriesWithMinMax<ValueType>::getMax(Time start, Time end)
+    const {
+  return summarizeRange(start, end).max;
+}
+
+template <class ValueType>
+ValueType ShardedTimeSeriesWithMinMax<ValueType>::getMin(Time start, Time end)
+    const {
+  return summarizeRange(start, end).min;
+}
+
+template <class ValueType>
+double ShardedTimeSeriesWithMinMax<ValueType>::getAverage(
+    Time start,
+    Time end) const {
+  auto summary = summarizeRange(start, end);
+  return summary.sum / summary.count;
+}
+
+} // namespace facebook::fboss
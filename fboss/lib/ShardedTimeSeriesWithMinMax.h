@@ -0,0 +1,112 @@
+// Copyright 2004-present Facebook. All Rights Reserved.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace facebook::fboss {
+/*
+ * Variant of TimeSeriesWithMinMax meant for values sampled at a high rate
+ * from several threads, e.g. buffer or queue watermarks.
+ *
+ * Instead of a single locked buffer, values are recorded into one of
+ * several shards, picked by the CPU the calling thread is running on.
+ * Each shard is a ring of buckets made of atomics, so addValue never
+ * takes a lock. Queries merge the buckets of all the shards that fall
+ * within the time window, which makes them more expensive than adding
+ * a value; this is the intended trade off for data logging.
+ *
+ * A bucket covers a fixed, aligned slice of time. Once the ring wraps
+ * around, the bucket is reset by the first value added to it.
+ */
+template <class ValueType>
+class ShardedTimeSeriesWithMinMax {
+  static_assert(
+      std::is_arithmetic_v<ValueType>,
+      "Values need to be stored in atomics");
+
+ public:
+  using Time = std::chrono::time_point<std::chrono::system_clock>;
+  using Duration = std::chrono::milliseconds;
+
+  /*
+   * interval : Length of time to record over.
+   * bucketInterval : The granularity of the data.
+   * numShards : Number of shards, defaults to the number of CPUs.
+   */
+  explicit ShardedTimeSeriesWithMinMax(
+      Duration interval = std::chrono::seconds(60),
+      Duration bucketInterval = std::chrono::seconds(1),
+      size_t numShards = 0);
+
+  /*
+   * Add a value at the current time.
+   */
+  void addValue(const ValueType& value);
+
+  /*
+   * Add a value at a specified time. Values older than the interval
+   * are dropped.
+   */
+  void addValue(const ValueType& value, Time t);
+
+  /*
+   * Maximum, minimum and average of the values within the interval.
+   * Throw if no values were added within the interval.
+   */
+  ValueType getMax() const;
+  ValueType getMin() const;
+  double getAverage() const;
+
+  /*
+   * Same, over the buckets starting within [start, end). Throw if there
+   * are no such buckets.
+   */
+  ValueType getMax(Time start, Time end) const;
+  ValueType getMin(Time start, Time end) const;
+  double getAverage(Time start, Time end) const;
+
+ private:
+  static constexpr int64_t kEmpty = -1;
+  static constexpr int64_t kResetting = -2;
+
+  struct Bucket {
+    // Index of the slice of time this bucket covers, or kResetting
+    // while it is being reused.
+    std::atomic<int64_t> epoch{kEmpty};
+    std::atomic<ValueType> max{std::numeric_limits<ValueType>::lowest()};
+    std::atomic<ValueType> min{std::numeric_limits<ValueType>::max()};
+    std::atomic<double> sum{0};
+    std::atomic<uint64_t> count{0};
+  };
+
+  struct Summary {
+    ValueType max = std::numeric_limits<ValueType>::lowest();
+    ValueType min = std::numeric_limits<ValueType>::max();
+    double sum = 0;
+    uint64_t count = 0;
+  };
+
+  int64_t toEpoch(Time t) const;
+  Time bucketStart(int64_t epoch) const;
+  Bucket* getBucket(int64_t epoch);
+  // Merge the buckets of all shards whose epoch is within [first, last].
+  Summary summarize(int64_t first, int64_t last) const;
+  Summary summarizeWindow() const;
+  Summary summarizeRange(Time start, Time end) const;
+
+  const Duration interval_;
+  const Duration bucketInterval_;
+  const size_t numBuckets_;
+  const size_t numShards_;
+  // numShards_ rings of numBuckets_ buckets each.
+  std::unique_ptr<Bucket[]> buckets_;
+};
+
+} // namespace facebook::fboss
+#include "fboss/lib/ShardedTimeSeriesWithMinMax-inl.h"
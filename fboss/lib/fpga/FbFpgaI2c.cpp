@@ -14,9 +14,23 @@
 #include <algorithm>
 #include <thread>
 
+DEFINE_bool(
+    fpga_i2c_adaptive_wait,
+    true,
+    "Wait for FPGA I2C transactions to complete based on the completion "
+    "time of previous ones, rather than with a fixed 100us per byte sleep "
+    "and 1ms polls");
+
 namespace {
 constexpr uint32_t kFacebookFpgaRTCWriteBlock = 0x2000;
 constexpr uint32_t kFacebookFpgaRTCReadBlock = 0x3000;
+
+// Busy polling window once the expected completion time is near
+constexpr auto kI2cSpinTime = std::chrono::microseconds(20);
+constexpr auto kI2cMinPollInterval = std::chrono::microseconds(10);
+constexpr auto kI2cMaxPollInterval = std::chrono::milliseconds(1);
+// Weight of the last transaction in the expected completion time, as 1/n
+constexpr int kI2cExpectedTimeDecay = 8;
 } // unnamed namespace
 
 namespace facebook::fboss {
@@ -48,6 +62,13 @@ FbFpgaI2c::FbFpgaI2c(
 }
 
 bool FbFpgaI2c::waitForResponse(size_t len) {
+  if (FLAGS_fpga_i2c_adaptive_wait) {
+    return waitForResponseAdaptive(len);
+  }
+  return waitForResponseLegacy(len);
+}
+
+bool FbFpgaI2c::waitForResponseLegacy(size_t len) {
   I2cRtcStatus rtcStatus(version_);
   uint32_t retries = 20;
 
@@ -70,6 +91,67 @@ bool FbFpgaI2c::waitForResponse(size_t len) {
   return rtcStatus.dataUnion.desc0done;
 }
 
+std::chrono::nanoseconds FbFpgaI2c::getExpectedCompletionTime(
+    size_t len) const {
+  auto it = expectedTimeByLen_.find(len);
+  if (it != expectedTimeByLen_.end()) {
+    return it->second;
+  }
+  return std::chrono::nanoseconds(0);
+}
+
+bool FbFpgaI2c::waitForResponseAdaptive(size_t len) {
+  using namespace std::chrono;
+  I2cRtcStatus rtcStatus(version_);
+  auto start = steady_clock::now();
+  // Give up no sooner than the legacy wait would have
+  auto deadline = start + microseconds(100 * len) + milliseconds(20);
+
+  // Leave some slack, so that transactions running a bit faster than the
+  // previous ones get noticed soon after they complete
+  auto sleepTime = getExpectedCompletionTime(len) * 3 / 4;
+  if (sleepTime.count() > 0) {
+    std::this_thread::sleep_for(sleepTime);
+  }
+
+  auto spinUntil = steady_clock::now() + kI2cSpinTime;
+  auto pollInterval = duration_cast<nanoseconds>(kI2cMinPollInterval);
+  readReg(rtcStatus);
+  bool doneWhileSleeping =
+      sleepTime.count() > 0 && rtcStatus.dataUnion.desc0done;
+  auto now = steady_clock::now();
+  while (!rtcStatus.dataUnion.desc0done && !rtcStatus.dataUnion.desc0error &&
+         now < deadline) {
+    if (now >= spinUntil) {
+      std::this_thread::sleep_for(std::min<nanoseconds>(
+          pollInterval, duration_cast<nanoseconds>(deadline - now)));
+      pollInterval =
+          std::min<nanoseconds>(pollInterval * 2, kI2cMaxPollInterval);
+    }
+    readReg(rtcStatus);
+    now = steady_clock::now();
+  }
+
+  if (rtcStatus.dataUnion.desc0error) {
+    XLOG(DBG5) << "I2C read/write ops has error.";
+    return false;
+  }
+  if (!rtcStatus.dataUnion.desc0done) {
+    return false;
+  }
+
+  auto elapsed = duration_cast<nanoseconds>(now - start);
+  auto [it, inserted] = expectedTimeByLen_.emplace(len, elapsed);
+  if (doneWhileSleeping) {
+    // Took at most the time slept. Averaging that in would only shave an
+    // eighth of a quarter off the estimate per transaction.
+    it->second = std::min(it->second, elapsed);
+  } else if (!inserted) {
+    it->second += (elapsed - it->second) / kI2cExpectedTimeDecay;
+  }
+  return true;
+}
+
 uint8_t
 FbFpgaI2c::readByte(uint8_t channel, uint8_t offset, uint8_t i2cAddress) {
   uint8_t byte = 0;
@@ -104,6 +186,7 @@ void FbFpgaI2c::read(
   uint32_t readBlockAddr =
       getRegAddr(kFacebookFpgaRTCReadBlock, getRTCIOBlockSize());
 
+  auto start = std::chrono::steady_clock::now();
   if (!waitForResponse(descLower.dataUnion.len)) {
     // Increment the counter for I2C read transaction failure and
     // throw error
@@ -111,6 +194,8 @@ void FbFpgaI2c::read(
 
     throw FbFpgaI2cError("I2C read failed.");
   } else {
+    recordReadLatency(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start));
     for (int bytesRead = 0; bytesRead < buf.size(); bytesRead += 4) {
       uint32_t data = fpga_->read(readBlockAddr + bytesRead);
       std::memcpy(
@@ -167,6 +252,7 @@ void FbFpgaI2c::write(
   writeReg(descLower);
   writeReg(descUpper);
 
+  auto start = std::chrono::steady_clock::now();
   if (!waitForResponse(descLower.dataUnion.len)) {
     // Increment the counter for I2c write transaction failure and
     // throw error
@@ -174,6 +260,8 @@ void FbFpgaI2c::write(
 
     throw FbFpgaI2cError("I2C write failed.");
   }
+  recordWriteLatency(std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start));
   // Update the number of bytes write
   incrWriteBytes(buf.size());
 }
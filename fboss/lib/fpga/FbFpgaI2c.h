@@ -9,9 +9,14 @@
 #include <folly/Range.h>
 #include <folly/Synchronized.h>
 #include <folly/io/async/EventBase.h>
+#include <gflags/gflags.h>
 
 #include <stdint.h>
+#include <chrono>
 #include <thread>
+#include <unordered_map>
+
+DECLARE_bool(fpga_i2c_adaptive_wait);
 
 namespace facebook::fboss {
 inline uint8_t getI2cControllerIdx(uint8_t port) {
@@ -57,8 +62,22 @@ class FbFpgaI2c : public I2cController {
       folly::ByteRange buf,
       uint8_t i2cAddress = 0x50);
 
+  /* Completion time expected of a transaction of len bytes, as learned
+   * from the previous ones of that length, or 0 if nothing is learned yet.
+   * Exposed for testing.
+   */
+  std::chrono::nanoseconds getExpectedCompletionTime(size_t len) const;
+
  private:
   bool waitForResponse(size_t len);
+  // Fixed sleep of 100us per byte, then polls every 1ms
+  bool waitForResponseLegacy(size_t len);
+  /* Sleeps through most of the completion time learned from previous
+   * transactions of the same length, then spins on the status register for
+   * a little while before backing off exponentially. Lengths with nothing
+   * learned yet get polled from the start, to probe for the completion time.
+   */
+  bool waitForResponseAdaptive(size_t len);
   uint32_t getRegAddr(uint32_t regBase, uint32_t regIncr);
   uint32_t getRTCIOBlockSize();
 
@@ -74,6 +93,15 @@ class FbFpgaI2c : public I2cController {
 
   int rtcId_{-1};
   int version_{0};
+  /* Moving average of the completion time of successful transactions, per
+   * transaction length. Completion time is a fixed overhead plus a time per
+   * byte, so it is learned per length rather than scaled from a per byte
+   * average. Transceivers only get accessed with a handful of lengths.
+   * A transaction already complete once the sleep ends took at most the
+   * time slept, which replaces the average outright. New lengths get polled
+   * from the start rather than seeded with the legacy 100us per byte.
+   */
+  std::unordered_map<size_t, std::chrono::nanoseconds> expectedTimeByLen_;
 };
 
 class FbFpgaI2cController {
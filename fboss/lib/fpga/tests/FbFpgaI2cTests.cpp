@@ -0,0 +1,187 @@
+// Copyright 2004-present Facebook. All Rights Reserved.
+
+#include <gflags/gflags.h>
+#include <gtest/gtest.h>
+
+#include "fboss/lib/fpga/FbFpgaI2c.h"
+#include "fboss/lib/fpga/FbFpgaRegisters.h"
+
+using namespace std::chrono;
+
+namespace {
+constexpr auto kFakePhysicalAddr = 0xfdf00000;
+constexpr auto kFakeSize = 0x10000;
+constexpr auto kFpgaVersion = 0;
+constexpr auto kRtcId = 0;
+constexpr auto kPim = 2;
+constexpr auto kChannel = 1;
+
+// Transactions take a fixed overhead plus a time per byte
+constexpr auto kOverhead = milliseconds(1);
+constexpr auto kTimePerByte = microseconds(10);
+} // namespace
+
+namespace facebook::fboss {
+
+/*
+ * Fpga with a single RTC, which completes a transaction once its time has
+ * passed since the descriptor was written
+ */
+class FakeI2cFpgaDevice : public FpgaDevice {
+ public:
+  FakeI2cFpgaDevice() : FpgaDevice(kFakePhysicalAddr, kFakeSize) {}
+
+  void mmap() override {}
+
+  uint32_t read(uint32_t offset) const override {
+    if (offset != statusAddr_) {
+      return 0;
+    }
+    I2cRtcStatusDataUnion status;
+    status.reg = 0;
+    if (error_) {
+      status.desc0error = 1;
+    } else if (
+        steady_clock::now() >= issued_ + overhead_ + kTimePerByte * len_) {
+      status.desc0done = 1;
+    }
+    return status.reg;
+  }
+
+  void write(uint32_t offset, uint32_t value) override {
+    if (offset == descLowerAddr_) {
+      I2cDescriptorLowerDataUnion lower;
+      lower.reg = value;
+      len_ = lower.len;
+    } else if (offset == descUpperAddr_) {
+      issued_ = steady_clock::now();
+    }
+  }
+
+  void setError(bool error) {
+    error_ = error;
+  }
+
+  void setOverhead(nanoseconds overhead) {
+    overhead_ = overhead;
+  }
+
+ private:
+  const uint32_t descLowerAddr_ =
+      I2cDescriptorLower(kFpgaVersion).getBaseAddr();
+  const uint32_t descUpperAddr_ =
+      I2cDescriptorUpper(kFpgaVersion).getBaseAddr();
+  const uint32_t statusAddr_ = I2cRtcStatus(kFpgaVersion).getBaseAddr();
+
+  steady_clock::time_point issued_;
+  nanoseconds overhead_{kOverhead};
+  int len_{0};
+  bool error_{false};
+};
+
+class FbFpgaI2cTests : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    i2c_ = std::make_unique<FbFpgaI2c>(
+        std::make_unique<FpgaMemoryRegion>("i2c", &device_, 0, kFakeSize),
+        kRtcId,
+        kPim,
+        kFpgaVersion);
+    i2c_->resetStats();
+  }
+
+  void readBytes(size_t len) {
+    std::vector<uint8_t> buf(len);
+    i2c_->read(kChannel, 0, folly::MutableByteRange(buf.data(), len));
+  }
+
+  int64_t numReadLatencies() const {
+    int64_t total = 0;
+    auto stats = i2c_->getI2cControllerPlatformStats();
+    for (auto count : *stats.readLatencyUsBuckets_()) {
+      total += count;
+    }
+    return total;
+  }
+
+  gflags::FlagSaver flagSaver_;
+  FakeI2cFpgaDevice device_;
+  std::unique_ptr<FbFpgaI2c> i2c_;
+};
+
+TEST_F(FbFpgaI2cTests, adaptiveWaitLearnsPerLength) {
+  FLAGS_fpga_i2c_adaptive_wait = true;
+  // Nothing learned yet
+  EXPECT_EQ(i2c_->getExpectedCompletionTime(1), nanoseconds(0));
+  EXPECT_EQ(i2c_->getExpectedCompletionTime(128), nanoseconds(0));
+
+  for (int i = 0; i < 10; ++i) {
+    readBytes(1);
+    readBytes(128);
+  }
+  EXPECT_EQ(numReadLatencies(), 20);
+
+  // Completion time is learned for each length, overhead included, rather
+  // than scaled from a time per byte
+  auto shortRead = i2c_->getExpectedCompletionTime(1);
+  auto longRead = i2c_->getExpectedCompletionTime(128);
+  EXPECT_GE(shortRead, kOverhead + kTimePerByte);
+  EXPECT_GE(longRead, kOverhead + kTimePerByte * 128);
+  EXPECT_LT(shortRead, longRead);
+  // Well within the overall timeout of a transaction
+  EXPECT_LT(shortRead, milliseconds(20));
+  EXPECT_LT(longRead, milliseconds(20));
+
+  // Other lengths are still unknown
+  EXPECT_EQ(i2c_->getExpectedCompletionTime(4), nanoseconds(0));
+}
+
+TEST_F(FbFpgaI2cTests, adaptiveWaitRecoversFromOverestimate) {
+  FLAGS_fpga_i2c_adaptive_wait = true;
+  device_.setOverhead(milliseconds(5));
+  // The first transaction of a length polls from the start
+  readBytes(1);
+  auto expected = i2c_->getExpectedCompletionTime(1);
+  EXPECT_GE(expected, milliseconds(5));
+  EXPECT_LT(expected, milliseconds(8));
+
+  // Completes while sleeping through most of the estimate, so took at most
+  // the time slept
+  device_.setOverhead(kOverhead);
+  readBytes(1);
+  auto slept = i2c_->getExpectedCompletionTime(1);
+  EXPECT_GE(slept, expected * 3 / 4);
+  EXPECT_LT(slept, expected);
+
+  // A few transactions bring it down close to the actual completion time
+  for (int i = 0; i < 8; ++i) {
+    readBytes(1);
+  }
+  expected = i2c_->getExpectedCompletionTime(1);
+  EXPECT_GE(expected, kOverhead + kTimePerByte);
+  EXPECT_LT(expected, milliseconds(2));
+  EXPECT_EQ(numReadLatencies(), 10);
+}
+
+TEST_F(FbFpgaI2cTests, legacyWait) {
+  FLAGS_fpga_i2c_adaptive_wait = false;
+  readBytes(1);
+  EXPECT_EQ(numReadLatencies(), 1);
+  // Nothing learned
+  EXPECT_EQ(i2c_->getExpectedCompletionTime(1), nanoseconds(0));
+}
+
+TEST_F(FbFpgaI2cTests, failedTransaction) {
+  FLAGS_fpga_i2c_adaptive_wait = true;
+  device_.setError(true);
+  EXPECT_THROW(readBytes(1), FbFpgaI2cError);
+
+  auto stats = i2c_->getI2cControllerPlatformStats();
+  EXPECT_EQ(*stats.readTotal_(), 1);
+  EXPECT_EQ(*stats.readFailed_(), 1);
+  // Neither recorded nor learned from
+  EXPECT_EQ(numReadLatencies(), 0);
+  EXPECT_EQ(i2c_->getExpectedCompletionTime(1), nanoseconds(0));
+}
+
+} // namespace facebook::fboss
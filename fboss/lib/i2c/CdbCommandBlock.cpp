@@ -74,6 +74,46 @@ static void i2cWriteAndContinue(
 bool CdbCommandBlock::cmisRunCdbCommand(
     TransceiverI2CApi* bus,
     unsigned int modId) {
+  cmisIssueCdbCommand(bus, modId);
+
+  // Special handling for RUN command
+  if (this->cdbFields_.cdbCommandCode ==
+      htons(kCdbCommandFirmwareDownloadRun)) {
+    return true;
+  }
+
+  // Now read the CDB command status register till the status becomes success
+  // or fail
+  auto finishTime = std::chrono::steady_clock::now() +
+      std::chrono::microseconds(cdbCommandTimeoutUsec);
+  usleep(cdbCommandIntervalUsec);
+  while (true) {
+    auto result = cmisPollCdbCommand(bus, modId);
+    if (result.has_value()) {
+      return *result;
+    }
+    if (std::chrono::steady_clock::now() > finishTime) {
+      XLOG(INFO) << folly::sformat(
+          "cmisRunCdbCommand: Mod{:d}: CDB command {:#x} timed out",
+          modId,
+          ntohs(this->cdbFields_.cdbCommandCode));
+      return false;
+    }
+    usleep(cdbCommandIntervalUsec);
+  }
+}
+
+/*
+ * cmisIssueCdbCommand
+ *
+ * This function writes the command block to the module CDB memory and
+ * triggers the command by writing the op-code. It does not wait for the
+ * command to finish, so the caller can do I2C transactions to other modules
+ * while this one runs the command. cmisPollCdbCommand() gets the result
+ */
+void CdbCommandBlock::cmisIssueCdbCommand(
+    TransceiverI2CApi* bus,
+    unsigned int modId) {
   // Command block length is 8 plus lpl memory length
   int len = this->cdbFields_.cdbLplLength + 8;
 
@@ -126,45 +166,39 @@ bool CdbCommandBlock::cmisRunCdbCommand(
       bus, modId, TransceiverI2CApi::ADDR_QSFP, kCdbCommandMsbReg, 1, &buf[0]);
   i2cWriteAndContinue(
       bus, modId, TransceiverI2CApi::ADDR_QSFP, kCdbCommandLsbReg, 1, &buf[1]);
+}
 
-  // Special handling for RUN command
-  if (this->cdbFields_.cdbCommandCode ==
-      htons(kCdbCommandFirmwareDownloadRun)) {
-    return true;
-  }
-
-  // Now read the CDB command status register till the status becomes success
-  // or fail
+/*
+ * cmisPollCdbCommand
+ *
+ * This function reads the CDB command status register once. It returns
+ * std::nullopt while the module is still busy with the command issued by
+ * cmisIssueCdbCommand(), otherwise whether the command was successful. If
+ * the CDB has returned some information in the LPL memory then that gets read
+ * into this command block
+ */
+std::optional<bool> CdbCommandBlock::cmisPollCdbCommand(
+    TransceiverI2CApi* bus,
+    unsigned int modId) {
   uint8_t status = 0;
-  auto currTime = std::chrono::steady_clock::now();
-  auto finishTime = currTime + std::chrono::microseconds(cdbCommandTimeoutUsec);
-  usleep(cdbCommandIntervalUsec);
-  while (true) {
-    try {
-      bus->moduleRead(
-          modId,
-          {TransceiverI2CApi::ADDR_QSFP, kCdbCommandStatusReg, 1},
-          &status);
-    } catch (const std::exception& e) {
-      XLOG(INFO) << "read() raised exception: Sleep for 100ms and continue";
-      usleep(cdbCommandIntervalUsec);
-      status = kCdbCommandStatusBusyCmdCaptured;
-    }
-    if (status != kCdbCommandStatusBusyCmdCaptured &&
-        status != kCdbCommandStatusBusyCmdCheck &&
-        status != kCdbCommandStatusBusyCmdExec &&
-        status != kCdbCommandStatusBusyUnknown) {
-      break;
-    }
-
-    currTime = std::chrono::steady_clock::now();
-    if (currTime > finishTime) {
-      break;
-    }
-    usleep(cdbCommandIntervalUsec);
+  try {
+    bus->moduleRead(
+        modId,
+        {TransceiverI2CApi::ADDR_QSFP, kCdbCommandStatusReg, 1},
+        &status);
+  } catch (const std::exception& e) {
+    XLOG(INFO) << "read() raised exception: Retry the next poll";
+    return std::nullopt;
+  }
+  if (status == kCdbCommandStatusBusyCmdCaptured ||
+      status == kCdbCommandStatusBusyCmdCheck ||
+      status == kCdbCommandStatusBusyCmdExec ||
+      status == kCdbCommandStatusBusyUnknown) {
+    return std::nullopt;
   }
 
   if (status != kCdbCommandStatusSuccess) {
+    const uint8_t* buf = (uint8_t*)this;
     XLOG(INFO) << folly::sformat(
         "cmisRunCdbCommand: Mod{:d}: CDB command {:#x}.{:#x} not successful, status {:#x}",
         modId,
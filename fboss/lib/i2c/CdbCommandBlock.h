@@ -3,6 +3,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <utility>
 #include "fboss/lib/usb/TransceiverI2CApi.h"
 
@@ -64,6 +65,13 @@ class CdbCommandBlock {
 
   // Public function to run the CDB command on the module
   bool cmisRunCdbCommand(TransceiverI2CApi* bus, unsigned int modId);
+  // Start the CDB command on the module without waiting for it to finish
+  void cmisIssueCdbCommand(TransceiverI2CApi* bus, unsigned int modId);
+  // Check the status of the issued CDB command once. Returns std::nullopt
+  // while the module is busy, otherwise whether the command succeeded
+  std::optional<bool> cmisPollCdbCommand(
+      TransceiverI2CApi* bus,
+      unsigned int modId);
   // Provide response data to caller
   uint8_t getResponseData(uint8_t** pResponse);
 
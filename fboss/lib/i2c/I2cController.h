@@ -12,6 +12,11 @@
 #include <stdint.h>
 #include "fboss/lib/i2c/gen-cpp2/i2c_controller_stats_types.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
 namespace facebook::fboss {
 
 /* This is the base class for i2c controllers.
@@ -31,6 +36,8 @@ class I2cController {
     *i2cControllerPlatformStats_.writeTotal_() = 0;
     *i2cControllerPlatformStats_.writeFailed_() = 0;
     *i2cControllerPlatformStats_.writeBytes_() = 0;
+    i2cControllerPlatformStats_.readLatencyUsBuckets_()->clear();
+    i2cControllerPlatformStats_.writeLatencyUsBuckets_()->clear();
   }
   // Total number of reads
   void incrReadTotal(uint32_t count = 1) {
@@ -57,6 +64,42 @@ class I2cController {
     *i2cControllerPlatformStats_.writeBytes_() += count;
   }
 
+  // Completion latency of a read transaction
+  void recordReadLatency(std::chrono::microseconds latency) {
+    recordLatency(
+        *i2cControllerPlatformStats_.readLatencyUsBuckets_(), latency);
+  }
+  // Completion latency of a write transaction
+  void recordWriteLatency(std::chrono::microseconds latency) {
+    recordLatency(
+        *i2cControllerPlatformStats_.writeLatencyUsBuckets_(), latency);
+  }
+
+  /* Upper bound of the latency bucket the pct percentile falls in, from
+   * one of the latency histograms of I2cControllerStats. 0 if no
+   * transaction was recorded.
+   */
+  static std::chrono::microseconds latencyPercentile(
+      const std::vector<int64_t>& buckets,
+      double pct) {
+    int64_t total = 0;
+    for (auto count : buckets) {
+      total += count;
+    }
+    if (!total) {
+      return std::chrono::microseconds(0);
+    }
+    auto rank = std::max<int64_t>(1, std::ceil(total * pct / 100));
+    int64_t seen = 0;
+    for (size_t bucket = 0; bucket < buckets.size(); ++bucket) {
+      seen += buckets[bucket];
+      if (seen >= rank) {
+        return std::chrono::microseconds(int64_t(1) << bucket);
+      }
+    }
+    return std::chrono::microseconds(int64_t(1) << (buckets.size() - 1));
+  }
+
   /* Get the I2c transaction stats from the i2c controller
    */
   const I2cControllerStats getI2cControllerPlatformStats() const {
@@ -65,6 +108,21 @@ class I2cController {
   }
 
  private:
+  // Power of two buckets, up to 2^14us, i.e. ~16ms, and slower
+  static constexpr size_t kNumLatencyBuckets = 16;
+
+  static void recordLatency(
+      std::vector<int64_t>& buckets,
+      std::chrono::microseconds latency) {
+    buckets.resize(kNumLatencyBuckets);
+    size_t bucket = 0;
+    for (auto us = latency.count(); us > 0 && bucket < buckets.size() - 1;
+         us >>= 1) {
+      ++bucket;
+    }
+    ++buckets[bucket];
+  }
+
   // Platform i2c controller stats
   I2cControllerStats i2cControllerPlatformStats_;
 };
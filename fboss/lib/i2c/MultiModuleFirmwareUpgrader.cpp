@@ -0,0 +1,475 @@
+// Copyright 2004-present Facebook. All Rights Reserved.
+
+#include "fboss/lib/i2c/MultiModuleFirmwareUpgrader.h"
+
+#include <folly/Conv.h>
+#include <folly/Format.h>
+#include <folly/logging/xlog.h>
+
+#include <arpa/inet.h>
+#include <algorithm>
+#include <deque>
+#include <stdexcept>
+#include <thread>
+
+using std::chrono::steady_clock;
+
+namespace facebook::fboss {
+
+/*
+ * CmisMultiModuleFirmwareUpgrader
+ *
+ * Loads the image once for all the modules, gets the image properties the
+ * same way as CmisFirmwareUpgrader and records the progress every module
+ * starts from
+ */
+CmisMultiModuleFirmwareUpgrader::CmisMultiModuleFirmwareUpgrader(
+    TransceiverI2CApi* bus,
+    std::vector<std::vector<unsigned int>> modulesPerController,
+    std::unique_ptr<FbossFirmware> fbossFirmware,
+    const Options& options,
+    const std::map<unsigned int, ModuleUpgradeProgress>& resumeFrom)
+    : bus_(bus),
+      modulesPerController_(std::move(modulesPerController)),
+      options_(options),
+      fbossFirmware_(std::move(fbossFirmware)) {
+  auto lockedProgress = progress_.wlock();
+  for (const auto& modules : modulesPerController_) {
+    for (auto module : modules) {
+      auto it = resumeFrom.find(module);
+      (*lockedProgress)[module] =
+          it == resumeFrom.end() ? ModuleUpgradeProgress() : it->second;
+    }
+  }
+
+  // Check the FbossFirmware object first
+  if (fbossFirmware_.get() == nullptr) {
+    XLOG(ERR) << "FbossFirmware object is null, returning...";
+    return;
+  }
+  fbossFirmware_->load();
+  auto imageCursor = fbossFirmware_->getImage();
+  imageBuf_ = imageCursor.data();
+  imageLen_ = imageCursor.totalLength();
+
+  imageHeaderLen_ =
+      folly::to<uint32_t>(fbossFirmware_->getProperty("header_length"));
+  uint32_t msaPwVal =
+      folly::to<uint32_t>(fbossFirmware_->getProperty("msa_password"));
+  msaPassword_[0] = (msaPwVal & 0xFF000000) >> 24;
+  msaPassword_[1] = (msaPwVal & 0x00FF0000) >> 16;
+  msaPassword_[2] = (msaPwVal & 0x0000FF00) >> 8;
+  msaPassword_[3] = (msaPwVal & 0x000000FF);
+  appImage_ = fbossFirmware_->getProperty("image_type") == "application";
+}
+
+/*
+ * upgrade
+ *
+ * Runs the upgrade of each controller's modules in a thread of its own and
+ * waits for all of them to finish
+ */
+bool CmisMultiModuleFirmwareUpgrader::upgrade() {
+  if (imageBuf_ == nullptr) {
+    XLOG(ERR) << "No firmware image to upgrade the modules with";
+    return false;
+  }
+
+  auto begin = steady_clock::now();
+  std::vector<std::thread> threads;
+  for (const auto& modules : modulesPerController_) {
+    threads.emplace_back([this, &modules]() {
+      upgradeControllerModules(modules);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                       steady_clock::now() - begin)
+                       .count();
+
+  int numModules = 0, numUpgraded = 0;
+  for (const auto& [module, progress] : getProgress()) {
+    ++numModules;
+    if (progress.step == ModuleUpgradeStep::DONE) {
+      ++numUpgraded;
+    }
+  }
+  XLOG(INFO) << folly::sformat(
+      "upgrade: Upgraded {:d} of {:d} modules with a {:d} byte image in {:d}ms",
+      numUpgraded,
+      numModules,
+      imageLen_,
+      elapsedMs);
+  return numUpgraded == numModules;
+}
+
+std::map<unsigned int, ModuleUpgradeProgress>
+CmisMultiModuleFirmwareUpgrader::getProgress() const {
+  return progress_.copy();
+}
+
+/*
+ * upgradeControllerModules
+ *
+ * Upgrades the modules of one controller. Up to maxModulesPerController of
+ * them download the image at a time, each one stepped forward whenever the
+ * CDB command it runs could have finished. Between those the thread sleeps
+ * until the next module is due.
+ */
+void CmisMultiModuleFirmwareUpgrader::upgradeControllerModules(
+    const std::vector<unsigned int>& modules) {
+  std::deque<unsigned int> pending(modules.begin(), modules.end());
+  std::vector<std::unique_ptr<ModuleState>> active;
+
+  auto numDownloading = [&active]() {
+    return std::count_if(active.begin(), active.end(), [](const auto& state) {
+      return state->progress.step < ModuleUpgradeStep::RUN;
+    });
+  };
+  auto guardedStep = [this](ModuleState& state, auto&& func) {
+    try {
+      func(state);
+    } catch (const std::exception& ex) {
+      XLOG(ERR) << folly::sformat(
+          "upgradeControllerModules: Mod{:d}: {:s}", state.module, ex.what());
+      fail(state);
+    }
+    progress_.wlock()->at(state.module) = state.progress;
+  };
+
+  while (!pending.empty() || !active.empty()) {
+    // Start as many modules as the controller has room for
+    while (!pending.empty() &&
+           numDownloading() < options_.maxModulesPerController) {
+      auto state = std::make_unique<ModuleState>();
+      state->module = pending.front();
+      state->progress = progress_.rlock()->at(state->module);
+      pending.pop_front();
+      if (state->progress.step == ModuleUpgradeStep::DONE) {
+        continue;
+      }
+      guardedStep(*state, [this](auto& s) { startModule(s); });
+      active.push_back(std::move(state));
+    }
+
+    auto now = steady_clock::now();
+    for (auto& state : active) {
+      if (state->notBefore <= now) {
+        guardedStep(*state, [this](auto& s) { stepModule(s); });
+      }
+    }
+    active.erase(
+        std::remove_if(
+            active.begin(),
+            active.end(),
+            [](const auto& state) {
+              return state->progress.step == ModuleUpgradeStep::DONE ||
+                  state->progress.step == ModuleUpgradeStep::FAILED;
+            }),
+        active.end());
+
+    if (!pending.empty() &&
+        numDownloading() < options_.maxModulesPerController) {
+      continue;
+    }
+    if (!active.empty()) {
+      auto next = std::min_element(
+          active.begin(), active.end(), [](const auto& a, const auto& b) {
+            return a->notBefore < b->notBefore;
+          });
+      std::this_thread::sleep_until((*next)->notBefore);
+    }
+  }
+}
+
+/*
+ * startModule
+ *
+ * Starts the download with the module query, or continues writing the image
+ * from where the module's previous upgrade stopped
+ */
+void CmisMultiModuleFirmwareUpgrader::startModule(ModuleState& state) {
+  auto& progress = state.progress;
+  bool resumeImage = progress.step == ModuleUpgradeStep::DOWNLOAD_IMAGE ||
+      (progress.step == ModuleUpgradeStep::FAILED &&
+       progress.failedStep == ModuleUpgradeStep::DOWNLOAD_IMAGE);
+  resumeImage = resumeImage && progress.startCommandPayloadSize > 0 &&
+      progress.imageOffset >= progress.startCommandPayloadSize;
+
+  // Set the password to let the privileged operation of firmware download
+  writePassword(state.module);
+
+  if (resumeImage) {
+    XLOG(INFO) << folly::sformat(
+        "startModule: Mod{:d}: Resuming the image download at offset {:d}",
+        state.module,
+        progress.imageOffset);
+    issueImageChunk(state);
+    return;
+  }
+  XLOG(INFO) << folly::sformat(
+      "startModule: Mod{:d}: Starting to download the image with length {:d}",
+      state.module,
+      imageLen_);
+  progress = ModuleUpgradeProgress();
+  issueCommand(state, ModuleUpgradeStep::QUERY);
+}
+
+/*
+ * stepModule
+ *
+ * Checks on the CDB command the module runs and moves on to the next one
+ * once it finished. Modules that have been settling after the RUN or COMMIT
+ * command get their next command
+ */
+void CmisMultiModuleFirmwareUpgrader::stepModule(ModuleState& state) {
+  if (!state.awaitingResult) {
+    writePassword(state.module);
+    if (state.progress.step == ModuleUpgradeStep::RUN) {
+      issueCommand(state, ModuleUpgradeStep::COMMIT);
+    } else {
+      state.progress.step = ModuleUpgradeStep::DONE;
+      XLOG(INFO) << folly::sformat(
+          "stepModule: Mod{:d}: Firmware upgrade done", state.module);
+    }
+    return;
+  }
+
+  auto result = state.commandBlock.cmisPollCdbCommand(bus_, state.module);
+  auto now = steady_clock::now();
+  if (result.has_value()) {
+    handleCommandResult(state, *result);
+  } else if (now > state.deadline) {
+    XLOG(INFO) << folly::sformat(
+        "stepModule: Mod{:d}: CDB command {:#x} timed out",
+        state.module,
+        ntohs(state.commandBlock.getCdbCommandCode()));
+    handleCommandResult(state, false);
+  } else {
+    state.notBefore = now + options_.pollInterval;
+  }
+}
+
+/*
+ * handleCommandResult
+ *
+ * Moves the module on from the CDB command that finished, following the
+ * same steps as CmisFirmwareUpgrader::cmisModuleFirmwareDownload
+ */
+void CmisMultiModuleFirmwareUpgrader::handleCommandResult(
+    ModuleState& state,
+    bool success) {
+  state.awaitingResult = false;
+  auto& progress = state.progress;
+  auto& commandBlock = state.commandBlock;
+  const uint8_t* lplMemory = commandBlock.getCdbLplFlatMemory();
+
+  switch (progress.step) {
+    case ModuleUpgradeStep::QUERY:
+      // Query result will be in LPL memory at byte offset 2
+      if (success && commandBlock.getCdbRlplLength() >= 3 &&
+          lplMemory[2] == 0) {
+        XLOG(INFO) << folly::sformat(
+            "handleCommandResult: Mod{:d}: The firmware download feature is locked by vendor",
+            state.module);
+        fail(state);
+        return;
+      }
+      // The QUERY command can fail if the module is in bootloader mode
+      if (!success) {
+        XLOG(INFO) << folly::sformat(
+            "handleCommandResult: Mod{:d}: Could not get result from CDB Query command",
+            state.module);
+      }
+      issueCommand(state, ModuleUpgradeStep::FEATURE_INFO);
+      return;
+
+    case ModuleUpgradeStep::FEATURE_INFO:
+      if (success && commandBlock.getCdbRlplLength() >= 3) {
+        progress.startCommandPayloadSize = lplMemory[2];
+        progress.eplSupported = lplMemory[5] == 0x10 || lplMemory[5] == 0x11;
+      } else {
+        // Use the known header size if the module is in boot loader mode
+        XLOG(INFO) << folly::sformat(
+            "handleCommandResult: Mod{:d}: Could not get result from CDB Firmware Update Feature command",
+            state.module);
+        progress.startCommandPayloadSize = imageHeaderLen_;
+      }
+      if (imageLen_ < progress.startCommandPayloadSize) {
+        XLOG(INFO) << folly::sformat(
+            "handleCommandResult: Mod{:d}: The image length {:d} is smaller than startCommandPayloadSize {:d}",
+            state.module,
+            imageLen_,
+            progress.startCommandPayloadSize);
+        fail(state);
+        return;
+      }
+      issueCommand(state, ModuleUpgradeStep::DOWNLOAD_START);
+      return;
+
+    case ModuleUpgradeStep::DOWNLOAD_START:
+      if (!success) {
+        fail(state);
+        return;
+      }
+      progress.imageOffset = progress.startCommandPayloadSize;
+      issueImageChunk(state);
+      return;
+
+    case ModuleUpgradeStep::DOWNLOAD_IMAGE:
+      if (!success) {
+        if (++state.chunkRetries > options_.maxChunkRetries) {
+          fail(state);
+          return;
+        }
+        XLOG(INFO) << folly::sformat(
+            "handleCommandResult: Mod{:d}: Writing the image at offset {:d} again",
+            state.module,
+            progress.imageOffset);
+        issueImageChunk(state);
+        return;
+      }
+      state.chunkRetries = 0;
+      progress.imageOffset += state.chunkLen;
+      if (progress.imageOffset < imageLen_) {
+        issueImageChunk(state);
+      } else {
+        issueCommand(state, ModuleUpgradeStep::DOWNLOAD_COMPLETE);
+      }
+      return;
+
+    case ModuleUpgradeStep::DOWNLOAD_COMPLETE:
+      if (!success) {
+        fail(state);
+        return;
+      }
+      // Non App images like DSP image don't need last 2 steps (Run, Commit)
+      if (!appImage_) {
+        progress.step = ModuleUpgradeStep::DONE;
+        XLOG(INFO) << folly::sformat(
+            "handleCommandResult: Mod{:d}: Firmware upgrade done",
+            state.module);
+        return;
+      }
+      // The RUN command resets the module so there is no status to read
+      issueCommand(state, ModuleUpgradeStep::RUN);
+      settle(state, options_.runSettleTime);
+      return;
+
+    case ModuleUpgradeStep::COMMIT:
+      XLOG(INFO) << folly::sformat(
+          "handleCommandResult: Mod{:d}: Firmware commit command {:s}",
+          state.module,
+          success ? "successful" : "failed");
+      settle(state, options_.commitSettleTime);
+      return;
+
+    default:
+      return;
+  }
+}
+
+void CmisMultiModuleFirmwareUpgrader::issueCommand(
+    ModuleState& state,
+    ModuleUpgradeStep step) {
+  auto& commandBlock = state.commandBlock;
+  switch (step) {
+    case ModuleUpgradeStep::QUERY:
+      commandBlock.createCdbCmdModuleQuery();
+      break;
+    case ModuleUpgradeStep::FEATURE_INFO:
+      commandBlock.createCdbCmdGetFwFeatureInfo();
+      break;
+    case ModuleUpgradeStep::DOWNLOAD_START: {
+      int imageOffset;
+      commandBlock.createCdbCmdFwDownloadStart(
+          state.progress.startCommandPayloadSize,
+          imageLen_,
+          imageOffset,
+          imageBuf_);
+      break;
+    }
+    case ModuleUpgradeStep::DOWNLOAD_COMPLETE:
+      commandBlock.createCdbCmdFwDownloadComplete();
+      break;
+    case ModuleUpgradeStep::RUN:
+      commandBlock.createCdbCmdFwImageRun();
+      break;
+    case ModuleUpgradeStep::COMMIT:
+      commandBlock.createCdbCmdFwCommit();
+      break;
+    default:
+      throw std::invalid_argument(folly::sformat(
+          "No CDB command for firmware upgrade step {:d}",
+          static_cast<int>(step)));
+  }
+  sendCommand(state, step);
+}
+
+/*
+ * issueImageChunk
+ *
+ * Writes the next image chunk to the module, through EPL memory if the
+ * module supports it, and issues the download image command for it
+ */
+void CmisMultiModuleFirmwareUpgrader::issueImageChunk(ModuleState& state) {
+  auto& progress = state.progress;
+  int imageOffset = progress.imageOffset;
+  if (!progress.eplSupported) {
+    state.commandBlock.createCdbCmdFwDownloadImageLpl(
+        progress.startCommandPayloadSize,
+        imageLen_,
+        imageBuf_,
+        imageOffset,
+        state.chunkLen);
+  } else {
+    state.commandBlock.createCdbCmdFwDownloadImageEpl(
+        progress.startCommandPayloadSize,
+        imageLen_,
+        imageOffset,
+        state.chunkLen);
+    state.commandBlock.writeEplPayload(
+        bus_, state.module, imageBuf_, imageOffset, state.chunkLen);
+  }
+  sendCommand(state, ModuleUpgradeStep::DOWNLOAD_IMAGE);
+}
+
+void CmisMultiModuleFirmwareUpgrader::sendCommand(
+    ModuleState& state,
+    ModuleUpgradeStep step) {
+  state.commandBlock.cmisIssueCdbCommand(bus_, state.module);
+  state.progress.step = step;
+  state.awaitingResult = true;
+  auto now = steady_clock::now();
+  state.notBefore = now + options_.pollInterval;
+  state.deadline = now + options_.cdbCommandTimeout;
+}
+
+void CmisMultiModuleFirmwareUpgrader::settle(
+    ModuleState& state,
+    std::chrono::milliseconds settleTime) {
+  state.awaitingResult = false;
+  state.notBefore = steady_clock::now() + settleTime;
+}
+
+void CmisMultiModuleFirmwareUpgrader::fail(ModuleState& state) {
+  XLOG(INFO) << folly::sformat(
+      "fail: Mod{:d}: Firmware upgrade failed at step {:d}, image offset {:d}",
+      state.module,
+      static_cast<int>(state.progress.step),
+      state.progress.imageOffset);
+  state.progress.failedStep = state.progress.step;
+  state.progress.step = ModuleUpgradeStep::FAILED;
+  state.awaitingResult = false;
+}
+
+void CmisMultiModuleFirmwareUpgrader::writePassword(unsigned int module) {
+  bus_->moduleWrite(
+      module,
+      {TransceiverI2CApi::ADDR_QSFP, kModulePasswordEntryReg, 4},
+      msaPassword_.data());
+}
+
+} // namespace facebook::fboss
@@ -0,0 +1,128 @@
+// Copyright 2004-present Facebook. All Rights Reserved.
+
+#pragma once
+
+#include <folly/Synchronized.h>
+#include <array>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <vector>
+#include "fboss/lib/firmware_storage/FbossFirmware.h"
+#include "fboss/lib/i2c/CdbCommandBlock.h"
+#include "fboss/lib/usb/TransceiverI2CApi.h"
+
+namespace facebook::fboss {
+
+// Steps of the CDB firmware download on a module, in order
+enum class ModuleUpgradeStep {
+  NOT_STARTED,
+  QUERY,
+  FEATURE_INFO,
+  DOWNLOAD_START,
+  DOWNLOAD_IMAGE,
+  DOWNLOAD_COMPLETE,
+  RUN,
+  COMMIT,
+  DONE,
+  FAILED,
+};
+
+// Firmware upgrade progress of a module. A failed upgrade can be resumed from
+// it by passing it to a new CmisMultiModuleFirmwareUpgrader
+struct ModuleUpgradeProgress {
+  ModuleUpgradeStep step{ModuleUpgradeStep::NOT_STARTED};
+  // Step that failed when step is FAILED
+  ModuleUpgradeStep failedStep{ModuleUpgradeStep::NOT_STARTED};
+  // Image bytes acknowledged by the module, header included
+  int imageOffset{0};
+  // Image header length and EPL support reported by the module
+  uint8_t startCommandPayloadSize{0};
+  bool eplSupported{false};
+};
+
+/*
+ * This class upgrades the firmware of many CMIS modules with the same image.
+ * The modules are given in buckets, one for each I2C controller, and every
+ * controller gets a thread of its own like wedge_qsfp_util used to do.
+ *
+ * Within a controller the upgrade is pipelined: instead of waiting for each
+ * CDB command to finish, up to maxModulesPerController modules download at
+ * the same time and the controller thread writes EPL data and issues
+ * commands to one module while the others are busy running theirs. The
+ * settle time after the RUN and COMMIT commands doesn't hold the controller
+ * either.
+ */
+class CmisMultiModuleFirmwareUpgrader {
+ public:
+  struct Options {
+    // Modules of one controller downloading the image at the same time
+    int maxModulesPerController{1};
+    // Interval of the CDB command status reads
+    std::chrono::milliseconds pollInterval{100};
+    std::chrono::milliseconds cdbCommandTimeout{10000};
+    // Time for the module to come up after the RUN and COMMIT commands
+    std::chrono::milliseconds runSettleTime{10000};
+    std::chrono::milliseconds commitSettleTime{50000};
+    // Times a failed image chunk is written again before giving up
+    int maxChunkRetries{3};
+  };
+
+  // The caller is responsible for interfacing with Firmware Store and
+  // provide the FbossFirmware object. Modules found in resumeFrom continue
+  // from their progress there
+  CmisMultiModuleFirmwareUpgrader(
+      TransceiverI2CApi* bus,
+      std::vector<std::vector<unsigned int>> modulesPerController,
+      std::unique_ptr<FbossFirmware> fbossFirmware,
+      const Options& options,
+      const std::map<unsigned int, ModuleUpgradeProgress>& resumeFrom = {});
+
+  // Upgrade all the modules. Returns true if all of them were upgraded
+  bool upgrade();
+
+  // Progress of every module, can be called while upgrade() runs
+  std::map<unsigned int, ModuleUpgradeProgress> getProgress() const;
+
+ private:
+  struct ModuleState {
+    unsigned int module;
+    ModuleUpgradeProgress progress;
+    CdbCommandBlock commandBlock;
+    // Whether a CDB command was issued and its result is not read yet
+    bool awaitingResult{false};
+    std::chrono::steady_clock::time_point notBefore;
+    std::chrono::steady_clock::time_point deadline;
+    // Length of the image chunk being written
+    int chunkLen{0};
+    int chunkRetries{0};
+  };
+
+  void upgradeControllerModules(const std::vector<unsigned int>& modules);
+
+  void startModule(ModuleState& state);
+  void stepModule(ModuleState& state);
+  void handleCommandResult(ModuleState& state, bool success);
+  // Create the CDB command of step and issue it
+  void issueCommand(ModuleState& state, ModuleUpgradeStep step);
+  void issueImageChunk(ModuleState& state);
+  void sendCommand(ModuleState& state, ModuleUpgradeStep step);
+  void settle(ModuleState& state, std::chrono::milliseconds settleTime);
+  void fail(ModuleState& state);
+  void writePassword(unsigned int module);
+
+  TransceiverI2CApi* bus_;
+  const std::vector<std::vector<unsigned int>> modulesPerController_;
+  const Options options_;
+  std::unique_ptr<FbossFirmware> fbossFirmware_;
+  // Image shared by all the modules
+  const uint8_t* imageBuf_{nullptr};
+  int imageLen_{0};
+  std::array<uint8_t, 4> msaPassword_;
+  uint32_t imageHeaderLen_{0};
+  bool appImage_{true};
+
+  folly::Synchronized<std::map<unsigned int, ModuleUpgradeProgress>> progress_;
+};
+
+} // namespace facebook::fboss
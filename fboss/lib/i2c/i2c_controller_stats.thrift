@@ -11,4 +11,9 @@ struct I2cControllerStats {
   5: i64 writeTotal_ = STAT_UNINITIALIZED;
   6: i64 writeFailed_ = STAT_UNINITIALIZED;
   7: i64 writeBytes_ = STAT_UNINITIALIZED;
+  // Transaction completion latency histograms. Bucket 0 counts transactions
+  // done in under 1us, bucket i > 0 the ones done in [2^(i-1), 2^i) us, the
+  // last bucket everything slower.
+  8: list<i64> readLatencyUsBuckets_;
+  9: list<i64> writeLatencyUsBuckets_;
 }
@@ -0,0 +1,60 @@
+// Copyright 2004-present Facebook. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include "fboss/lib/i2c/I2cController.h"
+
+using std::chrono::microseconds;
+
+namespace facebook::fboss {
+
+TEST(I2cControllerTests, recordLatency) {
+  I2cController controller("testController");
+  controller.recordReadLatency(microseconds(0));
+  controller.recordReadLatency(microseconds(1));
+  controller.recordReadLatency(microseconds(3));
+  controller.recordReadLatency(microseconds(300));
+  // past the last bucket
+  controller.recordReadLatency(microseconds(1000000));
+  controller.recordWriteLatency(microseconds(8));
+
+  auto stats = controller.getI2cControllerPlatformStats();
+  const auto& reads = *stats.readLatencyUsBuckets_();
+  ASSERT_EQ(reads.size(), 16);
+  EXPECT_EQ(reads[0], 1); // < 1us
+  EXPECT_EQ(reads[1], 1); // [1, 2)us
+  EXPECT_EQ(reads[2], 1); // [2, 4)us
+  EXPECT_EQ(reads[9], 1); // [256, 512)us
+  EXPECT_EQ(reads[15], 1);
+  int64_t total = 0;
+  for (auto count : reads) {
+    total += count;
+  }
+  EXPECT_EQ(total, 5);
+
+  const auto& writes = *stats.writeLatencyUsBuckets_();
+  ASSERT_EQ(writes.size(), 16);
+  EXPECT_EQ(writes[4], 1); // [8, 16)us
+
+  controller.resetStats();
+  stats = controller.getI2cControllerPlatformStats();
+  EXPECT_TRUE(stats.readLatencyUsBuckets_()->empty());
+  EXPECT_TRUE(stats.writeLatencyUsBuckets_()->empty());
+}
+
+TEST(I2cControllerTests, latencyPercentile) {
+  EXPECT_EQ(I2cController::latencyPercentile({}, 50), microseconds(0));
+  EXPECT_EQ(I2cController::latencyPercentile({0, 0, 0}, 99), microseconds(0));
+
+  // 90 transactions under 8us, 10 under 1024us
+  std::vector<int64_t> buckets(16, 0);
+  buckets[3] = 90;
+  buckets[10] = 10;
+  EXPECT_EQ(I2cController::latencyPercentile(buckets, 0), microseconds(8));
+  EXPECT_EQ(I2cController::latencyPercentile(buckets, 50), microseconds(8));
+  EXPECT_EQ(I2cController::latencyPercentile(buckets, 90), microseconds(8));
+  EXPECT_EQ(I2cController::latencyPercentile(buckets, 91), microseconds(1024));
+  EXPECT_EQ(
+      I2cController::latencyPercentile(buckets, 100), microseconds(1024));
+}
+
+} // namespace facebook::fboss
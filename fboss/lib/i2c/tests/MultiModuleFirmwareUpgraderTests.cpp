@@ -0,0 +1,372 @@
+// Copyright 2004-present Facebook. All Rights Reserved.
+
+#include <folly/Conv.h>
+#include <folly/FileUtil.h>
+#include <folly/experimental/TestUtil.h>
+#include <folly/logging/xlog.h>
+#include <gtest/gtest.h>
+#include "fboss/lib/i2c/MultiModuleFirmwareUpgrader.h"
+
+#include <mutex>
+#include <set>
+#include <thread>
+
+using std::chrono::steady_clock;
+
+namespace facebook::fboss {
+
+namespace {
+
+constexpr uint8_t kImageHeaderLen = 64;
+constexpr uint8_t kCdbStatusSuccess = 0x01;
+constexpr uint8_t kCdbStatusBusy = 0x83;
+constexpr uint8_t kCdbStatusFailed = 0x46;
+
+uint32_t readBe32(const uint8_t* buf) {
+  return (buf[0] << 24) | (buf[1] << 16) | (buf[2] << 8) | buf[3];
+}
+
+/*
+ * Fake I2C bus with CMIS modules behind it that run the CDB firmware
+ * download commands. Every CDB command keeps the module busy for
+ * commandLatency and every I2C transaction holds the module's controller for
+ * transactionTime, which is what bounds the upgrade throughput on hardware.
+ */
+class FakeCmisModuleBus : public TransceiverI2CApi {
+ public:
+  struct FakeModule {
+    uint8_t page{0};
+    // CDB page 0x9f and EPL pages 0xa0-0xaf
+    std::array<uint8_t, 128> cdbMemory{};
+    std::array<uint8_t, 2048> eplMemory{};
+    steady_clock::time_point busyUntil;
+    uint8_t status{kCdbStatusSuccess};
+    std::vector<uint8_t> rlpl;
+    bool eplSupported{true};
+    // Image commands, counted from 1, that fail
+    std::set<int> failImageCommands;
+    int numImageCommands{0};
+    // What the module got downloaded
+    std::vector<uint8_t> header;
+    std::vector<uint8_t> image;
+    int numStarts{0};
+    int numCompletes{0};
+    int numRuns{0};
+    int numCommits{0};
+  };
+
+  FakeCmisModuleBus(
+      int numModules,
+      int modulesPerController,
+      std::chrono::microseconds commandLatency,
+      std::chrono::microseconds transactionTime)
+      : modules_(numModules + 1),
+        controllers_((numModules + modulesPerController - 1) /
+                     modulesPerController),
+        modulesPerController_(modulesPerController),
+        commandLatency_(commandLatency),
+        transactionTime_(transactionTime) {}
+
+  void open() override {}
+  void close() override {}
+  void verifyBus(bool /* autoReset */) override {}
+  bool isPresent(unsigned int /* module */) override {
+    return true;
+  }
+  void scanPresence(
+      std::map<int32_t, ModulePresence>& /* presences */) override {}
+
+  void moduleRead(
+      unsigned int module,
+      const TransceiverAccessParameter& param,
+      uint8_t* buf) override {
+    std::lock_guard<std::mutex> g(controllers_[controllerOf(module)]);
+    std::this_thread::sleep_for(transactionTime_);
+    auto& fake = modules_.at(module);
+    for (int i = 0; i < param.len; ++i) {
+      auto reg = param.offset + i;
+      if (reg == 37) {
+        buf[i] =
+            steady_clock::now() < fake.busyUntil ? kCdbStatusBusy : fake.status;
+      } else if (reg == 134 && fake.page == 0x9f) {
+        buf[i] = fake.rlpl.size();
+      } else if (
+          reg >= 136 && fake.page == 0x9f &&
+          reg - 136 < static_cast<int>(fake.rlpl.size())) {
+        buf[i] = fake.rlpl[reg - 136];
+      } else {
+        buf[i] = 0;
+      }
+    }
+  }
+
+  void moduleWrite(
+      unsigned int module,
+      const TransceiverAccessParameter& param,
+      const uint8_t* buf) override {
+    std::lock_guard<std::mutex> g(controllers_[controllerOf(module)]);
+    std::this_thread::sleep_for(transactionTime_);
+    auto& fake = modules_.at(module);
+    for (int i = 0; i < param.len; ++i) {
+      auto reg = param.offset + i;
+      if (reg == 127) {
+        fake.page = buf[i];
+      } else if (reg >= 128 && fake.page == 0x9f) {
+        fake.cdbMemory[reg - 128] = buf[i];
+        // Writing the command code LSB runs the command
+        if (reg == 129) {
+          runCommand(fake);
+        }
+      } else if (reg >= 128 && fake.page >= 0xa0 && fake.page <= 0xaf) {
+        fake.eplMemory[(fake.page - 0xa0) * 128 + reg - 128] = buf[i];
+      }
+    }
+  }
+
+  FakeModule& getModule(unsigned int module) {
+    return modules_.at(module);
+  }
+
+ private:
+  int controllerOf(unsigned int module) const {
+    return (module - 1) / modulesPerController_;
+  }
+
+  void runCommand(FakeModule& fake) {
+    uint16_t code = (fake.cdbMemory[0] << 8) | fake.cdbMemory[1];
+    uint16_t eplLen = (fake.cdbMemory[2] << 8) | fake.cdbMemory[3];
+    uint8_t lplLen = fake.cdbMemory[4];
+    const uint8_t* lpl = &fake.cdbMemory[8];
+    fake.status = kCdbStatusSuccess;
+    fake.rlpl.clear();
+    fake.busyUntil = steady_clock::now() + commandLatency_;
+
+    auto writeImage = [&fake](uint32_t address, const uint8_t* data, int len) {
+      if (address + len > fake.image.size()) {
+        fake.status = kCdbStatusFailed;
+        return;
+      }
+      std::copy(data, data + len, fake.image.begin() + address);
+    };
+
+    switch (code) {
+      case 0x0000:
+        // Firmware download is not locked
+        fake.rlpl = {0, 0, 1};
+        break;
+      case 0x0041:
+        fake.rlpl = {
+            0, 0, kImageHeaderLen, 0, 0, uint8_t(fake.eplSupported ? 0x11 : 0)};
+        break;
+      case 0x0101:
+        ++fake.numStarts;
+        fake.header.assign(lpl + 8, lpl + lplLen);
+        fake.image.assign(readBe32(lpl) - fake.header.size(), 0);
+        break;
+      case 0x0103:
+      case 0x0104:
+        if (fake.failImageCommands.count(++fake.numImageCommands)) {
+          fake.status = kCdbStatusFailed;
+        } else if (code == 0x0103) {
+          writeImage(readBe32(lpl), lpl + 4, lplLen - 4);
+        } else {
+          writeImage(readBe32(lpl), fake.eplMemory.data(), eplLen);
+        }
+        break;
+      case 0x0107:
+        ++fake.numCompletes;
+        break;
+      case 0x0109:
+        ++fake.numRuns;
+        break;
+      case 0x010a:
+        ++fake.numCommits;
+        break;
+      default:
+        fake.status = kCdbStatusFailed;
+    }
+  }
+
+  std::vector<FakeModule> modules_;
+  std::vector<std::mutex> controllers_;
+  const int modulesPerController_;
+  const std::chrono::microseconds commandLatency_;
+  const std::chrono::microseconds transactionTime_;
+};
+
+} // namespace
+
+class MultiModuleFirmwareUpgraderTests : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    setImage(8 * 1024, false);
+    // exercise pipelining within a controller
+    options_.maxModulesPerController = 2;
+    options_.pollInterval = std::chrono::milliseconds(5);
+    options_.runSettleTime = std::chrono::milliseconds(10);
+    options_.commitSettleTime = std::chrono::milliseconds(10);
+  }
+
+  void setImage(int imageLen, bool appImage) {
+    image_.resize(imageLen);
+    for (int i = 0; i < imageLen; ++i) {
+      image_[i] = (i * 7 + i / 251) & 0xff;
+    }
+    folly::writeFile(image_, imagePath_.c_str());
+    appImage_ = appImage;
+  }
+
+  std::unique_ptr<FakeCmisModuleBus> makeBus(
+      int numModules,
+      int modulesPerController) {
+    return std::make_unique<FakeCmisModuleBus>(
+        numModules,
+        modulesPerController,
+        std::chrono::milliseconds(20),
+        std::chrono::microseconds(50));
+  }
+
+  std::unique_ptr<FbossFirmware> makeFirmware() {
+    FbossFirmware::FwAttributes firmwareAttr;
+    firmwareAttr.filename = imagePath_;
+    firmwareAttr.properties["msa_password"] = "4113";
+    firmwareAttr.properties["header_length"] =
+        folly::to<std::string>(kImageHeaderLen);
+    firmwareAttr.properties["image_type"] =
+        appImage_ ? "application" : "dsp";
+    return std::make_unique<FbossFirmware>(firmwareAttr);
+  }
+
+  void expectImageDownloaded(FakeCmisModuleBus* bus, unsigned int module) {
+    const auto& fake = bus->getModule(module);
+    EXPECT_EQ(
+        fake.header,
+        std::vector<uint8_t>(
+            image_.begin(), image_.begin() + kImageHeaderLen));
+    EXPECT_EQ(
+        fake.image,
+        std::vector<uint8_t>(image_.begin() + kImageHeaderLen, image_.end()));
+    EXPECT_EQ(fake.numCompletes, 1);
+  }
+
+  CmisMultiModuleFirmwareUpgrader::Options options_;
+  std::vector<uint8_t> image_;
+  bool appImage_{false};
+
+ private:
+  folly::test::TemporaryDirectory tmpDir_;
+  std::string imagePath_ = tmpDir_.path().string() + "/image.bin";
+};
+
+TEST_F(MultiModuleFirmwareUpgraderTests, downloadsImageToAllModules) {
+  setImage(4096, false);
+  auto bus = makeBus(8, 4);
+  // Module 8 takes the image through LPL memory
+  bus->getModule(8).eplSupported = false;
+  CmisMultiModuleFirmwareUpgrader upgrader(
+      bus.get(), {{1, 2, 3, 4}, {5, 6, 7, 8}}, makeFirmware(), options_);
+  EXPECT_TRUE(upgrader.upgrade());
+
+  for (unsigned int module = 1; module <= 8; ++module) {
+    expectImageDownloaded(bus.get(), module);
+    EXPECT_EQ(bus->getModule(module).numStarts, 1);
+    // DSP images are not run and committed
+    EXPECT_EQ(bus->getModule(module).numRuns, 0);
+    auto progress = upgrader.getProgress().at(module);
+    EXPECT_EQ(progress.step, ModuleUpgradeStep::DONE);
+    EXPECT_EQ(progress.imageOffset, static_cast<int>(image_.size()));
+  }
+  EXPECT_TRUE(upgrader.getProgress().at(7).eplSupported);
+  EXPECT_FALSE(upgrader.getProgress().at(8).eplSupported);
+}
+
+TEST_F(MultiModuleFirmwareUpgraderTests, appImageRunsAndCommits) {
+  setImage(4096, true);
+  auto bus = makeBus(2, 2);
+  CmisMultiModuleFirmwareUpgrader upgrader(
+      bus.get(), {{1, 2}}, makeFirmware(), options_);
+  EXPECT_TRUE(upgrader.upgrade());
+
+  for (unsigned int module = 1; module <= 2; ++module) {
+    expectImageDownloaded(bus.get(), module);
+    EXPECT_EQ(bus->getModule(module).numRuns, 1);
+    EXPECT_EQ(bus->getModule(module).numCommits, 1);
+  }
+}
+
+TEST_F(MultiModuleFirmwareUpgraderTests, retriesFailedImageChunk) {
+  auto bus = makeBus(2, 2);
+  bus->getModule(2).failImageCommands = {3, 4};
+  CmisMultiModuleFirmwareUpgrader upgrader(
+      bus.get(), {{1, 2}}, makeFirmware(), options_);
+  EXPECT_TRUE(upgrader.upgrade());
+
+  expectImageDownloaded(bus.get(), 1);
+  expectImageDownloaded(bus.get(), 2);
+  EXPECT_EQ(bus->getModule(2).numStarts, 1);
+}
+
+TEST_F(MultiModuleFirmwareUpgraderTests, resumesFailedUpgrade) {
+  auto bus = makeBus(2, 2);
+  bus->getModule(2).failImageCommands = {3};
+  options_.maxChunkRetries = 0;
+  std::map<unsigned int, ModuleUpgradeProgress> progress;
+  {
+    CmisMultiModuleFirmwareUpgrader upgrader(
+        bus.get(), {{1, 2}}, makeFirmware(), options_);
+    EXPECT_FALSE(upgrader.upgrade());
+    progress = upgrader.getProgress();
+  }
+  EXPECT_EQ(progress[1].step, ModuleUpgradeStep::DONE);
+  EXPECT_EQ(progress[2].step, ModuleUpgradeStep::FAILED);
+  EXPECT_EQ(progress[2].failedStep, ModuleUpgradeStep::DOWNLOAD_IMAGE);
+  // Two EPL chunks made it to the module
+  EXPECT_EQ(progress[2].imageOffset, kImageHeaderLen + 2 * 2048);
+
+  CmisMultiModuleFirmwareUpgrader upgrader(
+      bus.get(), {{1, 2}}, makeFirmware(), options_, progress);
+  EXPECT_TRUE(upgrader.upgrade());
+  expectImageDownloaded(bus.get(), 2);
+  // Neither module started over
+  EXPECT_EQ(bus->getModule(1).numStarts, 1);
+  EXPECT_EQ(bus->getModule(2).numStarts, 1);
+  EXPECT_EQ(bus->getModule(1).numCompletes, 1);
+}
+
+/*
+ * Upgrade throughput of the same modules with one module downloading per
+ * controller at a time, as the per controller threads of wedge_qsfp_util
+ * used to, and with the downloads of a controller pipelined
+ */
+TEST_F(MultiModuleFirmwareUpgraderTests, pipelinedUpgradeThroughput) {
+  constexpr int kNumModules = 8;
+  std::vector<std::vector<unsigned int>> controllers = {
+      {1, 2, 3, 4}, {5, 6, 7, 8}};
+
+  auto runUpgrade = [&](int maxModulesPerController) {
+    auto bus = makeBus(kNumModules, 4);
+    auto options = options_;
+    options.maxModulesPerController = maxModulesPerController;
+    CmisMultiModuleFirmwareUpgrader upgrader(
+        bus.get(), controllers, makeFirmware(), options);
+    auto begin = steady_clock::now();
+    EXPECT_TRUE(upgrader.upgrade());
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        steady_clock::now() - begin);
+    for (unsigned int module = 1; module <= kNumModules; ++module) {
+      expectImageDownloaded(bus.get(), module);
+    }
+    XLOG(INFO) << maxModulesPerController
+               << " modules per controller: " << kNumModules * image_.size()
+               << " bytes in " << elapsed.count() << "ms, "
+               << kNumModules * image_.size() / std::max(elapsed.count(), 1L)
+               << " KB/s";
+    return elapsed;
+  };
+
+  auto serial = runUpgrade(1);
+  auto pipelined = runUpgrade(4);
+  EXPECT_LT(pipelined, serial);
+}
+
+} // namespace facebook::fboss
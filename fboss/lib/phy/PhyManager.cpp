@@ -11,6 +11,7 @@
 #include "fboss/lib/phy/ExternalPhy.h"
 #include "fboss/lib/phy/gen-cpp2/phy_types.h"
 
+#include <folly/futures/FutureSplitter.h>
 #include <folly/json.h>
 #include <folly/logging/xlog.h>
 #include <thrift/lib/cpp/util/EnumUtils.h>
@@ -22,6 +23,11 @@ DEFINE_bool(
     init_pim_xphys,
     true,
     "Initialize pim xphys after creating xphy map");
+DEFINE_bool(
+    xphy_pipelined_stats_collection,
+    false,
+    "Collect the xphy stats of all ports of a pim in a single job on the pim "
+    "thread, and publish the PhyInfos of all pims in one batch");
 
 namespace {
 // Key of the portToCacheInfo map in warmboot state cache
@@ -529,7 +535,12 @@ void PhyManager::setPortToExternalPhyPortStats(
   wLockedStats->stats = std::move(stats);
 }
 
+using namespace std::chrono;
 void PhyManager::updateAllXphyPortsStats() {
+  if (FLAGS_xphy_pipelined_stats_collection) {
+    updateAllXphyPortsStatsPipelined();
+    return;
+  }
   for (const auto& portStatsInfo : portToStatsInfo_) {
     bool supportPortStats = false, supportPrbsStats = false;
     PimID pimID;
@@ -568,7 +579,193 @@ void PhyManager::updateAllXphyPortsStats() {
   }
 }
 
-using namespace std::chrono;
+void PhyManager::updateAllXphyPortsStatsPipelined() {
+  auto isUnderway = [](const auto& collection) {
+    return collection.has_value() && !collection->isReady();
+  };
+
+  std::map<PimID, std::vector<PortStatsJob>> pimToJobs;
+  for (const auto& portStatsInfo : portToStatsInfo_) {
+    PortStatsJob job{portStatsInfo.first, nullptr, false, false};
+    PimID pimID;
+    {
+      const auto& rLockedCache = getRLockedCache(job.portID);
+      // If the port is not programmed yet, skip updating xphy stats for it
+      if (!rLockedCache->speed || rLockedCache->systemLanes.empty() ||
+          rLockedCache->lineLanes.empty()) {
+        continue;
+      }
+      job.xphy = getExternalPhyLocked(rLockedCache);
+      job.portStats =
+          (job.xphy->isSupported(phy::ExternalPhy::Feature::PORT_STATS) ||
+           job.xphy->isSupported(phy::ExternalPhy::Feature::PORT_INFO));
+      job.prbsStats =
+          job.xphy->isSupported(phy::ExternalPhy::Feature::PRBS_STATS);
+
+      auto xphyID = getGlobalXphyIDbyPortIDLocked(rLockedCache);
+      pimID = getPhyIDInfo(xphyID).pimID;
+    }
+    if (!job.portStats && !job.prbsStats) {
+      continue;
+    }
+
+    const auto& rLockedStats = getRLockedStats(job.portID);
+    if (isUnderway(rLockedStats->ongoingStatCollection)) {
+      XLOG(DBG4) << "XPHY Port Stat collection for Port:" << job.portID
+                 << " still underway...";
+      job.portStats = false;
+    }
+    // Only needs to update prbs stats as long as there's one side enabled
+    job.prbsStats = job.prbsStats &&
+        (rLockedStats->stats->isPrbsCollectionEnabled(phy::Side::SYSTEM) ||
+         rLockedStats->stats->isPrbsCollectionEnabled(phy::Side::LINE));
+    if (job.prbsStats &&
+        isUnderway(rLockedStats->ongoingPrbsStatCollection)) {
+      XLOG(DBG4) << "XPHY PRBS Stat collection for Port:" << job.portID
+                 << " still underway...";
+      job.prbsStats = false;
+    }
+    if (job.portStats || job.prbsStats) {
+      pimToJobs[pimID].push_back(job);
+    }
+  }
+  if (pimToJobs.empty()) {
+    return;
+  }
+
+  // Collect the ports of each pim in one go on the pim EventBase, all pims
+  // at the same time
+  std::vector<folly::Future<std::map<PortID, phy::PhyInfo>>> pimCollections;
+  for (const auto& [pimID, jobs] : pimToJobs) {
+    auto evb = getPimEventBase(pimID);
+    pimCollections.push_back(folly::via(evb).thenValue(
+        [this, pimID = pimID, jobs = jobs](auto&&) {
+          return collectPimStats(pimID, jobs);
+        }));
+  }
+
+  // Publish the PhyInfos of all pims at once, and only then consider the
+  // collection done
+  folly::FutureSplitter<folly::Unit> collection(
+      folly::collectAllUnsafe(std::move(pimCollections))
+          .thenValue([this](auto&& results) {
+            std::map<PortID, phy::PhyInfo> phyInfos;
+            for (auto& result : results) {
+              if (result.hasValue()) {
+                phyInfos.merge(result.value());
+              }
+            }
+            updateXphyInfos(phyInfos);
+          }));
+  for (const auto& pimAndJobs : pimToJobs) {
+    for (const auto& job : pimAndJobs.second) {
+      const auto& wLockedStats = getWLockedStats(job.portID);
+      if (job.portStats) {
+        wLockedStats->ongoingStatCollection = collection.getFuture();
+      }
+      if (job.prbsStats) {
+        wLockedStats->ongoingPrbsStatCollection = collection.getFuture();
+      }
+    }
+  }
+}
+
+std::map<PortID, phy::PhyInfo> PhyManager::collectPimStats(
+    PimID pimID,
+    const std::vector<PortStatsJob>& jobs) {
+  std::map<PortID, phy::PhyInfo> phyInfos;
+  steady_clock::time_point begin = steady_clock::now();
+  for (const auto& job : jobs) {
+    // Keep going with the other ports of the pim if one fails
+    try {
+      if (job.portStats) {
+        if (auto phyInfo = collectPortStats(job.portID, job.xphy)) {
+          phyInfos.emplace(job.portID, std::move(*phyInfo));
+        }
+      }
+      if (job.prbsStats) {
+        collectPrbsStats(job.portID, job.xphy);
+      }
+    } catch (const std::exception& ex) {
+      XLOG(ERR) << "Port " << job.portID
+                << ": xphy stat collection failed: " << ex.what();
+    }
+  }
+  auto took = duration_cast<milliseconds>(steady_clock::now() - begin);
+  recordXphyStatsCollectionTime(pimID, took);
+  XLOG(DBG3) << "Pim " << static_cast<int>(pimID) << ": " << jobs.size()
+             << " ports xphy stat collection took " << took.count() << "ms";
+  return phyInfos;
+}
+
+std::optional<phy::PhyInfo> PhyManager::collectPortStats(
+    PortID portID,
+    phy::ExternalPhy* xphy) {
+  // Since this is future job, we need to fetch the cache with lock
+  std::vector<LaneID> systemLanes, lineLanes;
+  cfg::PortSpeed programmedSpeed;
+  {
+    const auto& wCache = getWLockedCache(portID);
+    if (!wCache->speed || wCache->systemLanes.empty() ||
+        wCache->lineLanes.empty()) {
+      XLOG(WARN) << "Port:" << portID
+                 << " doesn't have programmed speed and lanes";
+      return std::nullopt;
+    }
+    programmedSpeed = *wCache->speed;
+    systemLanes = wCache->systemLanes;
+    lineLanes = wCache->lineLanes;
+  }
+
+  steady_clock::time_point begin = steady_clock::now();
+  std::optional<ExternalPhyPortStats> stats;
+  std::optional<phy::PhyInfo> phyInfo;
+  // if PORT_INFO feature is supported, use getPortInfo instead
+  if (xphy->isSupported(phy::ExternalPhy::Feature::PORT_INFO)) {
+    PhyInfo lastPhyInfo;
+    if (auto lastXphyInfo = getXphyInfo(portID)) {
+      lastPhyInfo = *lastXphyInfo;
+    }
+    auto xphyPortInfo = xphy->getPortInfo(systemLanes, lineLanes, lastPhyInfo);
+    xphyPortInfo.name() = getPortName(portID);
+    xphyPortInfo.speed() = programmedSpeed;
+    stats = ExternalPhyPortStats::fromPhyInfo(xphyPortInfo);
+    phyInfo = std::move(xphyPortInfo);
+  } else {
+    stats = xphy->getPortStats(systemLanes, lineLanes);
+  }
+
+  const auto& wLockedStats = getWLockedStats(portID);
+  wLockedStats->stats->updateXphyStats(*stats);
+  XLOG(DBG3) << "Port " << portID << ": xphy port stat collection took "
+             << duration_cast<milliseconds>(steady_clock::now() - begin).count()
+             << "ms";
+  return phyInfo;
+}
+
+void PhyManager::collectPrbsStats(PortID portID, phy::ExternalPhy* xphy) {
+  // Since this is future job, we need to fetch the cache with lock
+  std::vector<LaneID> systemLanes, lineLanes;
+  {
+    const auto& wCache = getWLockedCache(portID);
+    if (wCache->systemLanes.empty() || wCache->lineLanes.empty()) {
+      XLOG(WARN) << "Port:" << portID << " doesn't have programmed lanes";
+      return;
+    }
+    systemLanes = wCache->systemLanes;
+    lineLanes = wCache->lineLanes;
+  }
+
+  steady_clock::time_point begin = steady_clock::now();
+  const auto& stats = xphy->getPortPrbsStats(systemLanes, lineLanes);
+
+  const auto& wLockedStats = getWLockedStats(portID);
+  wLockedStats->stats->updateXphyPrbsStats(stats);
+  XLOG(DBG3) << "Port " << portID << ": xphy prbs stat collection took "
+             << duration_cast<milliseconds>(steady_clock::now() - begin).count()
+             << "ms";
+}
+
 void PhyManager::updatePortStats(
     PortID portID,
     phy::ExternalPhy* xphy,
@@ -584,46 +781,9 @@ void PhyManager::updatePortStats(
   // Collect xphy port stats
   wLockedStats->ongoingStatCollection =
       folly::via(pimEvb).thenValue([this, portID, xphy](auto&&) {
-        // Since this is future job, we need to fetch the cache with lock
-        std::vector<LaneID> systemLanes, lineLanes;
-        cfg::PortSpeed programmedSpeed;
-        {
-          const auto& wCache = getWLockedCache(portID);
-          if (!wCache->speed || wCache->systemLanes.empty() ||
-              wCache->lineLanes.empty()) {
-            XLOG(WARN) << "Port:" << portID
-                       << " doesn't have programmed speed and lanes";
-            return;
-          }
-          programmedSpeed = *wCache->speed;
-          systemLanes = wCache->systemLanes;
-          lineLanes = wCache->lineLanes;
+        if (auto phyInfo = collectPortStats(portID, xphy)) {
+          updateXphyInfo(portID, *phyInfo);
         }
-
-        steady_clock::time_point begin = steady_clock::now();
-        std::optional<ExternalPhyPortStats> stats;
-        // if PORT_INFO feature is supported, use getPortInfo instead
-        if (xphy->isSupported(phy::ExternalPhy::Feature::PORT_INFO)) {
-          PhyInfo lastPhyInfo;
-          if (auto lastXphyInfo = getXphyInfo(portID)) {
-            lastPhyInfo = *lastXphyInfo;
-          }
-          auto xphyPortInfo =
-              xphy->getPortInfo(systemLanes, lineLanes, lastPhyInfo);
-          xphyPortInfo.name() = getPortName(portID);
-          xphyPortInfo.speed() = programmedSpeed;
-          updateXphyInfo(portID, xphyPortInfo);
-          stats = ExternalPhyPortStats::fromPhyInfo(xphyPortInfo);
-        } else {
-          stats = xphy->getPortStats(systemLanes, lineLanes);
-        }
-
-        const auto& wLockedStats = getWLockedStats(portID);
-        wLockedStats->stats->updateXphyStats(*stats);
-        XLOG(DBG3)
-            << "Port " << portID << ": xphy port stat collection took "
-            << duration_cast<milliseconds>(steady_clock::now() - begin).count()
-            << "ms";
       });
 }
 
@@ -648,27 +808,7 @@ void PhyManager::updatePrbsStats(
   // Collect xphy prbs stats
   wLockedStats->ongoingPrbsStatCollection =
       folly::via(pimEvb).thenValue([this, portID, xphy](auto&&) {
-        // Since this is future job, we need to fetch the cache with lock
-        std::vector<LaneID> systemLanes, lineLanes;
-        {
-          const auto& wCache = getWLockedCache(portID);
-          if (wCache->systemLanes.empty() || wCache->lineLanes.empty()) {
-            XLOG(WARN) << "Port:" << portID << " doesn't have programmed lanes";
-            return;
-          }
-          systemLanes = wCache->systemLanes;
-          lineLanes = wCache->lineLanes;
-        }
-
-        steady_clock::time_point begin = steady_clock::now();
-        const auto& stats = xphy->getPortPrbsStats(systemLanes, lineLanes);
-
-        const auto& wLockedStats = getWLockedStats(portID);
-        wLockedStats->stats->updateXphyPrbsStats(stats);
-        XLOG(DBG3)
-            << "Port " << portID << ": xphy prbs stat collection took "
-            << duration_cast<milliseconds>(steady_clock::now() - begin).count()
-            << "ms";
+        collectPrbsStats(portID, xphy);
       });
 }
 
@@ -761,6 +901,22 @@ void PhyManager::updateXphyInfo(PortID port, const phy::PhyInfo& phyInfo) {
   xphySnapshotManager_->updatePhyInfo(port, phyInfo);
 }
 
+void PhyManager::updateXphyInfos(
+    const std::map<PortID, phy::PhyInfo>& phyInfos) {
+  xphySnapshotManager_->updatePhyInfos(phyInfos);
+}
+
+std::map<PimID, std::chrono::milliseconds>
+PhyManager::getXphyStatsCollectionTimes() const {
+  return xphyStatsCollectionTimes_.copy();
+}
+
+void PhyManager::recordXphyStatsCollectionTime(
+    PimID pimID,
+    std::chrono::milliseconds took) {
+  xphyStatsCollectionTimes_.wlock()->insert_or_assign(pimID, took);
+}
+
 std::optional<phy::PhyInfo> PhyManager::getXphyInfo(PortID port) const {
   return xphySnapshotManager_->getPhyInfo(port);
 }
@@ -14,11 +14,13 @@
 
 #include <folly/Synchronized.h>
 #include <folly/futures/Future.h>
+#include <chrono>
 #include <map>
 #include <optional>
 #include <vector>
 
 DECLARE_bool(init_pim_xphys);
+DECLARE_bool(xphy_pipelined_stats_collection);
 
 namespace facebook {
 namespace fboss {
@@ -195,6 +197,11 @@ class PhyManager {
 
   virtual void updateAllXphyPortsStats();
 
+  // How long the last xphy stats collection took on each pim, for the
+  // collection modes collecting a pim's ports in one go
+  std::map<PimID, std::chrono::milliseconds> getXphyStatsCollectionTimes()
+      const;
+
   // The following two functions return whether the future job of xphy or prbs
   // stats collection is done.
   // NOTE: The following two functions are only used in testing.
@@ -203,6 +210,7 @@ class PhyManager {
 
   void publishXphyInfoSnapshots(PortID portID) const;
   void updateXphyInfo(PortID portID, const phy::PhyInfo& phyInfo);
+  void updateXphyInfos(const std::map<PortID, phy::PhyInfo>& phyInfos);
   std::optional<phy::PhyInfo> getXphyInfo(PortID portID) const;
 
   // returns the default TX settings for phy ports on the given phy.
@@ -252,6 +260,10 @@ class PhyManager {
 
   void setupPimEventMultiThreading(PimID pimID);
 
+  void recordXphyStatsCollectionTime(
+      PimID pimID,
+      std::chrono::milliseconds took);
+
   template <typename LockedPtr>
   phy::ExternalPhy* getExternalPhyLocked(const LockedPtr& lockedCache) {
     return getExternalPhy(lockedCache->xphyID);
@@ -343,6 +355,31 @@ class PhyManager {
       std::unique_ptr<folly::Synchronized<PortStatsInfo>>>;
   PortToStatsInfo setupPortToStatsInfo(const PlatformMapping* platformMapping);
 
+  // The stats of one port to collect as part of its pim's collection
+  struct PortStatsJob {
+    PortID portID;
+    phy::ExternalPhy* xphy;
+    bool portStats;
+    bool prbsStats;
+  };
+
+  /* Collects the stats of all ports of a pim with a single job on each pim
+   * EventBase, rather than one job per port, and updates the PhyInfos of
+   * all ports at once when all pims are done.
+   */
+  void updateAllXphyPortsStatsPipelined();
+  // Runs on the pim EventBase, returns the PhyInfos collected
+  std::map<PortID, phy::PhyInfo> collectPimStats(
+      PimID pimID,
+      const std::vector<PortStatsJob>& jobs);
+
+  // Collect the stats of a port, on its pim EventBase. The PhyInfo of the
+  // port is returned rather than updated, if the xphy supports PORT_INFO.
+  std::optional<phy::PhyInfo> collectPortStats(
+      PortID portID,
+      phy::ExternalPhy* xphy);
+  void collectPrbsStats(PortID portID, phy::ExternalPhy* xphy);
+
   // Update PortStatsInfo::stats
   void updatePortStats(
       PortID portID,
@@ -386,6 +423,9 @@ class PhyManager {
   static constexpr auto kXphySnapshotIntervalSeconds = 60;
   std::unique_ptr<PhySnapshotManager<kXphySnapshotIntervalSeconds>>
       xphySnapshotManager_;
+
+  folly::Synchronized<std::map<PimID, std::chrono::milliseconds>>
+      xphyStatsCollectionTimes_;
 };
 
 } // namespace fboss
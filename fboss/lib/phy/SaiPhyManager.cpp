@@ -122,14 +122,13 @@ void SaiPhyManager::updateAllXphyPortsStats() {
           folly::via(getPimEventBase(pimId)).thenValue([this, pimId](auto&&) {
             steady_clock::time_point begin = steady_clock::now();
             auto& xphyToPlatform = saiPlatforms_.find(pimId)->second;
+            std::map<PortID, phy::PhyInfo> pimPhyInfos;
             for (auto& [xphy, platformInfo] : xphyToPlatform) {
               try {
                 static SwitchStats unused;
                 platformInfo->getHwSwitch()->updateStats(&unused);
-                auto phyInfos = platformInfo->getHwSwitch()->updateAllPhyInfo();
-                for (const auto& info : phyInfos) {
-                  updateXphyInfo(info.first, info.second);
-                }
+                pimPhyInfos.merge(
+                    platformInfo->getHwSwitch()->updateAllPhyInfo());
               } catch (const std::exception& e) {
                 XLOG(INFO) << "Stats collection failed on : "
                            << "switch: "
@@ -137,12 +136,14 @@ void SaiPhyManager::updateAllXphyPortsStats() {
                            << " xphy: " << xphy << " error: " << e.what();
               }
             }
+            // Update the PhyInfos of all xphys of the pim at once
+            updateXphyInfos(pimPhyInfos);
+            auto took =
+                duration_cast<milliseconds>(steady_clock::now() - begin);
+            recordXphyStatsCollectionTime(pimId, took);
             XLOG(DBG3) << "Pim " << static_cast<int>(pimId) << ": all "
                        << xphyToPlatform.size() << " xphy stat collection took "
-                       << duration_cast<milliseconds>(
-                              steady_clock::now() - begin)
-                              .count()
-                       << "ms";
+                       << took.count() << "ms";
           });
     }
   }
@@ -0,0 +1,82 @@
+// Copyright 2004-present Facebook. All Rights Reserved.
+#include "fboss/lib/ShardedTimeSeriesWithMinMax.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+
+using namespace facebook::fboss;
+
+using namespace std::chrono;
+
+TEST(ShardedTimeSeriesWithMinMax, BasicTest) {
+  ShardedTimeSeriesWithMinMax<int> buffer(seconds(3), seconds(1));
+  EXPECT_THROW(buffer.getMax(), std::runtime_error);
+
+  buffer.addValue(5);
+  buffer.addValue(7);
+  buffer.addValue(3);
+  EXPECT_EQ(buffer.getMax(), 7);
+  EXPECT_EQ(buffer.getMin(), 3);
+  EXPECT_DOUBLE_EQ(buffer.getAverage(), 5);
+
+  // Too old to be recorded
+  buffer.addValue(100, system_clock::now() - seconds(5));
+  EXPECT_EQ(buffer.getMax(), 7);
+}
+
+TEST(ShardedTimeSeriesWithMinMax, RangeQueries) {
+  ShardedTimeSeriesWithMinMax<int> buffer(seconds(10), seconds(1));
+  auto now = system_clock::now();
+  buffer.addValue(1, now - seconds(4));
+  buffer.addValue(9, now - seconds(4));
+  buffer.addValue(3, now - seconds(2));
+  buffer.addValue(5, now);
+
+  EXPECT_EQ(buffer.getMax(), 9);
+  EXPECT_EQ(buffer.getMin(), 1);
+  EXPECT_DOUBLE_EQ(buffer.getAverage(), 4.5);
+
+  // Buckets are aligned to the second, the one holding now starts after
+  // now - 1s
+  EXPECT_EQ(buffer.getMax(now - seconds(3), now - seconds(1)), 3);
+  EXPECT_EQ(buffer.getMin(now - seconds(3), now + seconds(1)), 3);
+  EXPECT_DOUBLE_EQ(buffer.getAverage(now - seconds(3), now + seconds(1)), 4);
+  EXPECT_THROW(
+      buffer.getMax(now - seconds(9), now - seconds(6)), std::runtime_error);
+}
+
+TEST(ShardedTimeSeriesWithMinMax, BucketsExpire) {
+  ShardedTimeSeriesWithMinMax<double> buffer(
+      milliseconds(300), milliseconds(100));
+  buffer.addValue(10.5);
+  EXPECT_EQ(buffer.getMax(), 10.5);
+  /* sleep override */
+  std::this_thread::sleep_for(milliseconds(400));
+  EXPECT_THROW(buffer.getMax(), std::runtime_error);
+  // The bucket gets reused once the ring wraps around
+  buffer.addValue(1.5);
+  buffer.addValue(2.5);
+  EXPECT_EQ(buffer.getMax(), 2.5);
+  EXPECT_EQ(buffer.getMin(), 1.5);
+}
+
+TEST(ShardedTimeSeriesWithMinMax, ConcurrentAddValue) {
+  constexpr int kNumThreads = 8;
+  constexpr int kNumValues = 10000;
+  ShardedTimeSeriesWithMinMax<int64_t> buffer(seconds(60), seconds(1));
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&buffer, i]() {
+      for (int j = 0; j < kNumValues; ++j) {
+        buffer.addValue(i * kNumValues + j);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(buffer.getMax(), kNumThreads * kNumValues - 1);
+  EXPECT_EQ(buffer.getMin(), 0);
+  EXPECT_DOUBLE_EQ(buffer.getAverage(), (kNumThreads * kNumValues - 1) / 2.0);
+}
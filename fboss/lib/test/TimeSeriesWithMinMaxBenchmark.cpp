@@ -1,4 +1,5 @@
 // Copyright 2004-present Facebook. All Rights Reserved.
+#include "fboss/lib/ShardedTimeSeriesWithMinMax.h"
 #include "fboss/lib/TimeSeriesWithMinMax.h"
 
 #include <folly/Benchmark.h>
@@ -6,6 +7,7 @@
 #include "common/init/Init.h"
 
 #include <algorithm>
+#include <thread>
 #include <vector>
 
 using namespace facebook::fboss;
@@ -37,6 +39,42 @@ BENCHMARK(VectorComparison, n) {
   }
 }
 
+/*
+ * Several threads adding values to the same buffer, as when sampling
+ * watermarks from multiple stats threads. n values are added in total.
+ */
+template <class BufferT>
+void concurrentAddValue(unsigned n, size_t numThreads) {
+  BufferT buf;
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < numThreads; t++) {
+    threads.emplace_back([&buf, n, numThreads]() {
+      for (unsigned i = 0; i < n / numThreads; i++) {
+        buf.addValue(i);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  doNotOptimizeAway(buf.getMax());
+}
+
+void lockedAddValue(unsigned n, size_t numThreads) {
+  concurrentAddValue<TimeSeriesWithMinMax<int>>(n, numThreads);
+}
+
+void shardedAddValue(unsigned n, size_t numThreads) {
+  concurrentAddValue<ShardedTimeSeriesWithMinMax<int>>(n, numThreads);
+}
+
+BENCHMARK_PARAM(lockedAddValue, 1);
+BENCHMARK_RELATIVE_PARAM(shardedAddValue, 1);
+BENCHMARK_PARAM(lockedAddValue, 4);
+BENCHMARK_RELATIVE_PARAM(shardedAddValue, 4);
+BENCHMARK_PARAM(lockedAddValue, 16);
+BENCHMARK_RELATIVE_PARAM(shardedAddValue, 16);
+
 int main(int argc, char** argv) {
   facebook::initFacebook(&argc, &argv);
   runBenchmarks();
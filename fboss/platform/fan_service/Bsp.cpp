@@ -11,6 +11,12 @@
 #include "fboss/platform/fan_service/FsdbSensorSubscriber.h"
 #include "fboss/platform/sensor_service/if/gen-cpp2/sensor_service_types.h"
 
+DEFINE_bool(
+    read_sensor_data_from_shm,
+    false,
+    "Read sensor data from the shared memory table published by a "
+    "co-located sensor_service instead of calling it over thrift");
+
 namespace facebook::fboss::platform {
 
 Bsp::Bsp() {
@@ -35,6 +41,7 @@ void Bsp::getSensorData(
   bool fetchOverRest = false;
   bool fetchOverUtil = false;
   bool fetchFromFsdb = false;
+  bool fetchFromShm = false;
 
   // Only sysfs is read one by one. For other type of read,
   // we set the flags for each type, then read them in batch
@@ -46,7 +53,9 @@ void Bsp::getSensorData(
     bool readSuccessful;
     switch (*sensor->access.accessType()) {
       case fan_config_structs::SourceType::kSrcThrift:
-        if (FLAGS_subscribe_to_stats_from_fsdb) {
+        if (FLAGS_read_sensor_data_from_shm) {
+          fetchFromShm = true;
+        } else if (FLAGS_subscribe_to_stats_from_fsdb) {
           fetchFromFsdb = true;
         } else {
           fetchOverThrift = true;
@@ -83,7 +92,13 @@ void Bsp::getSensorData(
   // We don't use switch statement, as the config should support
   // mixed read methods. (For example, one sensor is read through thrift.
   // then another sensor is read from sysfs)
+  if (fetchFromShm && !getSensorDataShm(pSensorData)) {
+    // sensor_service is not publishing to shared memory (yet),
+    // so fall back to thrift for this cycle
+    fetchOverThrift = true;
+  }
   if (fetchOverThrift) {
+    lastSensorSampleTimeNsec_ = 0;
     getSensorDataThrift(pServiceConfig, pSensorData);
   }
   if (fetchOverUtil) {
@@ -393,6 +408,35 @@ void Bsp::getSensorDataThrift(
   return;
 }
 
+bool Bsp::getSensorDataShm(std::shared_ptr<SensorData> pSensorData) {
+  // sensor_service may start after us, so keep trying to attach
+  if (!sensorShmTable_) {
+    sensorShmTable_ =
+        sensor_service::SensorShmTable::openReader(FLAGS_sensor_shm_name);
+    if (!sensorShmTable_) {
+      return false;
+    }
+  }
+  auto snapshot = sensorShmTable_->read();
+  if (!snapshot) {
+    return false;
+  }
+  if (snapshot->generation < lastShmGeneration_) {
+    // sensor_service restarted and reinitialized the table. The content of
+    // this snapshot is still valid, but re-attach on the next read.
+    XLOG(INFO) << "Sensor shared memory generation went back from "
+               << lastShmGeneration_ << " to " << snapshot->generation;
+    sensorShmTable_.reset();
+  }
+  lastShmGeneration_ = snapshot->generation;
+  lastSensorSampleTimeNsec_ = snapshot->sampledAtNsec;
+  for (const auto& [name, sensorData] : snapshot->sensorData) {
+    pSensorData->updateEntryFloat(
+        name, *sensorData.value(), *sensorData.timeStamp());
+  }
+  return true;
+}
+
 void Bsp::getSensorDataThriftWithSensorList(
     std::shared_ptr<ServiceConfig> pServiceConfig,
     std::shared_ptr<SensorData> pSensorData,
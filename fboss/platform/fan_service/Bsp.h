@@ -41,8 +41,11 @@
 
 #include "fboss/fsdb/client/FsdbPubSubManager.h"
 #include "fboss/platform/fan_service/FsdbSensorSubscriber.h"
+#include "fboss/platform/sensor_service/SensorShmTable.h"
 #include "fboss/platform/sensor_service/if/gen-cpp2/sensor_service_types.h"
 
+DECLARE_bool(read_sensor_data_from_shm);
+
 int runShellCmd(const std::string& cmd);
 
 namespace facebook::fboss::platform {
@@ -84,6 +87,14 @@ class Bsp {
   void getSensorDataThrift(
       std::shared_ptr<ServiceConfig> pServiceConfig,
       std::shared_ptr<SensorData> pSensorData);
+  // getSensorDataShm : Read the sensor table sensor_service publishes into
+  //                    shared memory. Returns false if it is not available.
+  bool getSensorDataShm(std::shared_ptr<SensorData> pSensorData);
+  // Monotonic time (ns) at which the last consumed sensor data was sampled
+  // by sensor_service. 0 if unknown (e.g. data was read over thrift).
+  uint64_t getLastSensorSampleTimeNsec() const {
+    return lastSensorSampleTimeNsec_;
+  }
 
  protected:
   // replaceAllString : String replace helper function
@@ -115,6 +126,8 @@ class Bsp {
   int sensordThriftPort_{5970};
   int qsfpSvcThriftPort_{5910};
   bool initialSensorDataRead_{false};
+  uint64_t lastSensorSampleTimeNsec_{0};
+  uint64_t lastShmGeneration_{0};
 
   // Low level access function for setting PWM and LED value
   virtual bool writeSysfs(std::string path, int value);
@@ -148,6 +161,7 @@ class Bsp {
       const std::map<int32_t, TransceiverInfo>& cacheTable,
       OpticEntry* opticData);
 
+  std::unique_ptr<sensor_service::SensorShmTable> sensorShmTable_;
   std::unique_ptr<FsdbSensorSubscriber> fsdbSensorSubscriber_;
   std::unique_ptr<fsdb::FsdbPubSubManager> fsdbPubSubMgr_;
   folly::Synchronized<
@@ -8,6 +8,13 @@
 // Additional FB helper funtion
 #include "common/time/Time.h"
 
+#include <fb303/ServiceData.h>
+
+namespace {
+const std::string kSensorToPwmLatencyUsec =
+    "fan_service.sensor_to_pwm_latency_us";
+} // namespace
+
 namespace facebook::fboss::platform {
 ControlLogic::ControlLogic(
     std::shared_ptr<ServiceConfig> pC,
@@ -773,6 +780,18 @@ void ControlLogic::updateControl(std::shared_ptr<SensorData> pS) {
   adjustZoneFans(boostMode);
   // Update the time stamp
   lastControlUpdateSec_ = pBsp_->getCurrentTime();
+
+  // Measure the time from sensor_service sampling the sensors to the PWM
+  // update based on them. Only known when sensors are read from shared memory
+  auto sampledAtNsec = pBsp_->getLastSensorSampleTimeNsec();
+  if (sampledAtNsec != 0) {
+    auto latencyUsec =
+        (sensor_service::SensorShmTable::nowNsec() - sampledAtNsec) / 1000;
+    fb303::fbData->addStatValue(
+        kSensorToPwmLatencyUsec, latencyUsec, fb303::AVG);
+    XLOG(INFO) << "Control :: Sensor read to PWM update latency : "
+               << latencyUsec << "us";
+  }
 }
 
 } // namespace facebook::fboss::platform
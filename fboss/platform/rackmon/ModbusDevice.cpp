@@ -15,7 +15,8 @@ ModbusDevice::ModbusDevice(
     int numCommandRetries)
     : interface_(interface),
       numCommandRetries_(numCommandRetries),
-      baudConfig_(registerMap.baudConfig) {
+      baudConfig_(registerMap.baudConfig),
+      mergeAdjacentReads_(registerMap.mergeAdjacentReads) {
   info_.deviceAddress = deviceAddress;
   info_.preferredBaudrate = registerMap.preferredBaudrate;
   info_.defaultBaudrate = registerMap.defaultBaudrate;
@@ -145,6 +146,117 @@ void ModbusDevice::setBaudrate(uint32_t baud) {
   }
 }
 
+// Record the value just read into the front of the store.
+static void commitRegister(RegisterStore& registerStore, uint32_t timestamp) {
+  auto& nextRegister = registerStore.front();
+  nextRegister.timestamp = timestamp;
+  // If we dont care about changes or if we do
+  // and we notice that the value is different
+  // from the previous, increment store to
+  // point to the next.
+  if (!nextRegister.desc.storeChangesOnly ||
+      nextRegister != registerStore.back()) {
+    ++registerStore;
+  }
+}
+
+void ModbusDevice::reloadRegister(
+    RegisterStore& registerStore,
+    uint32_t timestamp) {
+  uint16_t registerOffset = registerStore.regAddr();
+  try {
+    readHoldingRegisters(registerOffset, registerStore.front().value);
+    commitRegister(registerStore, timestamp);
+  } catch (ModbusError& e) {
+    logInfo << "DEV:0x" << std::hex << int(info_.deviceAddress)
+            << " ReadReg 0x" << std::hex << registerOffset << ' '
+            << registerStore.name() << " caught: " << e.what() << std::endl;
+    if (e.errorCode == ModbusErrorCode::ILLEGAL_DATA_ADDRESS) {
+      logInfo << "DEV:0x" << std::hex << int(info_.deviceAddress)
+              << " ReadReg 0x" << std::hex << registerOffset << ' '
+              << registerStore.name()
+              << " unsupported. Disabled from monitoring" << std::endl;
+      registerStore.disable();
+    } else {
+      logInfo << "DEV:0x" << std::hex << int(info_.deviceAddress)
+              << " ReadReg 0x" << std::hex << registerOffset << ' '
+              << registerStore.name() << " caught: " << e.what() << std::endl;
+    }
+    return;
+  } catch (std::exception& e) {
+    logInfo << "DEV:0x" << std::hex << int(info_.deviceAddress)
+            << " ReadReg 0x" << std::hex << registerOffset << ' '
+            << registerStore.name() << " caught: " << e.what() << std::endl;
+    return;
+  }
+  // Release thread to allow for higher priority tasks to execute.
+  std::this_thread::yield();
+}
+
+size_t ModbusDevice::mergeableSpan(size_t idx) const {
+  const auto& registerList = info_.registerList;
+  size_t count = 1;
+  if (unmergeableSpans_.find(registerList[idx].regAddr()) !=
+      unmergeableSpans_.end()) {
+    return count;
+  }
+  uint32_t numRegs = registerList[idx].length();
+  for (size_t next = idx + 1; next < registerList.size(); ++next) {
+    const auto& prev = registerList[next - 1];
+    const auto& curr = registerList[next];
+    if (!curr.isEnabled() ||
+        curr.regAddr() != uint32_t(prev.regAddr()) + prev.length() ||
+        numRegs + curr.length() > kMaxRegistersPerRead) {
+      break;
+    }
+    numRegs += curr.length();
+    ++count;
+  }
+  return count;
+}
+
+bool ModbusDevice::reloadRegisterSpan(
+    size_t idx,
+    size_t count,
+    uint32_t timestamp) {
+  auto& registerList = info_.registerList;
+  uint16_t registerOffset = registerList[idx].regAddr();
+  std::vector<uint16_t> values;
+  for (size_t i = idx; i < idx + count; ++i) {
+    values.resize(values.size() + registerList[i].length());
+  }
+  try {
+    readHoldingRegisters(registerOffset, values);
+  } catch (ModbusError& e) {
+    // Some register in the span is not supported by the device. Let the
+    // caller read them one by one so that only that register is disabled,
+    // and do not attempt to merge reads starting at this register again.
+    unmergeableSpans_.insert(registerOffset);
+    logInfo << "DEV:0x" << std::hex << int(info_.deviceAddress)
+            << " ReadRegs 0x" << std::hex << registerOffset << " count "
+            << std::dec << values.size() << " caught: " << e.what()
+            << std::endl;
+    return false;
+  } catch (std::exception& e) {
+    logInfo << "DEV:0x" << std::hex << int(info_.deviceAddress)
+            << " ReadRegs 0x" << std::hex << registerOffset << " count "
+            << std::dec << values.size() << " caught: " << e.what()
+            << std::endl;
+    return true;
+  }
+  auto valueIt = values.begin();
+  for (size_t i = idx; i < idx + count; ++i) {
+    auto& registerStore = registerList[i];
+    auto& nextValue = registerStore.front().value;
+    std::copy(valueIt, valueIt + nextValue.size(), nextValue.begin());
+    valueIt += nextValue.size();
+    commitRegister(registerStore, timestamp);
+  }
+  // Release thread to allow for higher priority tasks to execute.
+  std::this_thread::yield();
+  return true;
+}
+
 void ModbusDevice::reloadRegisters() {
   setPreferredBaudrate();
   // If the number of consecutive failures has exceeded
@@ -158,51 +270,31 @@ void ModbusDevice::reloadRegisters() {
     specialHandler.handle(*this);
   }
   std::unique_lock lk(registerListMutex_);
-  for (auto& registerStore : info_.registerList) {
-    uint16_t registerOffset = registerStore.regAddr();
-    auto& nextRegister = registerStore.front();
+  auto& registerList = info_.registerList;
+  for (size_t idx = 0; idx < registerList.size();) {
     // Break early, if we are entering exclusive mode
     if (exclusiveMode_) {
       break;
     }
-    if (!registerStore.isEnabled()) {
+    if (!registerList[idx].isEnabled()) {
+      ++idx;
       continue;
     }
-    try {
-      readHoldingRegisters(registerOffset, nextRegister.value);
-      nextRegister.timestamp = timestamp;
-      // If we dont care about changes or if we do
-      // and we notice that the value is different
-      // from the previous, increment store to
-      // point to the next.
-      if (!nextRegister.desc.storeChangesOnly ||
-          nextRegister != registerStore.back()) {
-        ++registerStore;
+    size_t span = mergeAdjacentReads_ ? mergeableSpan(idx) : 1;
+    if (span > 1 && reloadRegisterSpan(idx, span, timestamp)) {
+      idx += span;
+      continue;
+    }
+    // Read one by one, either because merging is disabled, or the device
+    // rejected the merged read of this span.
+    for (size_t end = idx + span; idx < end; ++idx) {
+      if (exclusiveMode_) {
+        break;
       }
-    } catch (ModbusError& e) {
-      logInfo << "DEV:0x" << std::hex << int(info_.deviceAddress)
-              << " ReadReg 0x" << std::hex << registerOffset << ' '
-              << registerStore.name() << " caught: " << e.what() << std::endl;
-      if (e.errorCode == ModbusErrorCode::ILLEGAL_DATA_ADDRESS) {
-        logInfo << "DEV:0x" << std::hex << int(info_.deviceAddress)
-                << " ReadReg 0x" << std::hex << registerOffset << ' '
-                << registerStore.name()
-                << " unsupported. Disabled from monitoring" << std::endl;
-        registerStore.disable();
-      } else {
-        logInfo << "DEV:0x" << std::hex << int(info_.deviceAddress)
-                << " ReadReg 0x" << std::hex << registerOffset << ' '
-                << registerStore.name() << " caught: " << e.what() << std::endl;
+      if (registerList[idx].isEnabled()) {
+        reloadRegister(registerList[idx], timestamp);
       }
-      continue;
-    } catch (std::exception& e) {
-      logInfo << "DEV:0x" << std::hex << int(info_.deviceAddress)
-              << " ReadReg 0x" << std::hex << registerOffset << ' '
-              << registerStore.name() << " caught: " << e.what() << std::endl;
-      continue;
     }
-    // Release thread to allow for higher priority tasks to execute.
-    std::this_thread::yield();
   }
 }
 
@@ -215,6 +307,7 @@ void ModbusDevice::setActive() {
   for (auto& registerStore : info_.registerList) {
     registerStore.enable();
   }
+  unmergeableSpans_.clear();
   // Clear the num failures so we consider it active.
   info_.numConsecutiveFailures = 0;
   info_.mode = ModbusDeviceMode::ACTIVE;
@@ -233,22 +326,36 @@ ModbusDeviceInfo ModbusDevice::getInfo() {
 
 ModbusDeviceValueData ModbusDevice::getValueData(
     const ModbusRegisterFilter& filter,
-    bool latestValueOnly) const {
-  std::unique_lock lk(registerListMutex_);
+    bool latestValueOnly,
+    const TimeRange& timeRange) const {
   ModbusDeviceValueData data;
-  data.ModbusDeviceInfo::operator=(info_);
   auto shouldPickRegister = [&filter](const RegisterStore& reg) {
     return !filter || filter.contains(reg.regAddr()) ||
         filter.contains(reg.name());
   };
-  for (const auto& reg : info_.registerList) {
-    if (shouldPickRegister(reg)) {
-      if (latestValueOnly) {
-        data.registerList.emplace_back(reg.regAddr(), reg.name());
+  // Copy out the compact history of the selected registers and
+  // interpret it after releasing the lock, so that large dumps do
+  // not hold up monitoring.
+  std::vector<RegisterStore> registerList;
+  {
+    std::unique_lock lk(registerListMutex_);
+    data.ModbusDeviceInfo::operator=(info_);
+    for (const auto& reg : info_.registerList) {
+      if (shouldPickRegister(reg)) {
+        registerList.push_back(reg);
+      }
+    }
+  }
+  for (const auto& reg : registerList) {
+    if (latestValueOnly) {
+      data.registerList.emplace_back(reg.regAddr(), reg.name());
+      if (timeRange.contains(reg.back().timestamp)) {
         data.registerList.back().history.emplace_back(reg.back());
-      } else {
-        data.registerList.emplace_back(reg);
       }
+    } else if (timeRange) {
+      data.registerList.emplace_back(reg.getValues(timeRange));
+    } else {
+      data.registerList.emplace_back(reg);
     }
   }
   return data;
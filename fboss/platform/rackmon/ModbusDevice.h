@@ -81,6 +81,10 @@ void to_json(nlohmann::json& j, const ModbusDeviceValueData& m);
 
 class ModbusDevice {
   static constexpr uint32_t kMaxConsecutiveFailures = 10;
+  // Largest read-holding-registers response which fits in a Msg.
+  // addr(1), func(1), bytecount(1), <2 * count regs>, crc(2)
+  static constexpr uint16_t kMaxRegistersPerRead =
+      (Msg::kMaxModbusLength - 5) / 2;
   Modbus& interface_;
   int numCommandRetries_;
   ModbusDeviceRawData info_;
@@ -88,10 +92,23 @@ class ModbusDevice {
   std::vector<ModbusSpecialHandler> specialHandlers_{};
   const BaudrateConfig& baudConfig_;
   bool setBaudEnabled_ = true;
+  bool mergeAdjacentReads_ = false;
+  // Start of register spans the device refused to read at once.
+  std::set<uint16_t> unmergeableSpans_{};
   std::atomic<bool> exclusiveMode_{false};
 
   void handleCommandFailure(std::exception& baseException);
 
+  // Number of enabled registers starting at registerList[idx] which are
+  // back to back in the address space and can be read with one command.
+  size_t mergeableSpan(size_t idx) const;
+  // Read a single register into its store.
+  void reloadRegister(RegisterStore& registerStore, uint32_t timestamp);
+  // Read registerList[idx, idx + count) with one command. Returns false if
+  // the device rejected the merged read and the registers need to be read
+  // one by one.
+  bool reloadRegisterSpan(size_t idx, size_t count, uint32_t timestamp);
+
   void setBaudrate(uint32_t baud);
   void setDefaultBaudrate() {
     setBaudrate(info_.defaultBaudrate);
@@ -121,6 +138,10 @@ class ModbusDevice {
     return info_.deviceType;
   }
 
+  Modbus& getInterface() const {
+    return interface_;
+  }
+
   void readHoldingRegisters(
       uint16_t registerOffset,
       std::vector<uint16_t>& regs,
@@ -163,9 +184,12 @@ class ModbusDevice {
   ModbusDeviceRawData getRawData();
 
   // Returns value formatted register data monitored for this device.
+  // If a time range is provided, only the values read within it are
+  // returned, oldest first.
   ModbusDeviceValueData getValueData(
       const ModbusRegisterFilter& filter = {},
-      bool latestValueOnly = false) const;
+      bool latestValueOnly = false,
+      const TimeRange& timeRange = {}) const;
 };
 
 } // namespace rackmon
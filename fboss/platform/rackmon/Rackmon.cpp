@@ -2,6 +2,7 @@
 #include "Rackmon.h"
 #include <nlohmann/json.hpp>
 #include <fstream>
+#include <future>
 #include <iomanip>
 #include "Log.h"
 
@@ -135,11 +136,35 @@ void Rackmon::recoverDormant() {
 
 void Rackmon::monitor(void) {
   std::shared_lock lock(devicesMutex_);
+  // Devices on different interfaces do not share a bus, so each
+  // interface is polled by its own worker while the devices on
+  // an interface are polled one after the other.
+  std::map<Modbus*, std::vector<ModbusDevice*>> devicesPerInterface;
   for (const auto& dev_it : devices_) {
     if (!dev_it.second->isActive()) {
       continue;
     }
-    dev_it.second->reloadRegisters();
+    devicesPerInterface[&dev_it.second->getInterface()].push_back(
+        dev_it.second.get());
+  }
+  auto pollInterface = [](const std::vector<ModbusDevice*>& devices) {
+    for (auto dev : devices) {
+      dev->reloadRegisters();
+    }
+  };
+  if (devicesPerInterface.size() <= 1) {
+    for (const auto& it : devicesPerInterface) {
+      pollInterface(it.second);
+    }
+  } else {
+    std::vector<std::future<void>> workers;
+    for (const auto& it : devicesPerInterface) {
+      workers.push_back(
+          std::async(std::launch::async, pollInterface, std::cref(it.second)));
+    }
+    for (auto& worker : workers) {
+      worker.get();
+    }
   }
   lastMonitorTime_ = std::time(nullptr);
 }
@@ -313,7 +338,8 @@ void Rackmon::getValueData(
     std::vector<ModbusDeviceValueData>& data,
     const ModbusDeviceFilter& devFilter,
     const ModbusRegisterFilter& regFilter,
-    bool latestValueOnly) const {
+    bool latestValueOnly,
+    const TimeRange& timeRange) const {
   auto isInFilter = [&devFilter](const ModbusDevice& dev) {
     return devFilter.contains(dev.getDeviceAddress()) ||
         devFilter.contains(dev.getDeviceType());
@@ -325,14 +351,16 @@ void Rackmon::getValueData(
         devices_.begin(),
         devices_.end(),
         std::back_inserter(data),
-        [&regFilter, latestValueOnly](auto& kv) {
-          return kv.second->getValueData(regFilter, latestValueOnly);
+        [&regFilter, latestValueOnly, &timeRange](auto& kv) {
+          return kv.second->getValueData(
+              regFilter, latestValueOnly, timeRange);
         });
   } else {
     for (auto& kv : devices_) {
       ModbusDevice& dev = *kv.second;
       if (isInFilter(dev)) {
-        data.push_back(dev.getValueData(regFilter, latestValueOnly));
+        data.push_back(
+            dev.getValueData(regFilter, latestValueOnly, timeRange));
       }
     }
   }
@@ -176,7 +176,8 @@ class Rackmon {
       std::vector<ModbusDeviceValueData>& data,
       const ModbusDeviceFilter& devFilter = {},
       const ModbusRegisterFilter& regFilter = {},
-      bool latestValueOnly = false) const;
+      bool latestValueOnly = false,
+      const TimeRange& timeRange = {}) const;
 };
 
 } // namespace rackmon
@@ -178,7 +178,16 @@ void ThriftHandler::getMonitorDataEx(
     }
   }
 
-  rackmond_.getValueData(indata, devFilter, regFilter, latestOnly);
+  rackmon::TimeRange timeRange{};
+  if (filter->timeFilter_ref().has_value()) {
+    const TimeFilter& reqTimeFilter = *filter->timeFilter_ref();
+    timeRange.begin = uint32_t(reqTimeFilter.get_beginTime());
+    if (reqTimeFilter.endTime_ref().has_value()) {
+      timeRange.end = uint32_t(*reqTimeFilter.endTime_ref());
+    }
+  }
+
+  rackmond_.getValueData(indata, devFilter, regFilter, latestOnly, timeRange);
   for (auto& dev : indata) {
     data.emplace_back(transformModbusDeviceValueData(dev));
   }
@@ -1,5 +1,6 @@
 // Copyright 2021-present Facebook. All Rights Reserved.
 #include "Register.h"
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
 #include <numeric>
@@ -129,11 +130,114 @@ Register::operator RegisterValue() const {
   return RegisterValue(value, desc, timestamp);
 }
 
+RegisterHistory::RegisterHistory(uint16_t length, uint16_t capacity)
+    : length_(length),
+      capacity_(std::max<uint16_t>(capacity, 1)),
+      words_(size_t(length_) * capacity_),
+      timeDeltas_(capacity_) {}
+
+void RegisterHistory::push(
+    const std::vector<uint16_t>& value,
+    uint32_t timestamp) {
+  std::copy(
+      value.begin(),
+      value.begin() + std::min<size_t>(value.size(), length_),
+      words_.begin() + size_t(next_) * length_);
+  anchors_.erase(next_);
+  uint16_t delta = 0;
+  if (size_ > 0) {
+    if (timestamp < latestTimestamp_ ||
+        timestamp - latestTimestamp_ >= kNoDelta) {
+      delta = kNoDelta;
+      anchors_[next_] = timestamp;
+    } else {
+      delta = timestamp - latestTimestamp_;
+    }
+  }
+  timeDeltas_[next_] = delta;
+  latestTimestamp_ = timestamp;
+  bool overwrote = size_ == capacity_;
+  next_ = (next_ + 1) % capacity_;
+  size_ = std::min<uint16_t>(size_ + 1, capacity_);
+  if (size_ == 1 || capacity_ == 1) {
+    oldestTimestamp_ = timestamp;
+  } else if (overwrote) {
+    // The reading following the overwritten one is now the oldest.
+    oldestTimestamp_ = timeDeltas_[next_] == kNoDelta
+        ? anchors_.at(next_)
+        : oldestTimestamp_ + timeDeltas_[next_];
+  }
+}
+
+std::vector<uint32_t> RegisterHistory::timestamps() const {
+  std::vector<uint32_t> ret(capacity_, 0);
+  // Walk forward from the oldest reading.
+  uint32_t timestamp = oldestTimestamp_;
+  uint16_t slot = (next_ + capacity_ - size_) % capacity_;
+  for (uint16_t i = 0; i < size_; i++) {
+    if (i > 0) {
+      timestamp = timeDeltas_[slot] == kNoDelta
+          ? anchors_.at(slot)
+          : timestamp + timeDeltas_[slot];
+    }
+    ret[slot] = timestamp;
+    slot = (slot + 1) % capacity_;
+  }
+  return ret;
+}
+
+void RegisterHistory::load(uint16_t slot, std::vector<uint16_t>& value) const {
+  auto begin = words_.begin() + size_t(slot) * length_;
+  value.assign(begin, begin + length_);
+}
+
+std::vector<uint16_t> RegisterHistory::slots() const {
+  std::vector<uint16_t> ret;
+  ret.reserve(size_);
+  uint16_t oldest = (next_ + capacity_ - size_) % capacity_;
+  for (uint16_t i = 0; i < size_; i++) {
+    ret.push_back((oldest + i) % capacity_);
+  }
+  return ret;
+}
+
+void RegisterStore::operator++() {
+  if (next_) {
+    history_.push(next_.value, next_.timestamp);
+    last_.value = next_.value;
+    last_.timestamp = next_.timestamp;
+  }
+  // Present the slot we will overwrite next as the front.
+  if (history_.size() == history_.capacity()) {
+    history_.load(history_.nextSlot(), next_.value);
+    next_.timestamp = history_.oldestTimestamp();
+  } else {
+    std::fill(next_.value.begin(), next_.value.end(), 0);
+    next_.timestamp = 0;
+  }
+}
+
 RegisterStore::operator RegisterStoreValue() const {
   RegisterStoreValue ret(regAddr_, desc_.name);
-  for (const auto& reg : history_) {
-    if (reg) {
-      ret.history.emplace_back(reg);
+  std::vector<uint32_t> timestamps = history_.timestamps();
+  std::vector<uint16_t> value;
+  for (uint16_t slot = 0; slot < history_.capacity(); slot++) {
+    if (timestamps[slot] != 0) {
+      history_.load(slot, value);
+      ret.history.emplace_back(value, desc_, timestamps[slot]);
+    }
+  }
+  return ret;
+}
+
+RegisterStoreValue RegisterStore::getValues(const TimeRange& range) const {
+  RegisterStoreValue ret(regAddr_, desc_.name);
+  std::vector<uint32_t> timestamps = history_.timestamps();
+  std::vector<uint16_t> value;
+  for (uint16_t slot : history_.slots()) {
+    if (range.contains(timestamps[slot])) {
+      history_.load(slot, value);
+      ret.history.emplace_back(value, desc_, timestamps[slot]);
     }
   }
   return ret;
@@ -240,7 +344,14 @@ void to_json(json& j, const RegisterStoreValue& m) {
 
 void to_json(json& j, const RegisterStore& m) {
   j["begin"] = m.regAddr_;
-  j["readings"] = m.history_;
+  j["readings"] = json::array();
+  std::vector<uint32_t> timestamps = m.history_.timestamps();
+  Register reg(m.desc_);
+  for (uint16_t slot = 0; slot < m.history_.capacity(); slot++) {
+    m.history_.load(slot, reg.value);
+    reg.timestamp = timestamps[slot];
+    j["readings"].push_back(reg);
+  }
 }
 
 void from_json(const json& j, WriteActionInfo& action) {
@@ -294,6 +405,7 @@ void from_json(const json& j, RegisterMap& m) {
   if (j.contains("baud_config")) {
     j.at("baud_config").get_to(m.baudConfig);
   }
+  m.mergeAdjacentReads = j.value("merge_adjacent_reads", false);
 }
 void to_json(json& j, const RegisterMap& m) {
   j["address_range"] = m.applicableAddresses;
@@ -301,6 +413,7 @@ void to_json(json& j, const RegisterMap& m) {
   j["name"] = m.name;
   j["preferred_baudrate"] = m.preferredBaudrate;
   j["default_baudrate"] = m.preferredBaudrate;
+  j["merge_adjacent_reads"] = m.mergeAdjacentReads;
   j["registers"] = {};
   std::transform(
       m.registerDescriptors.begin(),
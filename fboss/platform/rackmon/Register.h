@@ -2,6 +2,7 @@
 #pragma once
 
 #include <nlohmann/json.hpp>
+#include <limits>
 #include <map>
 #include <optional>
 #include <utility>
@@ -128,6 +129,80 @@ struct RegisterStoreValue {
 };
 void to_json(nlohmann::json& j, const RegisterStoreValue& m);
 
+// Closed range of timestamps used to select readings from the
+// historical record of a register.
+struct TimeRange {
+  uint32_t begin = 0;
+  uint32_t end = std::numeric_limits<uint32_t>::max();
+  // Returns true if the range excludes any readings.
+  operator bool() const {
+    return begin != 0 || end != std::numeric_limits<uint32_t>::max();
+  }
+  bool contains(uint32_t timestamp) const {
+    return timestamp >= begin && timestamp <= end;
+  }
+};
+
+// Compact historical record of the raw contents of a register. The
+// words of each reading are packed back to back in a circular buffer
+// and are only interpreted when read back. Timestamps are stored as
+// the delta from the previous reading. Since a gap may not fit in
+// the delta (Registers which store changes only can go unchanged for
+// days), the timestamp of the previous reading is then kept on the
+// side, starting a new bucket of deltas.
+class RegisterHistory {
+  static constexpr uint16_t kNoDelta = std::numeric_limits<uint16_t>::max();
+  // Number of words per reading.
+  uint16_t length_;
+  // Maximum number of readings kept.
+  uint16_t capacity_;
+  // Slot the next reading will be written to.
+  uint16_t next_ = 0;
+  // Number of readings stored.
+  uint16_t size_ = 0;
+  // Timestamps of the oldest and the latest reading.
+  uint32_t oldestTimestamp_ = 0;
+  uint32_t latestTimestamp_ = 0;
+  std::vector<uint16_t> words_;
+  // Time since the preceding reading, for each slot.
+  std::vector<uint16_t> timeDeltas_;
+  // Timestamp of the slots whose delta was too large to be stored.
+  std::map<uint16_t, uint32_t> anchors_{};
+
+ public:
+  RegisterHistory(uint16_t length, uint16_t capacity);
+
+  uint16_t capacity() const {
+    return capacity_;
+  }
+  uint16_t size() const {
+    return size_;
+  }
+  // Slot the next reading will be written to. Once the history is
+  // full, this is also the slot of the oldest reading.
+  uint16_t nextSlot() const {
+    return next_;
+  }
+
+  // Appends a reading, overwriting the oldest one if full.
+  void push(const std::vector<uint16_t>& value, uint32_t timestamp);
+
+  // Timestamp of the oldest reading, zero if empty.
+  uint32_t oldestTimestamp() const {
+    return oldestTimestamp_;
+  }
+
+  // Decodes the timestamps of every slot. Empty slots have a zero
+  // timestamp.
+  std::vector<uint32_t> timestamps() const;
+
+  // Copies out the words of the reading stored at slot.
+  void load(uint16_t slot, std::vector<uint16_t>& value) const;
+
+  // Slots of the stored readings, oldest first.
+  std::vector<uint16_t> slots() const;
+};
+
 // Container of values of a single register at multiple points in
 // time. (RegisterDescriptor::keep defines the size of the depth
 // of the historical record).
@@ -137,20 +212,22 @@ struct RegisterStore {
   const RegisterDescriptor& desc_;
   // Address of the register.
   uint16_t regAddr_;
-  // History of the register contents to keep. This is utilized as
-  // a circular buffer with idx pointing to the current slot to
-  // write.
-  std::vector<Register> history_;
-  int32_t idx_ = 0;
+  // The reading being prepared (front) and the last committed
+  // reading (back). The historical record itself is kept compact.
+  Register next_;
+  Register last_;
+  RegisterHistory history_;
   bool enabled_ = true;
 
  public:
   explicit RegisterStore(const RegisterDescriptor& desc)
       : desc_(desc),
         regAddr_(desc.begin),
-        history_(desc.keep, Register(desc)) {}
+        next_(desc),
+        last_(desc),
+        history_(desc.length, desc.keep) {}
 
-  bool isEnabled() {
+  bool isEnabled() const {
     return enabled_;
   }
   void disable() {
@@ -162,25 +239,29 @@ struct RegisterStore {
 
   // Returns a reference to the last written value (Back of the list)
   Register& back() {
-    return idx_ == 0 ? history_.back() : history_[idx_ - 1];
+    return last_;
   }
   const Register& back() const {
-    return idx_ == 0 ? history_.back() : history_[idx_ - 1];
+    return last_;
   }
-  // Returns the front (Next to write) reference
+  // Returns the front (Next to write) reference. Once the history
+  // is full, it holds the oldest value till it is overwritten.
   Register& front() {
-    return history_[idx_];
-  }
-  // Advances the front.
-  void operator++() {
-    idx_ = (idx_ + 1) % history_.size();
+    return next_;
   }
+  // Commits the front to the history and advances the front.
+  void operator++();
 
   // register address accessor
   uint16_t regAddr() const {
     return regAddr_;
   }
 
+  // Number of 16bit words in the register
+  uint16_t length() const {
+    return desc_.length;
+  }
+
   const std::string& name() const {
     return desc_.name;
   }
@@ -191,6 +272,10 @@ struct RegisterStore {
   // Returns the historical record of the values
   operator RegisterStoreValue() const;
 
+  // Returns the values read within the time range, oldest first. Only
+  // the selected values are interpreted.
+  RegisterStoreValue getValues(const TimeRange& range) const;
+
   // Add the JSON conversion methods as friends.
   friend void to_json(nlohmann::json& j, const RegisterStore& m);
 };
@@ -244,6 +329,9 @@ struct RegisterMap {
   uint32_t defaultBaudrate;
   uint32_t preferredBaudrate;
   BaudrateConfig baudConfig{};
+  // If set, registers which are back to back in the address space are
+  // read with a single read-holding-registers command while monitoring.
+  bool mergeAdjacentReads = false;
   std::vector<SpecialHandlerInfo> specialHandlers;
   std::map<uint16_t, RegisterDescriptor> registerDescriptors;
   const RegisterDescriptor& at(uint16_t reg) const {
@@ -111,6 +111,16 @@ union RegisterFilter {
   2: set<string> nameFilter;
 }
 
+/*
+ * Filter rule to select the values of registers
+ * read within a window of time. Timestamps are
+ * in seconds since epoch and both ends are inclusive.
+ */
+struct TimeFilter {
+  1: i32 beginTime = 0;
+  2: optional i32 endTime;
+}
+
 /*
  * Set of filter rules to allow users to request
  * for only a subset of the data.
@@ -134,6 +144,12 @@ struct MonitorDataFilter {
    * the entire history available for the register.
    */
   3: bool latestValueOnly = false;
+
+  /*
+   * If provided, returns only the values read within
+   * the time window, oldest first.
+   */
+  4: optional TimeFilter timeFilter;
 }
 
 enum RegisterValueType {
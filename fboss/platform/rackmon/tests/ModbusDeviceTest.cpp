@@ -3,6 +3,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <thread>
+#include "SimulatedUARTDevice.h"
 
 using namespace std;
 using namespace testing;
@@ -543,6 +544,72 @@ TEST_F(ModbusDeviceTest, MonitorRawData) {
   EXPECT_EQ(data3["ranges"][0]["readings"][1]["data"], "62636465");
 }
 
+class ModbusDeviceMergedReadsTest : public ::testing::Test {
+ protected:
+  SimulatedModbus modbus_{{0x32}};
+  RegisterMap regmap_;
+  void SetUp() override {
+    regmap_ = R"({
+      "name": "orv3_psu",
+      "address_range": [110, 140],
+      "probe_register": 104,
+      "default_baudrate": 115200,
+      "preferred_baudrate": 115200,
+      "merge_adjacent_reads": true,
+      "registers": [
+        { "begin": 0, "length": 2, "name": "REG_0" },
+        { "begin": 2, "length": 1, "name": "REG_2" },
+        { "begin": 3, "length": 1, "name": "REG_3" },
+        { "begin": 10, "length": 2, "name": "REG_10" }
+      ]
+    })"_json;
+    modbus_.initialize(R"({
+      "device_path": "/dev/sim0",
+      "baudrate": 115200
+    })"_json);
+  }
+  std::vector<std::vector<uint16_t>> latestValues(ModbusDevice& dev) {
+    std::vector<std::vector<uint16_t>> ret;
+    for (auto& reg : dev.getRawData().registerList) {
+      ret.push_back(reg.back().value);
+    }
+    return ret;
+  }
+};
+
+TEST_F(ModbusDeviceMergedReadsTest, AdjacentRegistersReadTogether) {
+  ModbusDevice dev(modbus_, 0x32, regmap_);
+  dev.reloadRegisters();
+  // 0..3 in one command, 10..11 in another.
+  EXPECT_EQ(modbus_.numCommands(), 2);
+  std::vector<std::vector<uint16_t>> exp = {{0, 1}, {2}, {3}, {10, 11}};
+  EXPECT_EQ(latestValues(dev), exp);
+}
+
+TEST_F(ModbusDeviceMergedReadsTest, MergingDisabled) {
+  regmap_.mergeAdjacentReads = false;
+  ModbusDevice dev(modbus_, 0x32, regmap_);
+  dev.reloadRegisters();
+  EXPECT_EQ(modbus_.numCommands(), 4);
+  std::vector<std::vector<uint16_t>> exp = {{0, 1}, {2}, {3}, {10, 11}};
+  EXPECT_EQ(latestValues(dev), exp);
+}
+
+TEST_F(ModbusDeviceMergedReadsTest, RejectedMergedReadFallsBack) {
+  modbus_.device().setUnsupportedRegisters({2});
+  ModbusDevice dev(modbus_, 0x32, regmap_);
+  dev.reloadRegisters();
+  // Merged read of 0..3 fails (and is retried like any other
+  // command), then 0, 2, 3 are read one by one and 10 by itself.
+  EXPECT_EQ(modbus_.numCommands(), 5 + 1 + 5 + 1 + 1);
+  std::vector<std::vector<uint16_t>> exp = {{0, 1}, {0}, {3}, {10, 11}};
+  EXPECT_EQ(latestValues(dev), exp);
+
+  // REG_2 is now disabled, so 0 and 3 are no longer adjacent.
+  dev.reloadRegisters();
+  EXPECT_EQ(modbus_.numCommands(), 13 + 3);
+}
+
 class MockModbusDevice : public ModbusDevice {
  public:
   MockModbusDevice(Modbus& m, uint8_t addr, const RegisterMap& rmap)
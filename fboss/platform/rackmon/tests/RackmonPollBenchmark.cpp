@@ -0,0 +1,123 @@
+// Copyright 2023-present Facebook. All Rights Reserved.
+//
+// Measures the time taken by rackmon to poll a full rack of PSUs
+// against simulated RS-485 interfaces, with and without merging
+// adjacent register reads.
+#include <chrono>
+#include <iostream>
+#include "Rackmon.h"
+#include "SimulatedUARTDevice.h"
+
+using nlohmann::json;
+using namespace rackmon;
+
+namespace {
+
+constexpr int kNumPsus = 12;
+constexpr uint8_t kFirstPsuAddr = 160;
+constexpr int kNumPolls = 2;
+
+// Register layout of a ORv2 PSU (begin, length)
+const std::vector<std::pair<uint16_t, uint16_t>> kRegisterLayout = {
+    {0, 8},   {16, 8},  {32, 8},  {48, 4},  {56, 4},  {64, 16}, {96, 4},
+    {104, 1}, {105, 1}, {107, 1}, {108, 1}, {109, 1}, {110, 1}, {111, 1},
+    {112, 1}, {113, 1}, {114, 1}, {115, 1}, {116, 1}, {117, 1}, {118, 1},
+    {119, 1}, {120, 1}, {121, 1}, {122, 1}, {123, 1}, {124, 1}, {125, 1},
+    {126, 1}, {127, 1}, {128, 1}, {129, 1}, {130, 1}, {131, 1}, {132, 1},
+    {133, 1}, {134, 1}, {135, 1}, {136, 1}, {137, 1}, {138, 1}, {139, 1},
+    {140, 1}, {141, 1}, {142, 1}, {143, 1}, {144, 1}, {145, 1}, {146, 1},
+    {147, 1}, {148, 1}, {149, 1}, {150, 1}, {151, 1}, {152, 1}, {153, 1},
+    {154, 1}, {155, 1}, {156, 1}, {157, 1}, {158, 1}, {159, 1}, {160, 1},
+    {161, 1}, {163, 1}, {164, 1}, {165, 1}, {208, 1}, {209, 1}, {210, 1},
+    {211, 1}, {212, 1}, {213, 1}, {215, 1}, {216, 1}, {217, 1}, {262, 1},
+    {263, 1}, {264, 1}, {265, 2}, {267, 2}, {269, 8}, {277, 8}, {285, 4},
+    {289, 1}, {290, 1}, {291, 1}, {292, 1}, {293, 1}, {294, 1}, {295, 1},
+    {296, 2}, {298, 2}, {300, 2}, {302, 1}, {303, 1}, {304, 1}, {305, 2},
+};
+
+json makeRegisterMap(bool mergeAdjacentReads) {
+  json regmap = {
+      {"name", "orv2_psu"},
+      {"address_range", {kFirstPsuAddr, kFirstPsuAddr + kNumPsus - 1}},
+      {"probe_register", 104},
+      {"default_baudrate", 19200},
+      {"preferred_baudrate", 19200},
+      {"merge_adjacent_reads", mergeAdjacentReads},
+      {"registers", json::array()}};
+  for (const auto& [begin, length] : kRegisterLayout) {
+    regmap["registers"].push_back(
+        {{"begin", begin},
+         {"length", length},
+         {"name", "REG_" + std::to_string(begin)}});
+  }
+  return regmap;
+}
+
+class SimulatedRackmon : public Rackmon {
+  int numInterfaces_;
+  int nextInterface_ = 0;
+
+ protected:
+  std::unique_ptr<Modbus> makeInterface() override {
+    // Spread the PSUs evenly over the interfaces.
+    std::set<uint8_t> addrs;
+    for (int i = nextInterface_; i < kNumPsus; i += numInterfaces_) {
+      addrs.insert(kFirstPsuAddr + i);
+    }
+    nextInterface_++;
+    return std::make_unique<SimulatedModbus>(addrs);
+  }
+
+ public:
+  explicit SimulatedRackmon(int numInterfaces)
+      : numInterfaces_(numInterfaces) {}
+
+  void scanTick() {
+    getScanThread().tick();
+  }
+  void monitorTick() {
+    getMonitorThread().tick();
+  }
+};
+
+void runBenchmark(int numInterfaces, bool mergeAdjacentReads) {
+  SimulatedRackmon mon(numInterfaces);
+  json ifaces = {{"interfaces", json::array()}};
+  for (int i = 0; i < numInterfaces; i++) {
+    ifaces["interfaces"].push_back(
+        {{"device_path", "/dev/sim" + std::to_string(i)},
+         {"baudrate", 19200}});
+  }
+  mon.loadInterface(ifaces);
+  mon.loadRegisterMap(makeRegisterMap(mergeAdjacentReads));
+  // Use a long interval so that only the ticks below poll.
+  mon.start(std::chrono::hours(1));
+  // Wait for the initial full scan to discover all PSUs, and for
+  // the initial monitor pass to complete.
+  mon.scanTick();
+  mon.monitorTick();
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kNumPolls; i++) {
+    mon.monitorTick();
+  }
+  auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start);
+  mon.stop();
+
+  std::cout << "interfaces: " << numInterfaces
+            << " merge_adjacent_reads: " << mergeAdjacentReads
+            << " devices: " << mon.listDevices().size()
+            << " full rack poll: " << elapsed.count() / kNumPolls << "ms"
+            << std::endl;
+}
+
+} // namespace
+
+int main() {
+  runBenchmark(1, false);
+  runBenchmark(3, false);
+  runBenchmark(1, true);
+  runBenchmark(3, true);
+  return 0;
+}
@@ -178,3 +178,77 @@ TEST(RegisterStoreTest, DataRetrievalConversions) {
   EXPECT_EQ(std::string(j2["readings"][0]["data"]), "30313233");
   EXPECT_EQ(std::string(j2["readings"][1]["data"]), "31323334");
 }
+
+TEST(RegisterHistoryTest, TimestampDeltas) {
+  RegisterHistory history(1, 4);
+  EXPECT_EQ(history.size(), 0);
+  EXPECT_EQ(history.timestamps(), std::vector<uint32_t>({0, 0, 0, 0}));
+
+  // Small gaps are stored as deltas, large (and backward) gaps as
+  // anchors. Both have to decode back to the original timestamps.
+  history.push({1}, 1000);
+  history.push({2}, 1010);
+  history.push({3}, 1000000);
+  EXPECT_EQ(history.size(), 3);
+  EXPECT_EQ(
+      history.timestamps(), std::vector<uint32_t>({1000, 1010, 1000000, 0}));
+  EXPECT_EQ(history.oldestTimestamp(), 1000);
+  history.push({4}, 999999);
+  history.push({5}, 1000005);
+  EXPECT_EQ(history.size(), 4);
+  EXPECT_EQ(
+      history.timestamps(),
+      std::vector<uint32_t>({1000005, 1010, 1000000, 999999}));
+  EXPECT_EQ(history.slots(), std::vector<uint16_t>({1, 2, 3, 0}));
+  EXPECT_EQ(history.oldestTimestamp(), 1010);
+  // The oldest reading is now one stored as an anchor.
+  history.push({6}, 1000010);
+  EXPECT_EQ(history.oldestTimestamp(), 1000000);
+  EXPECT_EQ(
+      history.timestamps(),
+      std::vector<uint32_t>({1000005, 1000010, 1000000, 999999}));
+  EXPECT_EQ(history.slots(), std::vector<uint16_t>({2, 3, 0, 1}));
+
+  std::vector<uint16_t> value;
+  history.load(0, value);
+  EXPECT_EQ(value, std::vector<uint16_t>({5}));
+  history.load(1, value);
+  EXPECT_EQ(value, std::vector<uint16_t>({6}));
+  history.load(3, value);
+  EXPECT_EQ(value, std::vector<uint16_t>({4}));
+}
+
+TEST(RegisterStoreTest, TimeRangeQuery) {
+  RegisterDescriptor desc{
+      0,
+      1,
+      "HELLO",
+      3,
+      false,
+      RegisterEndian::BIG,
+      RegisterValueType::INTEGER,
+      0};
+  RegisterStore reg(desc);
+  for (uint16_t i = 1; i <= 5; i++) {
+    reg.front().value = {i};
+    reg.front().timestamp = 100 * i;
+    ++reg;
+  }
+  // Only the last 3 are kept, and the result is oldest first.
+  RegisterStoreValue all = reg.getValues({});
+  EXPECT_EQ(all.name, "HELLO");
+  ASSERT_EQ(all.history.size(), 3);
+  EXPECT_EQ(std::get<int32_t>(all.history[0].value), 3);
+  EXPECT_EQ(all.history[0].timestamp, 300);
+  EXPECT_EQ(std::get<int32_t>(all.history[2].value), 5);
+  EXPECT_EQ(all.history[2].timestamp, 500);
+
+  RegisterStoreValue some = reg.getValues({350, 500});
+  ASSERT_EQ(some.history.size(), 2);
+  EXPECT_EQ(std::get<int32_t>(some.history[0].value), 4);
+  EXPECT_EQ(std::get<int32_t>(some.history[1].value), 5);
+
+  EXPECT_EQ(reg.getValues({600, 700}).history.size(), 0);
+  EXPECT_FALSE(TimeRange{});
+  EXPECT_TRUE((TimeRange{350, 500}));
+}
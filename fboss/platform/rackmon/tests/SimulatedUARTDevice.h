@@ -0,0 +1,145 @@
+// Copyright 2023-present Facebook. All Rights Reserved.
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <set>
+#include <thread>
+#include "Modbus.h"
+
+namespace rackmon {
+
+// Simulates a RS-485 bus with a set of Modbus devices behind it.
+// Every holding register of a simulated device reads back as its
+// own register address. The time taken to transfer the bytes on
+// the wire is modeled from the baudrate, so that poll times
+// measured against it are representative of real hardware.
+class SimulatedUARTDevice : public UARTDevice {
+  // Start, 8 data bits, parity and stop bit.
+  static constexpr int kBitsPerByte = 11;
+  std::set<uint8_t> deviceAddrs_;
+  std::set<uint16_t> unsupportedRegs_;
+  std::chrono::microseconds turnaround_;
+  Msg resp_{};
+  std::atomic<uint32_t> numCommands_{0};
+
+  void wireDelay(size_t len) {
+    // sleep override
+    std::this_thread::sleep_for(std::chrono::microseconds(
+        len * kBitsPerByte * 1000000 / getBaudrate()));
+  }
+
+  void makeResponse(const uint8_t* buf, size_t len) {
+    resp_.clear();
+    uint8_t func = buf[1];
+    if (func == 0x3 && len == 8) {
+      uint16_t start = (buf[2] << 8) | buf[3];
+      uint16_t count = (buf[4] << 8) | buf[5];
+      auto unsupported = unsupportedRegs_.lower_bound(start);
+      if (unsupported != unsupportedRegs_.end() &&
+          *unsupported < uint32_t(start) + count) {
+        // ILLEGAL_DATA_ADDRESS
+        resp_ << buf[0] << uint8_t(func | 0x80) << uint8_t(0x2);
+        Encoder::finalize(resp_);
+        return;
+      }
+      resp_ << buf[0] << func << uint8_t(2 * count);
+      for (uint32_t reg = start; reg < uint32_t(start) + count; reg++) {
+        resp_ << uint16_t(reg);
+      }
+    } else if ((func == 0x6 || func == 0x10) && len >= 8) {
+      // Write single register echoes the request, write multiple
+      // registers returns the offset and count.
+      resp_ << buf[0] << func;
+      for (int i = 2; i < 6; i++) {
+        resp_ << buf[i];
+      }
+    } else {
+      resp_ << buf[0] << uint8_t(func | 0x80) << uint8_t(0x1);
+    }
+    Encoder::finalize(resp_);
+  }
+
+ protected:
+  void setAttribute(bool /* readEnable */, int /* baudrate */) override {}
+
+ public:
+  SimulatedUARTDevice(
+      const std::string& device,
+      int baudrate,
+      const std::set<uint8_t>& deviceAddrs,
+      std::chrono::microseconds turnaround = std::chrono::microseconds(500))
+      : UARTDevice(device, baudrate),
+        deviceAddrs_(deviceAddrs),
+        turnaround_(turnaround) {}
+
+  void open() override {}
+  void close() override {}
+  bool exists() override {
+    return true;
+  }
+
+  void write(const uint8_t* buf, size_t len) override {
+    numCommands_++;
+    wireDelay(len);
+    if (len >= 2 && deviceAddrs_.find(buf[0]) != deviceAddrs_.end()) {
+      makeResponse(buf, len);
+    } else {
+      resp_.clear();
+    }
+  }
+
+  size_t read(uint8_t* buf, size_t exactLen, int /* timeoutMs */) override {
+    if (resp_.len == 0) {
+      // Nobody on the bus with that address. Do not bother
+      // simulating the timeout itself.
+      throw TimeoutException();
+    }
+    // sleep override
+    std::this_thread::sleep_for(turnaround_);
+    size_t len = std::min(exactLen, resp_.len);
+    wireDelay(len);
+    std::memcpy(buf, resp_.raw.data(), len);
+    resp_.clear();
+    return len;
+  }
+
+  uint32_t numCommands() const {
+    return numCommands_.load();
+  }
+
+  // Reads covering any of these registers fail with ILLEGAL_DATA_ADDRESS
+  void setUnsupportedRegisters(const std::set<uint16_t>& regs) {
+    unsupportedRegs_ = regs;
+  }
+};
+
+// Modbus interface backed by a SimulatedUARTDevice.
+class SimulatedModbus : public Modbus {
+  std::set<uint8_t> deviceAddrs_;
+  SimulatedUARTDevice* device_ = nullptr;
+
+ public:
+  explicit SimulatedModbus(const std::set<uint8_t>& deviceAddrs)
+      : Modbus(), deviceAddrs_(deviceAddrs) {}
+
+  std::unique_ptr<UARTDevice> makeDevice(
+      const std::string& /* deviceType */,
+      const std::string& devicePath,
+      uint32_t baudrate) override {
+    auto dev = std::make_unique<SimulatedUARTDevice>(
+        devicePath, baudrate, deviceAddrs_);
+    device_ = dev.get();
+    return dev;
+  }
+
+  SimulatedUARTDevice& device() {
+    return *device_;
+  }
+
+  uint32_t numCommands() const {
+    return device_ ? device_->numCommands() : 0;
+  }
+};
+
+} // namespace rackmon
@@ -29,6 +29,12 @@ DEFINE_string(
     "/etc/sensor_service/sensors_output.json",
     "File to store the mock Lm Sensor JSON data");
 
+DEFINE_bool(
+    publish_sensor_data_to_shm,
+    false,
+    "Publish sensor data to shared memory after every fetch, so that "
+    "co-located services can read it without a thrift call");
+
 namespace {
 
 // The following are keys in sensor conf file
@@ -98,6 +104,9 @@ void SensorServiceImpl::init() {
   });
 
   fsdbSyncer_ = std::make_unique<FsdbSyncer>();
+  if (FLAGS_publish_sensor_data_to_shm) {
+    shmTable_ = SensorShmTable::createWriter(FLAGS_sensor_shm_name);
+  }
   XLOG(INFO) << "========================================================";
 }
 
@@ -161,7 +170,11 @@ std::map<std::string, SensorData> SensorServiceImpl::getAllSensorData() {
 }
 
 void SensorServiceImpl::fetchSensorData() {
+  auto sampledAtNsec = SensorShmTable::nowNsec();
   SCOPE_EXIT {
+    if (shmTable_) {
+      shmTable_->publish(getAllSensorData(), sampledAtNsec);
+    }
     if (FLAGS_publish_stats_to_fsdb) {
       auto now = std::chrono::steady_clock::now();
       if (!publishedStatsToFsdbAt_ ||
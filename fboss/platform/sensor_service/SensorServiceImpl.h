@@ -14,12 +14,14 @@
 #include <unordered_map>
 #include <vector>
 #include "fboss/platform/sensor_service/FsdbSyncer.h"
+#include "fboss/platform/sensor_service/SensorShmTable.h"
 #include "fboss/platform/sensor_service/if/gen-cpp2/sensor_config_types.h"
 #include "fboss/platform/sensor_service/if/gen-cpp2/sensor_service_types.h"
 #include "folly/Synchronized.h"
 
 DECLARE_int32(fsdb_statsStream_interval_seconds);
 DECLARE_string(mock_lmsensor_json_data);
+DECLARE_bool(publish_sensor_data_to_shm);
 
 namespace facebook::fboss::platform::sensor_service {
 
@@ -82,6 +84,8 @@ class SensorServiceImpl {
   void getSensorDataFromPath();
 
   std::unique_ptr<FsdbSyncer> fsdbSyncer_;
+  // Local low latency channel for co-located readers such as fan_service
+  std::unique_ptr<SensorShmTable> shmTable_;
   std::optional<std::chrono::time_point<std::chrono::steady_clock>>
       publishedStatsToFsdbAt_;
 };
@@ -0,0 +1,226 @@
+/*
+ *  Copyright (c) 2004-present, Meta Platforms, Inc. and affiliates.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/platform/sensor_service/SensorShmTable.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <folly/Conv.h>
+#include <folly/ScopeGuard.h>
+#include <folly/String.h>
+#include <folly/logging/xlog.h>
+
+DEFINE_string(
+    sensor_shm_name,
+    "/fboss_sensor_service_data",
+    "Name of the POSIX shared memory object used to share sensor data "
+    "with co-located services");
+
+namespace {
+// A read that keeps racing with the writer is retried this many times
+// before giving up for this cycle.
+constexpr int kMaxReadRetries = 16;
+} // namespace
+
+namespace facebook::fboss::platform::sensor_service {
+
+SensorShmTable::SensorShmTable(
+    const std::string& shmName,
+    SensorShmLayout* layout,
+    bool writer)
+    : shmName_(shmName), layout_(layout), writer_(writer) {}
+
+SensorShmTable::~SensorShmTable() {
+  if (layout_) {
+    munmap(layout_, sizeof(SensorShmLayout));
+  }
+}
+
+uint64_t SensorShmTable::nowNsec() {
+  // steady_clock is CLOCK_MONOTONIC on Linux, which is shared by all
+  // processes on the host, so timestamps can be compared across services.
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+std::unique_ptr<SensorShmTable> SensorShmTable::createWriter(
+    const std::string& shmName) {
+  int fd = shm_open(shmName.c_str(), O_CREAT | O_RDWR, 0644);
+  if (fd < 0) {
+    throw std::runtime_error(folly::to<std::string>(
+        "Failed to create shared memory ",
+        shmName,
+        " : ",
+        folly::errnoStr(errno)));
+  }
+  SCOPE_EXIT {
+    close(fd);
+  };
+  if (ftruncate(fd, sizeof(SensorShmLayout)) != 0) {
+    throw std::runtime_error(folly::to<std::string>(
+        "Failed to size shared memory ",
+        shmName,
+        " : ",
+        folly::errnoStr(errno)));
+  }
+  void* addr = mmap(
+      nullptr,
+      sizeof(SensorShmLayout),
+      PROT_READ | PROT_WRITE,
+      MAP_SHARED,
+      fd,
+      0);
+  if (addr == MAP_FAILED) {
+    throw std::runtime_error(folly::to<std::string>(
+        "Failed to map shared memory ",
+        shmName,
+        " : ",
+        folly::errnoStr(errno)));
+  }
+  auto layout = static_cast<SensorShmLayout*>(addr);
+  // Leave seq odd while (re)initializing so that readers of a table left
+  // behind by a previous incarnation retry instead of reading garbage.
+  auto seq = layout->seq.load(std::memory_order_relaxed);
+  layout->seq.store(seq | 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  layout->magic = kSensorShmMagic;
+  layout->layoutVersion = kSensorShmLayoutVersion;
+  layout->generation = 0;
+  layout->sampledAtNsec = 0;
+  layout->publishedAtNsec = 0;
+  layout->numEntries = 0;
+  layout->seq.store((seq | 1) + 1, std::memory_order_release);
+  XLOG(INFO) << "Publishing sensor data to shared memory " << shmName;
+  return std::unique_ptr<SensorShmTable>(
+      new SensorShmTable(shmName, layout, true /* writer */));
+}
+
+std::unique_ptr<SensorShmTable> SensorShmTable::openReader(
+    const std::string& shmName) {
+  int fd = shm_open(shmName.c_str(), O_RDONLY, 0);
+  if (fd < 0) {
+    XLOG(DBG2) << "Shared memory " << shmName
+               << " not available yet : " << folly::errnoStr(errno);
+    return nullptr;
+  }
+  SCOPE_EXIT {
+    close(fd);
+  };
+  struct stat st;
+  if (fstat(fd, &st) != 0 ||
+      static_cast<size_t>(st.st_size) < sizeof(SensorShmLayout)) {
+    XLOG(ERR) << "Shared memory " << shmName << " has unexpected size";
+    return nullptr;
+  }
+  void* addr =
+      mmap(nullptr, sizeof(SensorShmLayout), PROT_READ, MAP_SHARED, fd, 0);
+  if (addr == MAP_FAILED) {
+    XLOG(ERR) << "Failed to map shared memory " << shmName << " : "
+              << folly::errnoStr(errno);
+    return nullptr;
+  }
+  auto layout = static_cast<SensorShmLayout*>(addr);
+  if (layout->magic != kSensorShmMagic ||
+      layout->layoutVersion != kSensorShmLayoutVersion) {
+    XLOG(ERR) << "Shared memory " << shmName
+              << " has incompatible layout version " << layout->layoutVersion;
+    munmap(addr, sizeof(SensorShmLayout));
+    return nullptr;
+  }
+  return std::unique_ptr<SensorShmTable>(
+      new SensorShmTable(shmName, layout, false /* writer */));
+}
+
+void SensorShmTable::publish(
+    const std::map<std::string, SensorData>& sensorData,
+    uint64_t sampledAtNsec) {
+  CHECK(writer_) << "Cannot publish through a read only sensor table";
+  if (sensorData.size() > kSensorShmMaxSensors) {
+    XLOG(ERR) << "Sensor table holds at most " << kSensorShmMaxSensors
+              << " sensors, dropping "
+              << sensorData.size() - kSensorShmMaxSensors;
+  }
+
+  auto seq = layout_->seq.load(std::memory_order_relaxed);
+  layout_->seq.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  uint32_t idx = 0;
+  for (const auto& [name, data] : sensorData) {
+    if (idx == kSensorShmMaxSensors) {
+      break;
+    }
+    if (name.size() >= kSensorShmMaxNameLen) {
+      XLOG(ERR) << "Sensor name " << name << " too long for shared memory";
+      continue;
+    }
+    auto& entry = layout_->entries[idx++];
+    std::memset(entry.name, 0, sizeof(entry.name));
+    std::memcpy(entry.name, name.data(), name.size());
+    entry.value = *data.value();
+    entry.timeStamp = *data.timeStamp();
+  }
+  layout_->numEntries = idx;
+  layout_->generation++;
+  layout_->sampledAtNsec = sampledAtNsec;
+  layout_->publishedAtNsec = nowNsec();
+
+  layout_->seq.store(seq + 2, std::memory_order_release);
+}
+
+std::optional<SensorShmSnapshot> SensorShmTable::read() const {
+  // Copy the raw entries while racing with the writer and only decode them
+  // once we know the copy is consistent, to keep the read window short.
+  std::vector<SensorShmEntry> entries;
+  entries.reserve(kSensorShmMaxSensors);
+  for (int retry = 0; retry < kMaxReadRetries; ++retry) {
+    auto seqBefore = layout_->seq.load(std::memory_order_acquire);
+    if (seqBefore & 1) {
+      std::this_thread::yield();
+      continue;
+    }
+    SensorShmSnapshot snapshot;
+    snapshot.generation = layout_->generation;
+    snapshot.sampledAtNsec = layout_->sampledAtNsec;
+    snapshot.publishedAtNsec = layout_->publishedAtNsec;
+    auto numEntries = std::min<uint32_t>(
+        layout_->numEntries, static_cast<uint32_t>(kSensorShmMaxSensors));
+    entries.resize(numEntries);
+    std::memcpy(
+        entries.data(), layout_->entries, numEntries * sizeof(SensorShmEntry));
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (layout_->seq.load(std::memory_order_relaxed) != seqBefore) {
+      continue;
+    }
+    if (snapshot.generation == 0) {
+      return std::nullopt;
+    }
+    for (const auto& entry : entries) {
+      SensorData data;
+      data.name() =
+          std::string(entry.name, strnlen(entry.name, kSensorShmMaxNameLen));
+      data.value() = entry.value;
+      data.timeStamp() = entry.timeStamp;
+      snapshot.sensorData.emplace(*data.name(), std::move(data));
+    }
+    return snapshot;
+  }
+  XLOG(WARN) << "Could not take a consistent snapshot of " << shmName_;
+  return std::nullopt;
+}
+
+} // namespace facebook::fboss::platform::sensor_service
@@ -0,0 +1,109 @@
+/*
+ *  Copyright (c) 2004-present, Meta Platforms, Inc. and affiliates.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <gflags/gflags.h>
+
+#include "fboss/platform/sensor_service/if/gen-cpp2/sensor_service_types.h"
+
+DECLARE_string(sensor_shm_name);
+
+namespace facebook::fboss::platform::sensor_service {
+
+// Fixed layout of the sensor table published by sensor_service into POSIX
+// shared memory. Co-located readers (e.g. fan_service) map it read-only and
+// pick up the latest sensor values without a thrift round trip.
+//
+// The table has a single writer and is guarded by a sequence lock: the
+// writer makes seq odd, updates the entries and makes seq even again.
+// Readers copy the table and retry if seq was odd or changed underneath
+// them, so they never block the writer.
+constexpr uint32_t kSensorShmMagic = 0x53454e53; // "SENS"
+constexpr uint32_t kSensorShmLayoutVersion = 1;
+constexpr size_t kSensorShmMaxSensors = 512;
+constexpr size_t kSensorShmMaxNameLen = 64;
+
+struct SensorShmEntry {
+  char name[kSensorShmMaxNameLen];
+  float value;
+  int64_t timeStamp;
+};
+
+struct SensorShmLayout {
+  uint32_t magic;
+  uint32_t layoutVersion;
+  std::atomic<uint64_t> seq;
+  // Incremented on every publish, lets readers detect stale tables
+  uint64_t generation;
+  // CLOCK_MONOTONIC time (ns) at which the published values were sampled
+  uint64_t sampledAtNsec;
+  // CLOCK_MONOTONIC time (ns) at which the table was written
+  uint64_t publishedAtNsec;
+  uint32_t numEntries;
+  SensorShmEntry entries[kSensorShmMaxSensors];
+};
+
+static_assert(
+    std::atomic<uint64_t>::is_always_lock_free,
+    "Sequence counter in shared memory must be lock free");
+
+struct SensorShmSnapshot {
+  uint64_t generation{0};
+  uint64_t sampledAtNsec{0};
+  uint64_t publishedAtNsec{0};
+  std::map<std::string, SensorData> sensorData;
+};
+
+class SensorShmTable {
+ public:
+  ~SensorShmTable();
+
+  // Create (or truncate) the shared memory object and map it for writing.
+  // Throws on failure.
+  static std::unique_ptr<SensorShmTable> createWriter(
+      const std::string& shmName);
+  // Map an existing shared memory object read-only. Returns nullptr if the
+  // writer has not created it yet or the layout does not match ours.
+  static std::unique_ptr<SensorShmTable> openReader(
+      const std::string& shmName);
+
+  // Writer side. Sensors beyond kSensorShmMaxSensors are dropped.
+  void publish(
+      const std::map<std::string, SensorData>& sensorData,
+      uint64_t sampledAtNsec);
+
+  // Reader side. Returns std::nullopt if no consistent snapshot could be
+  // taken within a bounded number of retries, or nothing was published yet.
+  std::optional<SensorShmSnapshot> read() const;
+
+  static uint64_t nowNsec();
+
+ private:
+  SensorShmTable(
+      const std::string& shmName,
+      SensorShmLayout* layout,
+      bool writer);
+  SensorShmTable(const SensorShmTable&) = delete;
+  SensorShmTable& operator=(const SensorShmTable&) = delete;
+
+  const std::string shmName_;
+  SensorShmLayout* layout_{nullptr};
+  const bool writer_{false};
+};
+
+} // namespace facebook::fboss::platform::sensor_service
@@ -0,0 +1,108 @@
+// (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
+
+#include "fboss/platform/sensor_service/SensorShmTable.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include <atomic>
+#include <thread>
+
+#include <folly/Conv.h>
+#include <gtest/gtest.h>
+
+using namespace facebook::fboss::platform::sensor_service;
+
+namespace facebook::fboss {
+
+namespace {
+std::map<std::string, SensorData> makeSensorData(int numSensors, float value) {
+  std::map<std::string, SensorData> sensorData;
+  for (int i = 0; i < numSensors; ++i) {
+    SensorData data;
+    data.name() = folly::to<std::string>("SENSOR_", i);
+    data.value() = value;
+    data.timeStamp() = static_cast<int64_t>(value);
+    sensorData[*data.name()] = data;
+  }
+  return sensorData;
+}
+} // namespace
+
+class SensorShmTableTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    shmName_ = folly::to<std::string>("/sensor_shm_table_test_", getpid());
+  }
+  void TearDown() override {
+    shm_unlink(shmName_.c_str());
+  }
+
+  std::string shmName_;
+};
+
+TEST_F(SensorShmTableTest, readerBeforeWriter) {
+  EXPECT_EQ(SensorShmTable::openReader(shmName_), nullptr);
+}
+
+TEST_F(SensorShmTableTest, publishAndRead) {
+  auto writer = SensorShmTable::createWriter(shmName_);
+  auto reader = SensorShmTable::openReader(shmName_);
+  ASSERT_NE(reader, nullptr);
+  // Nothing published yet
+  EXPECT_FALSE(reader->read().has_value());
+
+  auto sensorData = makeSensorData(10, 42.5);
+  auto sampledAt = SensorShmTable::nowNsec();
+  writer->publish(sensorData, sampledAt);
+
+  auto snapshot = reader->read();
+  ASSERT_TRUE(snapshot.has_value());
+  EXPECT_EQ(snapshot->generation, 1);
+  EXPECT_EQ(snapshot->sampledAtNsec, sampledAt);
+  EXPECT_GE(snapshot->publishedAtNsec, sampledAt);
+  EXPECT_EQ(snapshot->sensorData, sensorData);
+
+  writer->publish(makeSensorData(5, 1.0), sampledAt);
+  snapshot = reader->read();
+  ASSERT_TRUE(snapshot.has_value());
+  EXPECT_EQ(snapshot->generation, 2);
+  EXPECT_EQ(snapshot->sensorData.size(), 5);
+}
+
+TEST_F(SensorShmTableTest, tooManySensors) {
+  auto writer = SensorShmTable::createWriter(shmName_);
+  auto reader = SensorShmTable::openReader(shmName_);
+  ASSERT_NE(reader, nullptr);
+  writer->publish(makeSensorData(kSensorShmMaxSensors + 10, 1.0), 0);
+  auto snapshot = reader->read();
+  ASSERT_TRUE(snapshot.has_value());
+  EXPECT_EQ(snapshot->sensorData.size(), kSensorShmMaxSensors);
+}
+
+TEST_F(SensorShmTableTest, concurrentReadsAreConsistent) {
+  auto writer = SensorShmTable::createWriter(shmName_);
+  auto reader = SensorShmTable::openReader(shmName_);
+  ASSERT_NE(reader, nullptr);
+  writer->publish(makeSensorData(100, 0), 0);
+
+  std::atomic<bool> done{false};
+  std::thread writerThread([&] {
+    for (int i = 1; i <= 2000; ++i) {
+      writer->publish(makeSensorData(100, i), i);
+    }
+    done = true;
+  });
+  while (!done) {
+    auto snapshot = reader->read();
+    if (!snapshot) {
+      continue;
+    }
+    // Every sensor in one snapshot must come from the same publish
+    for (const auto& [name, data] : snapshot->sensorData) {
+      EXPECT_EQ(*data.value(), static_cast<float>(snapshot->sampledAtNsec));
+    }
+  }
+  writerThread.join();
+}
+
+} // namespace facebook::fboss
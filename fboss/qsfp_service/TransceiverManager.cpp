@@ -34,6 +34,23 @@ DEFINE_int32(
     10000,
     "State machine update thread's heartbeat interval (ms)");
 
+DEFINE_bool(
+    event_driven_transceiver_state_machine,
+    false,
+    "Apply transceiver state machine updates as their events happen, on the "
+    "thread of each transceiver, and program transceivers without waiting "
+    "for refreshStateMachines() passes");
+
+DEFINE_int32(
+    state_machine_retry_min_ms,
+    100,
+    "First retry delay (ms) of failed event driven transceiver programming");
+
+DEFINE_int32(
+    state_machine_retry_max_ms,
+    10000,
+    "Max retry delay (ms) of failed event driven transceiver programming");
+
 namespace {
 constexpr auto kForceColdBootFileName = "cold_boot_once_qsfp_service";
 constexpr auto kWarmBootFlag = "can_warm_boot";
@@ -334,6 +351,16 @@ TransceiverManager::updateStateBlockingWithoutWait(
   return nullptr;
 }
 
+void TransceiverManager::updateStateForEvent(
+    TransceiverID id,
+    TransceiverStateMachineEvent event) {
+  if (!FLAGS_event_driven_transceiver_state_machine) {
+    updateStateBlocking(id, event);
+    return;
+  }
+  updateState(std::make_unique<TransceiverStateMachineUpdate>(id, event));
+}
+
 bool TransceiverManager::updateState(
     std::unique_ptr<TransceiverStateMachineUpdate> update) {
   if (isExiting_) {
@@ -341,6 +368,9 @@ bool TransceiverManager::updateState(
                << ", since exit already started";
     return false;
   }
+  if (FLAGS_event_driven_transceiver_state_machine) {
+    return updateStateOnTransceiverThread(std::move(update));
+  }
   if (!updateEventBase_) {
     XLOG(WARN) << "Skipped queueing update:" << update->getName()
                << ", since updateEventBase_ is not created yet";
@@ -440,6 +470,142 @@ void TransceiverManager::handlePendingUpdates() {
   }
 }
 
+bool TransceiverManager::updateStateOnTransceiverThread(
+    std::unique_ptr<TransceiverStateMachineUpdate> update) {
+  auto stateMachineItr = stateMachines_.find(update->getTransceiverID());
+  if (stateMachineItr == stateMachines_.end()) {
+    XLOG(WARN) << "Unrecognize Transceiver:" << update->getTransceiverID()
+               << ", can't find StateMachine for it. Skip updating.";
+    return false;
+  }
+  auto* stateMachineHelper = stateMachineItr->second.get();
+  auto* eventBase = stateMachineHelper->getEventBase();
+  if (!eventBase) {
+    XLOG(WARN) << "Skipped queueing update:" << update->getName()
+               << ", since the transceiver thread is not started yet";
+    return false;
+  }
+  // The EventBase of the transceiver is its update queue, so updates of one
+  // transceiver are applied in order while different transceivers don't
+  // wait for each other
+  eventBase->runInEventBaseThread(
+      [this, stateMachineHelper, update = std::move(update)]() mutable {
+        applyUpdateOnTransceiverThread(std::move(update), stateMachineHelper);
+      });
+  return true;
+}
+
+void TransceiverManager::applyUpdateOnTransceiverThread(
+    std::unique_ptr<TransceiverStateMachineUpdate> update,
+    TransceiverStateMachineHelper* stateMachineHelper) {
+  XLOG(DBG2) << "Preparing TransceiverStateMachine update for "
+             << update->getName();
+  try {
+    {
+      const auto& lockedStateMachine =
+          stateMachineHelper->getStateMachine().wlock();
+      update->applyUpdate(*lockedStateMachine);
+    }
+    update->onSuccess();
+  } catch (const std::exception& ex) {
+    update->onError(ex);
+    return;
+  }
+
+  auto tcvrID = update->getTransceiverID();
+  bool stateChanged = update->preState_ != update->newState_;
+  if (stateChanged) {
+    stateMachineHelper->resetRetryDelay();
+    triggerNextEvent(tcvrID, stateMachineHelper);
+    return;
+  }
+
+  // A programming event left the state unchanged, which means programming
+  // failed. Retry later unless something else has moved things along.
+  auto event = update->getEvent();
+  if (event != TransceiverStateMachineEvent::PROGRAM_IPHY &&
+      event != TransceiverStateMachineEvent::PROGRAM_XPHY &&
+      event != TransceiverStateMachineEvent::PROGRAM_TRANSCEIVER) {
+    return;
+  }
+  {
+    const auto& lockedStateMachine =
+        stateMachineHelper->getStateMachine().rlock();
+    if (getProgrammingEvent(*lockedStateMachine) != event) {
+      return;
+    }
+  }
+  auto delay = stateMachineHelper->nextRetryDelay();
+  XLOG(INFO) << "Retrying " << update->getName() << " in " << delay.count()
+             << "ms";
+  stateMachineHelper->getEventBase()->runAfterDelay(
+      [this, tcvrID, stateMachineHelper]() {
+        triggerNextEvent(tcvrID, stateMachineHelper);
+      },
+      delay.count());
+}
+
+void TransceiverManager::triggerNextEvent(
+    TransceiverID id,
+    TransceiverStateMachineHelper* stateMachineHelper) {
+  std::optional<TransceiverStateMachineEvent> event;
+  TransceiverStateMachineState curState;
+  {
+    const auto& lockedStateMachine =
+        stateMachineHelper->getStateMachine().rlock();
+    curState = getStateByOrder(*lockedStateMachine->current_state());
+    event = getProgrammingEvent(*lockedStateMachine);
+  }
+  // A PRESENT transceiver waits for READ_EEPROM from its next refresh
+  if (curState == TransceiverStateMachineState::PRESENT ||
+      curState == TransceiverStateMachineState::UPGRADING) {
+    return;
+  }
+  if (!event &&
+      curState == TransceiverStateMachineState::TRANSCEIVER_PROGRAMMED) {
+    // Settle the active state from the port status we already know of.
+    // Otherwise the next agent port status sync will.
+    event = getPortStatusEvent(id);
+  }
+  if (event) {
+    updateState(std::make_unique<TransceiverStateMachineUpdate>(id, *event));
+  }
+}
+
+std::optional<TransceiverStateMachineEvent>
+TransceiverManager::getProgrammingEvent(
+    const state_machine<TransceiverStateMachine>& stateMachine) const {
+  if (!stateMachine.get_attribute(isIphyProgrammed)) {
+    return TransceiverStateMachineEvent::PROGRAM_IPHY;
+  } else if (
+      !stateMachine.get_attribute(isXphyProgrammed) && phyManager_ != nullptr) {
+    return TransceiverStateMachineEvent::PROGRAM_XPHY;
+  } else if (!stateMachine.get_attribute(isTransceiverProgrammed)) {
+    return TransceiverStateMachineEvent::PROGRAM_TRANSCEIVER;
+  }
+  return std::nullopt;
+}
+
+std::optional<TransceiverStateMachineEvent>
+TransceiverManager::getPortStatusEvent(TransceiverID id) const {
+  auto portToPortInfoIt = tcvrToPortInfo_.find(id);
+  if (portToPortInfoIt == tcvrToPortInfo_.end()) {
+    return std::nullopt;
+  }
+  std::optional<TransceiverStateMachineEvent> event;
+  auto portToPortInfoWithLock = portToPortInfoIt->second->rlock();
+  for (const auto& [portID, portInfo] : *portToPortInfoWithLock) {
+    if (!portInfo.status) {
+      continue;
+    }
+    if (*portInfo.status->up()) {
+      return TransceiverStateMachineEvent::PORT_UP;
+    }
+    event = TransceiverStateMachineEvent::ALL_PORTS_DOWN;
+  }
+  return event;
+}
+
 TransceiverStateMachineState TransceiverManager::getCurrentState(
     TransceiverID id) const {
   auto stateMachineItr = stateMachines_.find(id);
@@ -483,37 +649,30 @@ std::vector<TransceiverID> TransceiverManager::triggerProgrammingEvents() {
   BlockingStateUpdateResultList results;
   steady_clock::time_point begin = steady_clock::now();
   for (auto& stateMachine : stateMachines_) {
-    bool needProgramIphy{false}, needProgramXphy{false}, needProgramTcvr{false};
+    std::optional<TransceiverStateMachineEvent> event;
     {
       const auto& lockedStateMachine =
           stateMachine.second->getStateMachine().rlock();
-      needProgramIphy = !lockedStateMachine->get_attribute(isIphyProgrammed);
-      needProgramXphy = !lockedStateMachine->get_attribute(isXphyProgrammed);
-      needProgramTcvr =
-          !lockedStateMachine->get_attribute(isTransceiverProgrammed);
+      event = getProgrammingEvent(*lockedStateMachine);
+    }
+    if (!event) {
+      continue;
     }
     auto tcvrID = stateMachine.first;
-    if (needProgramIphy) {
-      if (auto result = updateStateBlockingWithoutWait(
-              tcvrID, TransceiverStateMachineEvent::PROGRAM_IPHY)) {
-        programmedTcvrs.push_back(tcvrID);
-        ++numProgramIphy;
-        results.push_back(result);
-      }
-    } else if (needProgramXphy && phyManager_ != nullptr) {
-      if (auto result = updateStateBlockingWithoutWait(
-              tcvrID, TransceiverStateMachineEvent::PROGRAM_XPHY)) {
-        programmedTcvrs.push_back(tcvrID);
-        ++numProgramXphy;
-        results.push_back(result);
-      }
-    } else if (needProgramTcvr) {
-      if (auto result = updateStateBlockingWithoutWait(
-              tcvrID, TransceiverStateMachineEvent::PROGRAM_TRANSCEIVER)) {
-        programmedTcvrs.push_back(tcvrID);
-        ++numProgramTcvr;
-        results.push_back(result);
+    if (auto result = updateStateBlockingWithoutWait(tcvrID, *event)) {
+      programmedTcvrs.push_back(tcvrID);
+      switch (*event) {
+        case TransceiverStateMachineEvent::PROGRAM_IPHY:
+          ++numProgramIphy;
+          break;
+        case TransceiverStateMachineEvent::PROGRAM_XPHY:
+          ++numProgramXphy;
+          break;
+        default:
+          ++numProgramTcvr;
+          break;
       }
+      results.push_back(result);
     }
   }
   waitForAllBlockingStateUpdateDone(results);
@@ -956,8 +1115,13 @@ void TransceiverManager::refreshStateMachines() {
   // Step3: Check whether there's a wedge_agent config change
   triggerAgentConfigChangeEvent();
 
-  // Step4: Once the transceivers are detected, trigger programming events
-  const auto& programmedTcvrs = triggerProgrammingEvents();
+  // Step4: Once the transceivers are detected, trigger programming events.
+  // Event driven state machines program transceivers as soon as they are
+  // ready, so this pass only refreshes DOM and polls agent and remediation.
+  std::vector<TransceiverID> programmedTcvrs;
+  if (!FLAGS_event_driven_transceiver_state_machine) {
+    programmedTcvrs = triggerProgrammingEvents();
+  }
 
   // Step5: Remediate inactive transceivers
   // Only need to remediate ports which are not recently finished
@@ -1105,11 +1269,27 @@ void TransceiverManager::TransceiverStateMachineHelper::startThread() {
 
 void TransceiverManager::TransceiverStateMachineHelper::stopThread() {
   if (updateThread_) {
-    updateEventBase_->terminateLoopSoon();
+    if (FLAGS_event_driven_transceiver_state_machine) {
+      // Let already queued updates finish, so no blocking caller is left
+      // waiting on them
+      updateEventBase_->runInEventBaseThread(
+          [this] { updateEventBase_->terminateLoopSoon(); });
+    } else {
+      updateEventBase_->terminateLoopSoon();
+    }
     updateThread_->join();
   }
 }
 
+std::chrono::milliseconds
+TransceiverManager::TransceiverStateMachineHelper::nextRetryDelay() {
+  retryDelay_ = std::clamp(
+      retryDelay_ * 2,
+      std::chrono::milliseconds(FLAGS_state_machine_retry_min_ms),
+      std::chrono::milliseconds(FLAGS_state_machine_retry_max_ms));
+  return retryDelay_;
+}
+
 void TransceiverManager::waitForAllBlockingStateUpdateDone(
     const TransceiverManager::BlockingStateUpdateResultList& results) {
   for (const auto& result : results) {
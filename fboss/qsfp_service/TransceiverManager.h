@@ -29,11 +29,14 @@
 #include <folly/IntrusiveList.h>
 #include <folly/SpinLock.h>
 #include <folly/Synchronized.h>
+#include <chrono>
 #include <map>
+#include <optional>
 #include <vector>
 
 DECLARE_string(qsfp_service_volatile_dir);
 DECLARE_bool(can_qsfp_service_warm_boot);
+DECLARE_bool(event_driven_transceiver_state_machine);
 
 namespace facebook::fboss {
 class TransceiverManager {
@@ -251,6 +254,13 @@ class TransceiverManager {
   updateStateBlockingWithoutWait(
       TransceiverID id,
       TransceiverStateMachineEvent event);
+  // For transceiver events like presence changes. With event driven state
+  // machines, updates of a transceiver are applied in order on its own thread
+  // so there is no need to wait for them. Otherwise same as
+  // updateStateBlocking().
+  void updateStateForEvent(
+      TransceiverID id,
+      TransceiverStateMachineEvent event);
 
   TransceiverStateMachineState getCurrentState(TransceiverID id) const;
 
@@ -501,6 +511,12 @@ class TransceiverManager {
       return heartbeat_;
     }
 
+    // Backoff of event driven retries. Only used from the update thread.
+    std::chrono::milliseconds nextRetryDelay();
+    void resetRetryDelay() {
+      retryDelay_ = std::chrono::milliseconds(0);
+    }
+
    private:
     TransceiverID tcvrID_;
     folly::Synchronized<state_machine<TransceiverStateMachine>> stateMachine_;
@@ -509,6 +525,7 @@ class TransceiverManager {
     std::unique_ptr<std::thread> updateThread_;
     std::unique_ptr<folly::EventBase> updateEventBase_;
     std::shared_ptr<ThreadHeartbeat> heartbeat_;
+    std::chrono::milliseconds retryDelay_{0};
   };
 
   using TransceiverToStateMachineHelper = std::unordered_map<
@@ -541,6 +558,29 @@ class TransceiverManager {
   static void handlePendingUpdatesHelper(TransceiverManager* mgr);
   void handlePendingUpdates();
 
+  /*
+   * Event driven state machines: updates skip the shared update thread and
+   * are queued on the thread of their transceiver, which applies them in
+   * order. Once applied, the next event needed to finish programming the
+   * transceiver is queued right away, and failed programming is retried
+   * with backoff.
+   */
+  bool updateStateOnTransceiverThread(
+      std::unique_ptr<TransceiverStateMachineUpdate> update);
+  void applyUpdateOnTransceiverThread(
+      std::unique_ptr<TransceiverStateMachineUpdate> update,
+      TransceiverStateMachineHelper* stateMachineHelper);
+  void triggerNextEvent(
+      TransceiverID id,
+      TransceiverStateMachineHelper* stateMachineHelper);
+
+  // The next programming event the state machine needs, if any
+  std::optional<TransceiverStateMachineEvent> getProgrammingEvent(
+      const state_machine<TransceiverStateMachine>& stateMachine) const;
+  // PORT_UP or ALL_PORTS_DOWN from the cached port status, if any is known
+  std::optional<TransceiverStateMachineEvent> getPortStatusEvent(
+      TransceiverID id) const;
+
   // Check whether iphy/xphy/transceiver programmed is done. If not, then
   // trigger the corresponding program event to program the component.
   // Return the list of transceivers that have programming events
@@ -105,7 +105,7 @@ QsfpModule::QsfpModule(
 QsfpModule::~QsfpModule() {
   // The transceiver has been removed
   lock_guard<std::mutex> g(qsfpModuleMutex_);
-  getTransceiverManager()->updateStateBlocking(
+  getTransceiverManager()->updateStateForEvent(
       getID(), TransceiverStateMachineEvent::REMOVE_TRANSCEIVER);
 }
 
@@ -392,11 +392,11 @@ void QsfpModule::refreshLocked() {
 
   if (detectionStatus.statusChanged && detectionStatus.present) {
     // A new transceiver has been detected
-    getTransceiverManager()->updateStateBlocking(
+    getTransceiverManager()->updateStateForEvent(
         getID(), TransceiverStateMachineEvent::DETECT_TRANSCEIVER);
   } else if (detectionStatus.statusChanged && !detectionStatus.present) {
     // The transceiver has been removed
-    getTransceiverManager()->updateStateBlocking(
+    getTransceiverManager()->updateStateForEvent(
         getID(), TransceiverStateMachineEvent::REMOVE_TRANSCEIVER);
   }
 
@@ -412,7 +412,7 @@ void QsfpModule::refreshLocked() {
     updateCmisStateChanged(moduleStatus);
     if (present_) {
       // Data has been read for the new optics
-      getTransceiverManager()->updateStateBlocking(
+      getTransceiverManager()->updateStateForEvent(
           getID(), TransceiverStateMachineEvent::READ_EEPROM);
       // Issue an allPages=false update to pick up the new qsfp data after we
       // trigger READ_EEPROM event. Some Transceiver might pick up all the diag
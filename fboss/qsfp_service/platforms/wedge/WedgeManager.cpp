@@ -6,6 +6,7 @@
 #include "fboss/fsdb/common/Flags.h"
 #include "fboss/lib/config/PlatformConfigUtils.h"
 #include "fboss/lib/fpga/MultiPimPlatformSystemContainer.h"
+#include "fboss/lib/i2c/I2cController.h"
 #include "fboss/qsfp_service/QsfpConfig.h"
 #include "fboss/qsfp_service/if/gen-cpp2/qsfp_service_config_types.h"
 #include "fboss/qsfp_service/if/gen-cpp2/transceiver_types.h"
@@ -573,6 +574,24 @@ void WedgeManager::publishI2cTransactionStats() {
     statName = folly::to<std::string>(
         "qsfp.", *counter.controllerName_(), ".writeBytes");
     tcData().setCounter(statName, *counter.writeBytes_());
+
+    for (auto pct : {50, 99}) {
+      statName = folly::to<std::string>(
+          "qsfp.", *counter.controllerName_(), ".readLatencyUs.p", pct);
+      tcData().setCounter(
+          statName,
+          I2cController::latencyPercentile(
+              *counter.readLatencyUsBuckets_(), pct)
+              .count());
+
+      statName = folly::to<std::string>(
+          "qsfp.", *counter.controllerName_(), ".writeLatencyUs.p", pct);
+      tcData().setCounter(
+          statName,
+          I2cController::latencyPercentile(
+              *counter.writeLatencyUsBuckets_(), pct)
+              .count());
+    }
   }
 }
 
@@ -806,6 +825,15 @@ void WedgeManager::updateAllXphyPortsStats() {
   }
   // Then we need to update all the programmed port xphy stats
   phyManager_->updateAllXphyPortsStats();
+
+  // Publish how long the last collection took on each pim, if collected
+  // per pim
+  for (const auto& [pim, took] : phyManager_->getXphyStatsCollectionTimes()) {
+    tcData().setCounter(
+        folly::to<std::string>(
+            "qsfp.xphy.pim.", static_cast<int>(pim), ".statsCollectionMs"),
+        took.count());
+  }
 }
 
 std::vector<PortID> WedgeManager::getMacsecCapablePorts() const {
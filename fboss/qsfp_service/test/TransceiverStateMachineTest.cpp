@@ -17,6 +17,8 @@
 #include "fboss/qsfp_service/module/tests/MockSffModule.h"
 #include "fboss/qsfp_service/test/hw_test/HwTransceiverUtils.h"
 
+#include <thread>
+
 namespace facebook::fboss {
 
 namespace {
@@ -1673,4 +1675,49 @@ TEST_F(TransceiverStateMachineTest, reseatTransceiver) {
   // Step3: Insert the transceiver back and call refreshStateMachine()
   removeCmisTransceiver(false);
 }
+
+TEST_F(TransceiverStateMachineTest, eventDrivenInsertionToProgrammedLatency) {
+  gflags::FlagSaver flagSaver;
+  FLAGS_event_driven_transceiver_state_machine = true;
+  // Pause remediation
+  transceiverManager_->setPauseRemediation(60, nullptr);
+
+  // Insert a transceiver which already has agent ports
+  xcvr_ = overrideTransceiver(TransceiverType::CMIS);
+  transceiverManager_->setOverrideTcvrToPortAndProfileForTesting(
+      overrideTcvrToPortAndProfile_);
+  EXPECT_EQ(
+      transceiverManager_->getCurrentState(id_),
+      TransceiverStateMachineState::NOT_PRESENT);
+
+  // The DOM refresh detecting the transceiver should be the only pass
+  // needed, with no refreshStateMachines() to advance programming
+  auto inserted = std::chrono::steady_clock::now();
+  transceiverManager_->refreshTransceivers();
+  auto deadline = inserted + std::chrono::seconds(5);
+  while (transceiverManager_->getCurrentState(id_) !=
+             TransceiverStateMachineState::TRANSCEIVER_PROGRAMMED &&
+         std::chrono::steady_clock::now() < deadline) {
+    /* sleep override */
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  auto latency = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - inserted);
+  XLOG(INFO) << "Transceiver=" << id_
+             << " insertion to programmed latency(ms):" << latency.count();
+
+  EXPECT_EQ(
+      transceiverManager_->getCurrentState(id_),
+      TransceiverStateMachineState::TRANSCEIVER_PROGRAMMED);
+  const auto& stateMachine =
+      transceiverManager_->getStateMachineForTesting(id_);
+  EXPECT_TRUE(stateMachine.get_attribute(isIphyProgrammed));
+  EXPECT_TRUE(stateMachine.get_attribute(isTransceiverProgrammed));
+
+  // Agent port status then settles the active state right away too
+  updateTransceiverActiveState(true /* up */, true /* enabled */);
+  EXPECT_EQ(
+      transceiverManager_->getCurrentState(id_),
+      TransceiverStateMachineState::ACTIVE);
+}
 } // namespace facebook::fboss
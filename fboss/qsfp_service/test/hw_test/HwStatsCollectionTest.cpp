@@ -7,6 +7,7 @@
  *  of patent rights can be found in the PATENTS file in the same directory.
  *
  */
+#include "fboss/lib/phy/PhyManager.h"
 #include "fboss/qsfp_service/StatsPublisher.h"
 #include "fboss/qsfp_service/platforms/wedge/WedgeManager.h"
 #include "fboss/qsfp_service/test/hw_test/HwExternalPhyPortTest.h"
@@ -78,6 +79,12 @@ TEST_F(HwXphyPortStatsCollectionTest, checkXphyStatsCollectionDone) {
   runTest();
 }
 
+TEST_F(HwXphyPortStatsCollectionTest, checkPipelinedXphyStatsCollectionDone) {
+  gflags::FlagSaver flagSaver;
+  FLAGS_xphy_pipelined_stats_collection = true;
+  runTest();
+}
+
 // This is a basic test that doesn't require hardware. It's here in hw_test
 // because Fake SDK doesn't support XPHY APIs in BCM SDK yet.
 //
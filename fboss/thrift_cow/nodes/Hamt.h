@@ -0,0 +1,798 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <folly/hash/Hash.h>
+#include <folly/lang/Bits.h>
+
+namespace facebook::fboss::thrift_cow {
+
+/*
+ * Persistent hash array mapped tries, used as the storage of map and set
+ * nodes.
+ *
+ * Copying a trie only copies a pointer to its root, so cloning a node is
+ * O(1) no matter how many children it has. Trie nodes are shared between
+ * copies until one of them gets modified, at which point only the trie
+ * nodes on the path to the modified entry get copied, which is O(log n).
+ * A trie node is modified in place when nothing else holds on to it.
+ *
+ * Since copies share whatever they did not modify, diff() can compare two
+ * versions of a trie by skipping every subtree the two have in common.
+ *
+ * Each trie node branches on 5 bits of the hash of its keys, holding
+ * entries inline until two of them land in the same slot. Keys whose 64 bit
+ * hashes are equal end up in a flat collision node at the bottom.
+ *
+ * Iterators are invalidated by any modification. Mutable iterators point
+ * into trie nodes that are not shared, so begin() unshares the whole trie
+ * first, while find() only unshares the path to the entry.
+ */
+
+namespace hamt_detail {
+
+constexpr uint32_t kBitsPerLevel = 5;
+constexpr uint32_t kSlotMask = (1 << kBitsPerLevel) - 1;
+// Trie nodes at or past this shift are collision nodes
+constexpr uint32_t kCollisionShift = 64;
+// 13 levels of trie nodes, plus one of collision nodes
+constexpr uint32_t kMaxDepth = kCollisionShift / kBitsPerLevel + 2;
+
+inline uint32_t slotOf(uint64_t hash, uint32_t shift) {
+  return (hash >> shift) & kSlotMask;
+}
+
+inline uint32_t bitOf(uint64_t hash, uint32_t shift) {
+  return 1u << slotOf(hash, shift);
+}
+
+inline bool isCollisionLevel(uint32_t level) {
+  return level * kBitsPerLevel >= kCollisionShift;
+}
+
+// Position of the slot of bit among the occupied slots of bitmap
+inline uint32_t indexOf(uint32_t bitmap, uint32_t bit) {
+  return folly::popcount(bitmap & (bit - 1));
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+struct MapPolicy {
+  using key_type = K;
+  using value_type = std::pair<const K, V>;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  static constexpr bool kIsSet = false;
+
+  static const K& key(const value_type& value) {
+    return value.first;
+  }
+};
+
+template <typename V, typename Hash, typename KeyEqual>
+struct SetPolicy {
+  using key_type = V;
+  using value_type = V;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  static constexpr bool kIsSet = true;
+
+  static const V& key(const value_type& value) {
+    return value;
+  }
+};
+
+template <typename Policy>
+class HamtBase {
+ public:
+  using key_type = typename Policy::key_type;
+  using value_type = typename Policy::value_type;
+  using hasher = typename Policy::hasher;
+  using key_equal = typename Policy::key_equal;
+  using size_type = std::size_t;
+
+ private:
+  struct Leaf {
+    uint64_t hash;
+    value_type value;
+  };
+
+  struct Node {
+    // Occupied slots holding an entry, and holding a child trie node.
+    // Unused by collision nodes.
+    uint32_t entryMap{0};
+    uint32_t childMap{0};
+    // In slot order
+    std::vector<Leaf> entries;
+    std::vector<std::shared_ptr<Node>> children;
+  };
+
+  // Position of an iterator within a trie node: the slot of the entry or
+  // of the child it descended into, or the index of the entry in collision
+  // nodes.
+  struct Frame {
+    const Node* node;
+    uint32_t pos;
+  };
+
+ public:
+  template <bool Const>
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename Policy::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<
+        Const || Policy::kIsSet,
+        const value_type&,
+        value_type&>;
+    using pointer = std::remove_reference_t<reference>*;
+
+    Iterator() = default;
+
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    /* implicit */ Iterator(const Iterator<false>& other)
+        : frames_(other.frames_), depth_(other.depth_) {}
+
+    reference operator*() const {
+      const auto& frame = frames_[depth_ - 1];
+      auto idx = isCollisionLevel(depth_ - 1)
+          ? frame.pos
+          : indexOf(frame.node->entryMap, 1u << frame.pos);
+      // Mutable iterators only ever point into unshared trie nodes
+      return const_cast<value_type&>(frame.node->entries[idx].value);
+    }
+
+    pointer operator->() const {
+      return &**this;
+    }
+
+    Iterator& operator++() {
+      ++frames_[depth_ - 1].pos;
+      settle();
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto it = *this;
+      ++*this;
+      return it;
+    }
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) {
+      if (lhs.depth_ != rhs.depth_) {
+        return false;
+      }
+      if (lhs.depth_ == 0) {
+        return true;
+      }
+      const auto& lhsFrame = lhs.frames_[lhs.depth_ - 1];
+      const auto& rhsFrame = rhs.frames_[rhs.depth_ - 1];
+      return lhsFrame.node == rhsFrame.node && lhsFrame.pos == rhsFrame.pos;
+    }
+
+    friend bool operator!=(const Iterator& lhs, const Iterator& rhs) {
+      return !(lhs == rhs);
+    }
+
+   private:
+    friend class HamtBase;
+    template <bool>
+    friend class Iterator;
+
+    explicit Iterator(const Node* root) {
+      if (root) {
+        push(root, 0);
+        settle();
+      }
+    }
+
+    void push(const Node* node, uint32_t pos) {
+      frames_[depth_++] = {node, pos};
+    }
+
+    /*
+     * Move to the next entry at or after the current position. Entries
+     * are visited in slot order, descending into children as they come,
+     * so that entries keep their relative order when erasing merges a
+     * child back into its parent.
+     */
+    void settle() {
+      while (depth_ > 0) {
+        auto& frame = frames_[depth_ - 1];
+        const auto* node = frame.node;
+        if (isCollisionLevel(depth_ - 1)) {
+          if (frame.pos < node->entries.size()) {
+            return;
+          }
+        } else if (
+            auto occupied =
+                uint64_t(node->entryMap | node->childMap) >> frame.pos) {
+          frame.pos += folly::findFirstSet(occupied) - 1;
+          auto bit = 1u << frame.pos;
+          if (node->entryMap & bit) {
+            return;
+          }
+          push(node->children[indexOf(node->childMap, bit)].get(), 0);
+          continue;
+        }
+        if (--depth_ > 0) {
+          ++frames_[depth_ - 1].pos;
+        }
+      }
+    }
+
+    std::array<Frame, kMaxDepth> frames_;
+    uint32_t depth_{0};
+  };
+
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  HamtBase() = default;
+
+  size_type size() const {
+    return size_;
+  }
+
+  bool empty() const {
+    return size_ == 0;
+  }
+
+  void clear() {
+    root_.reset();
+    size_ = 0;
+  }
+
+  iterator begin() {
+    if (root_) {
+      unshareAll(root_);
+    }
+    return iterator(root_.get());
+  }
+
+  const_iterator begin() const {
+    return const_iterator(root_.get());
+  }
+
+  iterator end() {
+    return iterator();
+  }
+
+  const_iterator end() const {
+    return const_iterator();
+  }
+
+  const_iterator cbegin() const {
+    return begin();
+  }
+
+  const_iterator cend() const {
+    return end();
+  }
+
+  const_iterator find(const key_type& key) const {
+    auto hash = hashOf(key);
+    const_iterator it;
+    const Node* node = root_.get();
+    for (uint32_t shift = 0; node; shift += kBitsPerLevel) {
+      if (shift >= kCollisionShift) {
+        for (uint32_t i = 0; i < node->entries.size(); ++i) {
+          if (matches(node->entries[i], hash, key)) {
+            it.push(node, i);
+            return it;
+          }
+        }
+        return end();
+      }
+      auto bit = bitOf(hash, shift);
+      if (node->entryMap & bit) {
+        auto idx = indexOf(node->entryMap, bit);
+        if (!matches(node->entries[idx], hash, key)) {
+          return end();
+        }
+        it.push(node, slotOf(hash, shift));
+        return it;
+      }
+      if (!(node->childMap & bit)) {
+        return end();
+      }
+      auto idx = indexOf(node->childMap, bit);
+      it.push(node, slotOf(hash, shift));
+      node = node->children[idx].get();
+    }
+    return end();
+  }
+
+  iterator find(const key_type& key) {
+    // Only copy the path to entries that exist
+    if (!count(key)) {
+      return end();
+    }
+    return findOrInsert(key, hashOf(key), static_cast<NoInsert*>(nullptr))
+        .first;
+  }
+
+  size_type count(const key_type& key) const {
+    return std::as_const(*this).find(key) == end() ? 0 : 1;
+  }
+
+  size_type erase(const key_type& key) {
+    if (count(key) == 0) {
+      return 0;
+    }
+    eraseFrom(*unshare(root_), 0, hashOf(key), key);
+    if (--size_ == 0) {
+      root_.reset();
+    }
+    return 1;
+  }
+
+  iterator erase(const_iterator pos) {
+    // Trie nodes may get merged on erase, so look up the next entry again
+    std::optional<key_type> nextKey;
+    if (auto next = std::next(pos); next != cend()) {
+      nextKey = Policy::key(*next);
+    }
+    key_type key = Policy::key(*pos);
+    erase(key);
+    return nextKey ? find(*nextKey) : end();
+  }
+
+  iterator erase(iterator pos) {
+    return erase(const_iterator(pos));
+  }
+
+  /*
+   * Visit the differences between two tries, calling onRemoved with
+   * entries only in oldTrie, onAdded with entries only in newTrie and
+   * onBoth with the old and new entry of keys in both. Subtrees shared by
+   * the two tries are skipped entirely, so diffing a copy against the
+   * original is proportional to what was modified since the copy.
+   */
+  template <typename OnRemoved, typename OnAdded, typename OnBoth>
+  static void diff(
+      const HamtBase& oldTrie,
+      const HamtBase& newTrie,
+      OnRemoved&& onRemoved,
+      OnAdded&& onAdded,
+      OnBoth&& onBoth) {
+    diffNodes(
+        oldTrie.root_.get(),
+        newTrie.root_.get(),
+        0,
+        onRemoved,
+        onAdded,
+        onBoth);
+  }
+
+ protected:
+  /*
+   * Return the entry of key, copying the path to it if shared. If missing
+   * and makeValue is set, insert the value it returns.
+   */
+  template <typename MakeValue>
+  std::pair<iterator, bool>
+  findOrInsert(const key_type& key, uint64_t hash, MakeValue* makeValue) {
+    iterator it;
+    if (!root_) {
+      root_ = std::make_shared<Node>();
+    }
+    Node* node = unshare(root_);
+    for (uint32_t shift = 0;; shift += kBitsPerLevel) {
+      if (shift >= kCollisionShift) {
+        for (uint32_t i = 0; i < node->entries.size(); ++i) {
+          if (matches(node->entries[i], hash, key)) {
+            it.push(node, i);
+            return {it, false};
+          }
+        }
+        if (!makeValue) {
+          return {end(), false};
+        }
+        node->entries.push_back(Leaf{hash, (*makeValue)()});
+        it.push(node, node->entries.size() - 1);
+        ++size_;
+        return {it, true};
+      }
+
+      auto bit = bitOf(hash, shift);
+      if (node->childMap & bit) {
+        it.push(node, slotOf(hash, shift));
+        node = unshare(node->children[indexOf(node->childMap, bit)]);
+        continue;
+      }
+
+      auto idx = indexOf(node->entryMap, bit);
+      if (node->entryMap & bit) {
+        if (matches(node->entries[idx], hash, key)) {
+          it.push(node, slotOf(hash, shift));
+          return {it, false};
+        }
+        if (!makeValue) {
+          return {end(), false};
+        }
+        // Two entries in the same slot, move the existing one down into a
+        // new child and keep looking for a slot for the new one there
+        auto child = std::make_shared<Node>();
+        auto childShift = shift + kBitsPerLevel;
+        if (childShift < kCollisionShift) {
+          child->entryMap = bitOf(node->entries[idx].hash, childShift);
+        }
+        insertAt(child->entries, 0, std::move(node->entries[idx]));
+        eraseAt(node->entries, idx);
+        node->entryMap &= ~bit;
+        node->childMap |= bit;
+        it.push(node, slotOf(hash, shift));
+        auto* childNode = child.get();
+        insertAt(
+            node->children, indexOf(node->childMap, bit), std::move(child));
+        node = childNode;
+        continue;
+      }
+
+      if (!makeValue) {
+        return {end(), false};
+      }
+      insertAt(node->entries, idx, Leaf{hash, (*makeValue)()});
+      node->entryMap |= bit;
+      it.push(node, slotOf(hash, shift));
+      ++size_;
+      return {it, true};
+    }
+  }
+
+  // Stands in for the value factory of lookups that must not insert
+  struct NoInsert {
+    value_type operator()() const {
+      throw std::logic_error("Unexpected insert into HAMT");
+    }
+  };
+
+  static uint64_t hashOf(const key_type& key) {
+    return folly::hash::twang_mix64(hasher{}(key));
+  }
+
+ private:
+  static bool matches(const Leaf& leaf, uint64_t hash, const key_type& key) {
+    return leaf.hash == hash && key_equal{}(Policy::key(leaf.value), key);
+  }
+
+  // Entries and children are replaced rather than shifted in place, as map
+  // entries have const keys and so cannot be assigned to.
+  template <typename T>
+  static void insertAt(std::vector<T>& values, std::size_t pos, T&& value) {
+    std::vector<T> result;
+    result.reserve(values.size() + 1);
+    for (std::size_t i = 0; i < pos; ++i) {
+      result.push_back(std::move(values[i]));
+    }
+    result.push_back(std::move(value));
+    for (std::size_t i = pos; i < values.size(); ++i) {
+      result.push_back(std::move(values[i]));
+    }
+    values.swap(result);
+  }
+
+  template <typename T>
+  static void eraseAt(std::vector<T>& values, std::size_t pos) {
+    std::vector<T> result;
+    result.reserve(values.size() - 1);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      if (i != pos) {
+        result.push_back(std::move(values[i]));
+      }
+    }
+    values.swap(result);
+  }
+
+  // Copy a trie node that is also referenced by another trie
+  static Node* unshare(std::shared_ptr<Node>& node) {
+    if (node.use_count() > 1) {
+      node = std::make_shared<Node>(*node);
+    }
+    return node.get();
+  }
+
+  static void unshareAll(std::shared_ptr<Node>& node) {
+    for (auto& child : unshare(node)->children) {
+      unshareAll(child);
+    }
+  }
+
+  // Erase key, which must exist under node. Children left with a single
+  // entry get merged back into node, so that the trie stays compact.
+  static void eraseFrom(
+      Node& node,
+      uint32_t shift,
+      uint64_t hash,
+      const key_type& key) {
+    if (shift >= kCollisionShift) {
+      for (std::size_t i = 0; i < node.entries.size(); ++i) {
+        if (matches(node.entries[i], hash, key)) {
+          eraseAt(node.entries, i);
+          return;
+        }
+      }
+      return;
+    }
+
+    auto bit = bitOf(hash, shift);
+    if (node.entryMap & bit) {
+      eraseAt(node.entries, indexOf(node.entryMap, bit));
+      node.entryMap &= ~bit;
+      return;
+    }
+
+    auto childIdx = indexOf(node.childMap, bit);
+    auto* child = unshare(node.children[childIdx]);
+    eraseFrom(*child, shift + kBitsPerLevel, hash, key);
+    if (!child->children.empty() || child->entries.size() > 1) {
+      return;
+    }
+    if (child->entries.size() == 1) {
+      node.entryMap |= bit;
+      insertAt(
+          node.entries,
+          indexOf(node.entryMap, bit),
+          std::move(child->entries.front()));
+    }
+    eraseAt(node.children, childIdx);
+    node.childMap &= ~bit;
+  }
+
+  template <typename Fn>
+  static void forEach(const Node& node, Fn& fn) {
+    for (const auto& leaf : node.entries) {
+      fn(leaf.value);
+    }
+    for (const auto& child : node.children) {
+      forEach(*child, fn);
+    }
+  }
+
+  // Lookup of a key known to hash into the subtree of node
+  static const Leaf*
+  lookup(const Node& node, uint32_t shift, uint64_t hash, const key_type& key) {
+    if (shift >= kCollisionShift) {
+      for (const auto& leaf : node.entries) {
+        if (matches(leaf, hash, key)) {
+          return &leaf;
+        }
+      }
+      return nullptr;
+    }
+    auto bit = bitOf(hash, shift);
+    if (node.entryMap & bit) {
+      const auto& leaf = node.entries[indexOf(node.entryMap, bit)];
+      return matches(leaf, hash, key) ? &leaf : nullptr;
+    }
+    if (node.childMap & bit) {
+      return lookup(
+          *node.children[indexOf(node.childMap, bit)],
+          shift + kBitsPerLevel,
+          hash,
+          key);
+    }
+    return nullptr;
+  }
+
+  // Diff a single entry against the subtree in the same slot, on the old
+  // side if isOld is set
+  template <typename OnRemoved, typename OnAdded, typename OnBoth>
+  static void diffLeaf(
+      const Leaf& leaf,
+      bool isOld,
+      const Node& subtree,
+      uint32_t shift,
+      OnRemoved& onRemoved,
+      OnAdded& onAdded,
+      OnBoth& onBoth) {
+    const auto& leafKey = Policy::key(leaf.value);
+    auto other = [&](const value_type& value) {
+      if (key_equal{}(Policy::key(value), leafKey)) {
+        return;
+      }
+      if (isOld) {
+        onAdded(value);
+      } else {
+        onRemoved(value);
+      }
+    };
+    forEach(subtree, other);
+    auto match = lookup(subtree, shift, leaf.hash, leafKey);
+    if (match && isOld) {
+      onBoth(leaf.value, match->value);
+    } else if (match) {
+      onBoth(match->value, leaf.value);
+    } else if (isOld) {
+      onRemoved(leaf.value);
+    } else {
+      onAdded(leaf.value);
+    }
+  }
+
+  template <typename OnRemoved, typename OnAdded, typename OnBoth>
+  static void diffNodes(
+      const Node* oldNode,
+      const Node* newNode,
+      uint32_t shift,
+      OnRemoved& onRemoved,
+      OnAdded& onAdded,
+      OnBoth& onBoth) {
+    if (oldNode == newNode) {
+      return;
+    }
+    if (!newNode) {
+      forEach(*oldNode, onRemoved);
+      return;
+    }
+    if (!oldNode) {
+      forEach(*newNode, onAdded);
+      return;
+    }
+
+    if (shift >= kCollisionShift) {
+      for (const auto& leaf : oldNode->entries) {
+        const auto& key = Policy::key(leaf.value);
+        if (auto match = lookup(*newNode, shift, leaf.hash, key)) {
+          onBoth(leaf.value, match->value);
+        } else {
+          onRemoved(leaf.value);
+        }
+      }
+      for (const auto& leaf : newNode->entries) {
+        if (!lookup(*oldNode, shift, leaf.hash, Policy::key(leaf.value))) {
+          onAdded(leaf.value);
+        }
+      }
+      return;
+    }
+
+    auto slots = oldNode->entryMap | oldNode->childMap | newNode->entryMap |
+        newNode->childMap;
+    for (; slots; slots &= slots - 1) {
+      uint32_t bit = slots & -slots;
+      const Leaf* oldLeaf = (oldNode->entryMap & bit)
+          ? &oldNode->entries[indexOf(oldNode->entryMap, bit)]
+          : nullptr;
+      const Leaf* newLeaf = (newNode->entryMap & bit)
+          ? &newNode->entries[indexOf(newNode->entryMap, bit)]
+          : nullptr;
+      const Node* oldChild = (oldNode->childMap & bit)
+          ? oldNode->children[indexOf(oldNode->childMap, bit)].get()
+          : nullptr;
+      const Node* newChild = (newNode->childMap & bit)
+          ? newNode->children[indexOf(newNode->childMap, bit)].get()
+          : nullptr;
+      auto childShift = shift + kBitsPerLevel;
+
+      if (oldLeaf && newLeaf) {
+        const auto& oldKey = Policy::key(oldLeaf->value);
+        if (matches(*newLeaf, oldLeaf->hash, oldKey)) {
+          onBoth(oldLeaf->value, newLeaf->value);
+        } else {
+          onRemoved(oldLeaf->value);
+          onAdded(newLeaf->value);
+        }
+      } else if (oldLeaf && newChild) {
+        diffLeaf(
+            *oldLeaf, true, *newChild, childShift, onRemoved, onAdded, onBoth);
+      } else if (oldChild && newLeaf) {
+        diffLeaf(
+            *newLeaf, false, *oldChild, childShift, onRemoved, onAdded, onBoth);
+      } else if (oldLeaf) {
+        onRemoved(oldLeaf->value);
+      } else if (newLeaf) {
+        onAdded(newLeaf->value);
+      } else {
+        diffNodes(oldChild, newChild, childShift, onRemoved, onAdded, onBoth);
+      }
+    }
+  }
+
+  std::shared_ptr<Node> root_;
+  size_type size_{0};
+};
+
+} // namespace hamt_detail
+
+template <
+    typename K,
+    typename V,
+    typename Hash = std::hash<K>,
+    typename KeyEqual = std::equal_to<K>>
+class HamtMap : public hamt_detail::HamtBase<
+                    hamt_detail::MapPolicy<K, V, Hash, KeyEqual>> {
+  using Base =
+      hamt_detail::HamtBase<hamt_detail::MapPolicy<K, V, Hash, KeyEqual>>;
+
+ public:
+  using mapped_type = V;
+  using typename Base::iterator;
+  using typename Base::key_type;
+  using typename Base::value_type;
+
+  V& at(const K& key) {
+    auto it = this->find(key);
+    if (it == this->end()) {
+      throw std::out_of_range("HamtMap::at: key not found");
+    }
+    return it->second;
+  }
+
+  const V& at(const K& key) const {
+    auto it = this->find(key);
+    if (it == this->end()) {
+      throw std::out_of_range("HamtMap::at: key not found");
+    }
+    return it->second;
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const K& key, Args&&... args) {
+    auto makeValue = [&]() {
+      return value_type(
+          std::piecewise_construct,
+          std::forward_as_tuple(key),
+          std::forward_as_tuple(std::forward<Args>(args)...));
+    };
+    return this->findOrInsert(key, Base::hashOf(key), &makeValue);
+  }
+
+  template <typename M>
+  std::pair<iterator, bool> emplace(const K& key, M&& mapped) {
+    return try_emplace(key, std::forward<M>(mapped));
+  }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return try_emplace(value.first, value.second);
+  }
+
+  std::pair<iterator, bool> insert(std::pair<K, V>&& value) {
+    return try_emplace(value.first, std::move(value.second));
+  }
+};
+
+template <
+    typename V,
+    typename Hash = std::hash<V>,
+    typename KeyEqual = std::equal_to<V>>
+class HamtSet
+    : public hamt_detail::HamtBase<hamt_detail::SetPolicy<V, Hash, KeyEqual>> {
+  using Base = hamt_detail::HamtBase<hamt_detail::SetPolicy<V, Hash, KeyEqual>>;
+
+ public:
+  using typename Base::iterator;
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return insert(V(std::forward<Args>(args)...));
+  }
+
+  std::pair<iterator, bool> insert(V value) {
+    auto makeValue = [&]() { return std::move(value); };
+    return this->findOrInsert(value, Base::hashOf(value), &makeValue);
+  }
+};
+
+} // namespace facebook::fboss::thrift_cow
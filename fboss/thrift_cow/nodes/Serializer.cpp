@@ -0,0 +1,17 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/thrift_cow/nodes/Serializer.h"
+
+DEFINE_bool(
+    thrift_cow_cache_encodings,
+    false,
+    "Cache binary and compact encodings of published thrift_cow nodes, "
+    "reusing those of unchanged children when encoding their parents");
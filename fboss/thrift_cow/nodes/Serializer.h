@@ -11,10 +11,15 @@
 #pragma once
 
 #include <folly/io/IOBufQueue.h>
+#include <gflags/gflags.h>
 #include <thrift/lib/cpp2/protocol/Serializer.h>
 #include <thrift/lib/cpp2/protocol/detail/protocol_methods.h>
 #include "fboss/fsdb/if/gen-cpp2/fsdb_oper_types.h"
 
+#include <atomic>
+
+DECLARE_bool(thrift_cow_cache_encodings);
+
 namespace facebook::fboss::thrift_cow {
 
 namespace detail {
@@ -79,6 +84,16 @@ struct Serializer {
     return queue.move()->moveToFbString();
   }
 
+  // Serialize whatever fn writes through the writer and queue it is given
+  template <typename Fn>
+  static folly::fbstring write(Fn&& fn) {
+    folly::IOBufQueue queue;
+    Writer writer;
+    writer.setOutput(&queue);
+    fn(writer, queue);
+    return queue.move()->moveToFbString();
+  }
+
   template <
       typename TC,
       typename TType,
@@ -136,4 +151,119 @@ TType deserialize(fsdb::OperProtocol proto, const folly::fbstring& encoded) {
   }
 }
 
+/*
+ * Binary and compact encodings of a value are the same whether standalone
+ * or nested in a parent, so the encoding of a child node can be spliced
+ * as is into the encoding of its parent. Only done with
+ * --thrift_cow_cache_encodings, otherwise nodes encode from toThrift() and
+ * their encodings stay byte for byte the same as before.
+ */
+inline bool canSpliceEncodings(fsdb::OperProtocol proto) {
+  return FLAGS_thrift_cow_cache_encodings &&
+      (proto == fsdb::OperProtocol::BINARY ||
+       proto == fsdb::OperProtocol::COMPACT);
+}
+
+/*
+ * Encode through fn, which gets called with the protocol writer and the
+ * queue it writes to. Only binary and compact protocols are supported.
+ */
+template <typename Fn>
+folly::fbstring spliceEncode(fsdb::OperProtocol proto, Fn&& fn) {
+  switch (proto) {
+    case fsdb::OperProtocol::BINARY:
+      return Serializer<fsdb::OperProtocol::BINARY>::write(
+          std::forward<Fn>(fn));
+    case fsdb::OperProtocol::COMPACT:
+      return Serializer<fsdb::OperProtocol::COMPACT>::write(
+          std::forward<Fn>(fn));
+    default:
+      throw std::logic_error("Unexpected protocol");
+  }
+}
+
+/*
+ * Encodings of a node, cached per protocol with
+ * --thrift_cow_cache_encodings.
+ *
+ * Only published nodes cache their encodings. Those can't change anymore,
+ * and modifying a published node clones it along with every node on its
+ * path to the root, so the clones simply start out without any cached
+ * encodings. Nodes that did not change keep theirs, and get spliced as is
+ * into the encodings of their new parents.
+ *
+ * Published nodes are read from many threads, so encodings get added to a
+ * lock free list and never removed.
+ */
+class EncodingCache {
+ public:
+  EncodingCache() = default;
+  EncodingCache(const EncodingCache&) = delete;
+  EncodingCache& operator=(const EncodingCache&) = delete;
+
+  ~EncodingCache() {
+    auto entry = head_.load(std::memory_order_acquire);
+    while (entry) {
+      auto next = entry->next;
+      delete entry;
+      entry = next;
+    }
+  }
+
+  template <typename Node>
+  folly::fbstring encode(const Node& node, fsdb::OperProtocol proto) const {
+    if (auto cached = getOrEncode(node, proto)) {
+      return *cached;
+    }
+    return node.getFields()->encode(proto);
+  }
+
+  // Write node, which must support splicing, through writer
+  template <typename Node, typename Writer>
+  void write(
+      const Node& node,
+      Writer& writer,
+      folly::IOBufQueue& queue,
+      fsdb::OperProtocol proto) const {
+    if (auto cached = getOrEncode(node, proto)) {
+      queue.append(cached->data(), cached->size());
+    } else {
+      node.getFields()->writeTo(writer, queue, proto);
+    }
+  }
+
+ private:
+  struct Entry {
+    fsdb::OperProtocol proto;
+    folly::fbstring encoded;
+    Entry* next;
+  };
+
+  // Cached encoding of node, encoding it first if missing. Null if node
+  // should not be cached.
+  template <typename Node>
+  const folly::fbstring* getOrEncode(
+      const Node& node,
+      fsdb::OperProtocol proto) const {
+    if (!FLAGS_thrift_cow_cache_encodings || !node.isPublished()) {
+      return nullptr;
+    }
+    auto head = head_.load(std::memory_order_acquire);
+    for (auto entry = head; entry; entry = entry->next) {
+      if (entry->proto == proto) {
+        return &entry->encoded;
+      }
+    }
+    // Threads racing to encode the same node may each add an entry, which
+    // is harmless as they are all the same
+    auto entry = new Entry{proto, node.getFields()->encode(proto), head};
+    while (!head_.compare_exchange_weak(
+        entry->next, entry, std::memory_order_acq_rel)) {
+    }
+    return &entry->encoded;
+  }
+
+  mutable std::atomic<Entry*> head_{nullptr};
+};
+
 } // namespace facebook::fboss::thrift_cow
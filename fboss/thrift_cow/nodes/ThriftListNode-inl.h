@@ -100,7 +100,33 @@ struct ThriftListFields {
 #endif
 
   folly::fbstring encode(fsdb::OperProtocol proto) const {
-    return serialize<TypeClass>(proto, toThrift());
+    if (!canSpliceEncodings(proto)) {
+      return serialize<TypeClass>(proto, toThrift());
+    }
+    return spliceEncode(proto, [&](auto& writer, auto& queue) {
+      writeTo(writer, queue, proto);
+    });
+  }
+
+  // Write through a binary or compact protocol writer, without going
+  // through toThrift(), so that children can splice in their encodings
+  template <typename Writer>
+  void writeTo(
+      Writer& writer,
+      folly::IOBufQueue& queue,
+      fsdb::OperProtocol proto) const {
+    using ChildMethods = apache::thrift::detail::pm::
+        protocol_methods<ChildTypeClass, ChildTType>;
+
+    writer.writeListBegin(ChildMethods::ttype_value, storage_.size());
+    for (const auto& child : storage_) {
+      if constexpr (ChildTraits::isChild::value) {
+        child->writeTo(writer, queue, proto);
+      } else {
+        ChildMethods::write(writer, child->cref());
+      }
+    }
+    writer.writeListEnd();
   }
 
   void fromEncoded(fsdb::OperProtocol proto, const folly::fbstring& encoded) {
@@ -239,7 +265,15 @@ class ThriftListNode : public NodeBaseT<
 #endif
 
   folly::fbstring encode(fsdb::OperProtocol proto) const {
-    return this->getFields()->encode(proto);
+    return encodingCache_.encode(*this, proto);
+  }
+
+  template <typename Writer>
+  void writeTo(
+      Writer& writer,
+      folly::IOBufQueue& queue,
+      fsdb::OperProtocol proto) const {
+    encodingCache_.write(*this, writer, queue, proto);
   }
 
   void fromEncoded(fsdb::OperProtocol proto, const folly::fbstring& encoded) {
@@ -364,6 +398,8 @@ class ThriftListNode : public NodeBaseT<
 
  private:
   friend class CloneAllocator;
+
+  EncodingCache encodingCache_;
 };
 
 } // namespace facebook::fboss::thrift_cow
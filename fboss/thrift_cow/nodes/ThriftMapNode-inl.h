@@ -16,6 +16,7 @@
 #include <thrift/lib/cpp2/reflection/folly_dynamic.h>
 #include <thrift/lib/cpp2/reflection/reflection.h>
 #include "fboss/agent/state/NodeBase-defs.h"
+#include "fboss/thrift_cow/nodes/Hamt.h"
 #include "fboss/thrift_cow/nodes/Serializer.h"
 #include "fboss/thrift_cow/nodes/Types.h"
 
@@ -50,7 +51,8 @@ struct ThriftMapFields {
   using ValueTraits = ConvertToNodeTraits<ValueTypeClass, ValueTType>;
   using key_type = typename TType::key_type;
   using value_type = typename ValueTraits::type;
-  using StorageType = std::unordered_map<key_type, value_type>;
+  // Persistent, so that cloning a node shares its children's storage
+  using StorageType = HamtMap<key_type, value_type>;
   using iterator = typename StorageType::iterator;
   using const_iterator = typename StorageType::const_iterator;
 
@@ -106,7 +108,37 @@ struct ThriftMapFields {
 #endif
 
   folly::fbstring encode(fsdb::OperProtocol proto) const {
-    return serialize<TypeClass>(proto, toThrift());
+    if (!canSpliceEncodings(proto)) {
+      return serialize<TypeClass>(proto, toThrift());
+    }
+    return spliceEncode(proto, [&](auto& writer, auto& queue) {
+      writeTo(writer, queue, proto);
+    });
+  }
+
+  // Write through a binary or compact protocol writer, without going
+  // through toThrift(), so that children can splice in their encodings
+  template <typename Writer>
+  void writeTo(
+      Writer& writer,
+      folly::IOBufQueue& queue,
+      fsdb::OperProtocol proto) const {
+    using KeyMethods = apache::thrift::detail::pm::
+        protocol_methods<KeyTypeClass, key_type>;
+    using ValueMethods = apache::thrift::detail::pm::
+        protocol_methods<ValueTypeClass, ValueTType>;
+
+    writer.writeMapBegin(
+        KeyMethods::ttype_value, ValueMethods::ttype_value, storage_.size());
+    for (const auto& [key, val] : storage_) {
+      KeyMethods::write(writer, key);
+      if constexpr (HasChildNodes) {
+        val->writeTo(writer, queue, proto);
+      } else {
+        ValueMethods::write(writer, val->cref());
+      }
+    }
+    writer.writeMapEnd();
   }
 
   void fromEncoded(fsdb::OperProtocol proto, const folly::fbstring& encoded) {
@@ -130,7 +162,7 @@ struct ThriftMapFields {
   }
 
   std::pair<iterator, bool> insert(key_type key, value_type&& val) {
-    return storage_.insert({key, val});
+    return storage_.try_emplace(key, std::move(val));
   }
 
   template <typename... Args>
@@ -216,10 +248,32 @@ struct ThriftMapFields {
     return storage_.size();
   }
 
+  /*
+   * Visit the keys removed, added and present in both of oldFields and
+   * newFields, skipping over any storage the two share, as is the case
+   * when one was cloned from the other.
+   */
+  template <typename OnRemoved, typename OnAdded, typename OnBoth>
+  static void diff(
+      const Self& oldFields,
+      const Self& newFields,
+      OnRemoved&& onRemoved,
+      OnAdded&& onAdded,
+      OnBoth&& onBoth) {
+    StorageType::diff(
+        oldFields.storage_,
+        newFields.storage_,
+        std::forward<OnRemoved>(onRemoved),
+        std::forward<OnAdded>(onAdded),
+        std::forward<OnBoth>(onBoth));
+  }
+
   template <typename Fn>
   void forEachChild(Fn fn) {
     if constexpr (HasChildNodes) {
-      for (auto&& [key, value] : storage_) {
+      // Children are only modified through their pointer, no need to
+      // unshare the storage
+      for (auto&& [key, value] : std::as_const(storage_)) {
         fn(value.get());
       }
     }
@@ -279,7 +333,15 @@ class ThriftMapNode : public NodeBaseT<
 #endif
 
   folly::fbstring encode(fsdb::OperProtocol proto) const {
-    return this->getFields()->encode(proto);
+    return encodingCache_.encode(*this, proto);
+  }
+
+  template <typename Writer>
+  void writeTo(
+      Writer& writer,
+      folly::IOBufQueue& queue,
+      fsdb::OperProtocol proto) const {
+    encodingCache_.write(*this, writer, queue, proto);
   }
 
   void fromEncoded(fsdb::OperProtocol proto, const folly::fbstring& encoded) {
@@ -449,6 +511,8 @@ class ThriftMapNode : public NodeBaseT<
 
  private:
   friend class CloneAllocator;
+
+  EncodingCache encodingCache_;
 };
 
 } // namespace facebook::fboss::thrift_cow
@@ -17,6 +17,7 @@
 #include <thrift/lib/cpp2/reflection/folly_dynamic.h>
 #include <thrift/lib/cpp2/reflection/reflection.h>
 #include "fboss/agent/state/NodeBase-defs.h"
+#include "fboss/thrift_cow/nodes/Hamt.h"
 #include "fboss/thrift_cow/nodes/Serializer.h"
 #include "fboss/thrift_cow/nodes/Types.h"
 
@@ -47,7 +48,8 @@ struct ThriftSetFields {
 
   using ValueTraits = ConvertToImmutableNodeTraits<ValueTypeClass, ValueTType>;
   using value_type = typename ValueTraits::type;
-  using StorageType = std::unordered_set<value_type>;
+  // Persistent, so that cloning a node shares its storage
+  using StorageType = HamtSet<value_type>;
   using iterator = typename StorageType::iterator;
   using const_iterator = typename StorageType::const_iterator;
 
@@ -108,6 +110,16 @@ struct ThriftSetFields {
     fromThrift(deserialize<TypeClass, TType>(proto, encoded));
   }
 
+  // Write through a protocol writer as part of the encoding of a parent
+  template <typename Writer>
+  void writeTo(
+      Writer& writer,
+      folly::IOBufQueue& /*queue*/,
+      fsdb::OperProtocol /*proto*/) const {
+    apache::thrift::detail::pm::protocol_methods<TypeClass, TType>::write(
+        writer, toThrift());
+  }
+
   template <typename... Args>
   std::pair<iterator, bool> emplace(Args&&... args) {
     return storage_.emplace(childFactory(std::forward<Args>(args)...));
@@ -207,6 +219,25 @@ struct ThriftSetFields {
     return storage_.size();
   }
 
+  /*
+   * Visit the values removed from and added to oldFields in newFields,
+   * skipping over any storage the two share, as is the case when one was
+   * cloned from the other.
+   */
+  template <typename OnRemoved, typename OnAdded>
+  static void diff(
+      const Self& oldFields,
+      const Self& newFields,
+      OnRemoved&& onRemoved,
+      OnAdded&& onAdded) {
+    StorageType::diff(
+        oldFields.storage_,
+        newFields.storage_,
+        std::forward<OnRemoved>(onRemoved),
+        std::forward<OnAdded>(onAdded),
+        [](const auto& /*oldVal*/, const auto& /*newVal*/) {});
+  }
+
   template <typename Fn>
   void forEachChild(Fn /*fn*/) {
     // sets can't have complex children types
@@ -261,7 +292,15 @@ class ThriftSetNode : public NodeBaseT<
 #endif
 
   folly::fbstring encode(fsdb::OperProtocol proto) const {
-    return this->getFields()->encode(proto);
+    return encodingCache_.encode(*this, proto);
+  }
+
+  template <typename Writer>
+  void writeTo(
+      Writer& writer,
+      folly::IOBufQueue& queue,
+      fsdb::OperProtocol proto) const {
+    encodingCache_.write(*this, writer, queue, proto);
   }
 
   void fromEncoded(fsdb::OperProtocol proto, const folly::fbstring& encoded) {
@@ -407,6 +446,8 @@ class ThriftSetNode : public NodeBaseT<
 
  private:
   friend class CloneAllocator;
+
+  EncodingCache encodingCache_;
 };
 
 } // namespace facebook::fboss::thrift_cow
@@ -131,6 +131,38 @@ struct ChildInvoke {
   }
 };
 
+// Write a member that is set through a protocol writer, splicing in the
+// encoding of child nodes
+template <typename FieldsT>
+struct WriteMember {
+  using NamedMemberTypes = typename FieldsT::NamedMemberTypes;
+
+  template <typename T, typename Writer>
+  void operator()(
+      fatal::tag<T>,
+      const NamedMemberTypes& storage,
+      Writer& writer,
+      folly::IOBufQueue& queue,
+      fsdb::OperProtocol proto) {
+    using name = typename T::name;
+    using member = typename T::member;
+    using Methods = apache::thrift::detail::pm::
+        protocol_methods<typename T::tc, typename T::ttype>;
+
+    const auto& stored = storage.template get<name>();
+    if (!stored) {
+      return;
+    }
+    writer.writeFieldBegin("", Methods::ttype_value, member::id::value);
+    if constexpr (FieldsT::template IsChildNode<name>::value) {
+      stored->writeTo(writer, queue, proto);
+    } else {
+      Methods::write(writer, stored->cref());
+    }
+    writer.writeFieldEnd();
+  }
+};
+
 } // namespace struct_helpers
 
 template <typename TType>
@@ -343,7 +375,26 @@ struct ThriftStructFields {
   }
 
   folly::fbstring encode(fsdb::OperProtocol proto) const {
-    return serialize<TC>(proto, toThrift());
+    if (!canSpliceEncodings(proto)) {
+      return serialize<TC>(proto, toThrift());
+    }
+    return spliceEncode(proto, [&](auto& writer, auto& queue) {
+      writeTo(writer, queue, proto);
+    });
+  }
+
+  // Write through a binary or compact protocol writer, without going
+  // through toThrift(), so that children can splice in their encodings
+  template <typename Writer>
+  void writeTo(
+      Writer& writer,
+      folly::IOBufQueue& queue,
+      fsdb::OperProtocol proto) const {
+    writer.writeStructBegin("");
+    fatal::foreach<MemberTypes>(
+        struct_helpers::WriteMember<Self>(), storage_, writer, queue, proto);
+    writer.writeFieldStop();
+    writer.writeStructEnd();
   }
 
   void fromEncoded(fsdb::OperProtocol proto, const folly::fbstring& encoded) {
@@ -406,7 +457,15 @@ class ThriftStructNode
 #endif
 
   folly::fbstring encode(fsdb::OperProtocol proto) const {
-    return this->getFields()->encode(proto);
+    return encodingCache_.encode(*this, proto);
+  }
+
+  template <typename Writer>
+  void writeTo(
+      Writer& writer,
+      folly::IOBufQueue& queue,
+      fsdb::OperProtocol proto) const {
+    encodingCache_.write(*this, writer, queue, proto);
   }
 
   void fromEncoded(fsdb::OperProtocol proto, const folly::fbstring& encoded) {
@@ -572,6 +631,8 @@ class ThriftStructNode
 
  private:
   friend class CloneAllocator;
+
+  EncodingCache encodingCache_;
 };
 
 } // namespace facebook::fboss::thrift_cow
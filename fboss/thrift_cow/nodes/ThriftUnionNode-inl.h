@@ -318,6 +318,16 @@ struct ThriftUnionFields {
     fromThrift(deserialize<TC, TType>(proto, encoded));
   }
 
+  // Write through a protocol writer as part of the encoding of a parent
+  template <typename Writer>
+  void writeTo(
+      Writer& writer,
+      folly::IOBufQueue& /*queue*/,
+      fsdb::OperProtocol /*proto*/) const {
+    apache::thrift::detail::pm::protocol_methods<TC, TType>::write(
+        writer, toThrift());
+  }
+
   template <typename Name>
   bool isSet() const {
     using Metadata = MetadataFor<Name>;
@@ -429,7 +439,15 @@ class ThriftUnionNode
 #endif
 
   folly::fbstring encode(fsdb::OperProtocol proto) const {
-    return this->getFields()->encode(proto);
+    return encodingCache_.encode(*this, proto);
+  }
+
+  template <typename Writer>
+  void writeTo(
+      Writer& writer,
+      folly::IOBufQueue& queue,
+      fsdb::OperProtocol proto) const {
+    encodingCache_.write(*this, writer, queue, proto);
   }
 
   void fromEncoded(fsdb::OperProtocol proto, const folly::fbstring& encoded) {
@@ -540,6 +558,8 @@ class ThriftUnionNode
 
  private:
   friend class CloneAllocator;
+
+  EncodingCache encodingCache_;
 };
 
 } // namespace facebook::fboss::thrift_cow
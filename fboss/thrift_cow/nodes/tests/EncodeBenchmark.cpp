@@ -0,0 +1,112 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/agent/gen-cpp2/switch_config_fatal_types.h"
+#include "fboss/fsdb/if/gen-cpp2/fsdb_oper_types.h"
+#include "fboss/thrift_cow/nodes/Serializer.h"
+#include "fboss/thrift_cow/nodes/Types.h"
+#include "fboss/thrift_cow/nodes/tests/gen-cpp2/test_fatal_types.h"
+
+#include <folly/Benchmark.h>
+#include <folly/Conv.h>
+#include <folly/init/Init.h>
+#include <gflags/gflags.h>
+
+/*
+ * Cost of encoding a large published tree after modifying a handful of its
+ * entries, as publishing every new state to fsdb subscribers does, with and
+ * without caching the encodings of unmodified nodes.
+ */
+
+using namespace facebook::fboss;
+using namespace facebook::fboss::thrift_cow;
+
+using k = test_tags::strings;
+using sk = cfg::switch_config_tags::strings;
+
+namespace {
+
+constexpr auto kModifiedEntries = 10;
+
+using TestStructNode = ThriftStructNode<TestStruct>;
+
+std::shared_ptr<TestStructNode> buildNode(int size) {
+  TestStruct data;
+  for (int i = 0; i < size; ++i) {
+    cfg::L4PortRange portRange;
+    portRange.min() = i;
+    portRange.max() = i + 100;
+    (*data.mapOfI32ToStruct())[i] = std::move(portRange);
+  }
+  auto node = std::make_shared<TestStructNode>(data);
+  node->publish();
+  return node;
+}
+
+void modifyEntries(std::shared_ptr<TestStructNode>* node, int size, int iter) {
+  TestStructNode::modify(node, "mapOfI32ToStruct");
+  auto& map = (*node)->template ref<k::mapOfI32ToStruct>();
+  for (int i = 0; i < kModifiedEntries; ++i) {
+    auto key = (iter * kModifiedEntries + i) % size;
+    map->modify(folly::to<std::string>(key));
+    map->ref(key)->template set<sk::max>(iter);
+  }
+  (*node)->publish();
+}
+
+void encode(unsigned iters, int size, bool cached, fsdb::OperProtocol proto) {
+  folly::BenchmarkSuspender suspender;
+  gflags::FlagSaver flagSaver;
+  FLAGS_thrift_cow_cache_encodings = cached;
+  auto node = buildNode(size);
+  // start out with every node cached, as after a previous publish
+  folly::doNotOptimizeAway(node->encode(proto));
+
+  for (unsigned i = 0; i < iters; ++i) {
+    modifyEntries(&node, size, i);
+    suspender.dismiss();
+    folly::doNotOptimizeAway(node->encode(proto));
+    suspender.rehire();
+  }
+}
+
+} // namespace
+
+void fullEncodeCompact(unsigned iters, int size) {
+  encode(iters, size, false, fsdb::OperProtocol::COMPACT);
+}
+
+void cachedEncodeCompact(unsigned iters, int size) {
+  encode(iters, size, true, fsdb::OperProtocol::COMPACT);
+}
+
+void fullEncodeBinary(unsigned iters, int size) {
+  encode(iters, size, false, fsdb::OperProtocol::BINARY);
+}
+
+void cachedEncodeBinary(unsigned iters, int size) {
+  encode(iters, size, true, fsdb::OperProtocol::BINARY);
+}
+
+BENCHMARK_PARAM(fullEncodeCompact, 10000);
+BENCHMARK_RELATIVE_PARAM(cachedEncodeCompact, 10000);
+BENCHMARK_PARAM(fullEncodeCompact, 100000);
+BENCHMARK_RELATIVE_PARAM(cachedEncodeCompact, 100000);
+BENCHMARK_DRAW_LINE();
+BENCHMARK_PARAM(fullEncodeBinary, 10000);
+BENCHMARK_RELATIVE_PARAM(cachedEncodeBinary, 10000);
+BENCHMARK_PARAM(fullEncodeBinary, 100000);
+BENCHMARK_RELATIVE_PARAM(cachedEncodeBinary, 100000);
+
+int main(int argc, char** argv) {
+  folly::init(&argc, &argv, true);
+  folly::runBenchmarks();
+  return 0;
+}
@@ -0,0 +1,159 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/thrift_cow/nodes/Hamt.h"
+
+#include <folly/Benchmark.h>
+#include <folly/init/Init.h>
+
+#include <memory>
+#include <unordered_map>
+
+/*
+ * Cost of copy on write operations on the storage of map nodes, comparing
+ * the persistent trie against the std::unordered_map it replaced:
+ *  - clone: copying the storage, as cloning a published node does
+ *  - modify: cloning, then replacing the child of one key
+ *  - delta: diffing a clone with one modified key against the original, as
+ *    DeltaVisitor does
+ */
+
+using namespace facebook::fboss::thrift_cow;
+
+namespace {
+
+using Child = std::shared_ptr<int>;
+using UnorderedMap = std::unordered_map<int, Child>;
+using Hamt = HamtMap<int, Child>;
+
+template <typename Map>
+Map buildMap(int size) {
+  Map map;
+  for (int i = 0; i < size; ++i) {
+    map.emplace(i, std::make_shared<int>(i));
+  }
+  return map;
+}
+
+template <typename Map>
+void clone(unsigned iters, int size) {
+  folly::BenchmarkSuspender suspender;
+  auto map = buildMap<Map>(size);
+  suspender.dismiss();
+  for (unsigned i = 0; i < iters; ++i) {
+    Map copy(map);
+    folly::doNotOptimizeAway(copy);
+  }
+}
+
+template <typename Map>
+void modify(unsigned iters, int size) {
+  folly::BenchmarkSuspender suspender;
+  auto map = buildMap<Map>(size);
+  auto child = std::make_shared<int>(0);
+  suspender.dismiss();
+  for (unsigned i = 0; i < iters; ++i) {
+    Map copy(map);
+    copy.find(i % size)->second = child;
+    folly::doNotOptimizeAway(copy);
+  }
+}
+
+size_t unorderedMapDelta(
+    const UnorderedMap& oldMap,
+    const UnorderedMap& newMap) {
+  size_t changes = 0;
+  for (const auto& [key, val] : oldMap) {
+    auto it = newMap.find(key);
+    changes += it == newMap.end() || it->second != val;
+  }
+  for (const auto& [key, val] : newMap) {
+    changes += oldMap.find(key) == oldMap.end();
+  }
+  return changes;
+}
+
+size_t hamtDelta(const Hamt& oldMap, const Hamt& newMap) {
+  size_t changes = 0;
+  Hamt::diff(
+      oldMap,
+      newMap,
+      [&](const auto&) { ++changes; },
+      [&](const auto&) { ++changes; },
+      [&](const auto& oldEntry, const auto& newEntry) {
+        changes += oldEntry.second != newEntry.second;
+      });
+  return changes;
+}
+
+template <typename Map, typename DeltaFn>
+void delta(unsigned iters, int size, DeltaFn deltaFn) {
+  folly::BenchmarkSuspender suspender;
+  auto map = buildMap<Map>(size);
+  auto copy = map;
+  copy.find(size / 2)->second = std::make_shared<int>(0);
+  suspender.dismiss();
+  for (unsigned i = 0; i < iters; ++i) {
+    folly::doNotOptimizeAway(deltaFn(map, copy));
+  }
+}
+
+} // namespace
+
+void cloneUnorderedMap(unsigned iters, int size) {
+  clone<UnorderedMap>(iters, size);
+}
+
+void cloneHamt(unsigned iters, int size) {
+  clone<Hamt>(iters, size);
+}
+
+void modifyUnorderedMap(unsigned iters, int size) {
+  modify<UnorderedMap>(iters, size);
+}
+
+void modifyHamt(unsigned iters, int size) {
+  modify<Hamt>(iters, size);
+}
+
+void deltaUnorderedMap(unsigned iters, int size) {
+  delta<UnorderedMap>(iters, size, unorderedMapDelta);
+}
+
+void deltaHamt(unsigned iters, int size) {
+  delta<Hamt>(iters, size, hamtDelta);
+}
+
+BENCHMARK_PARAM(cloneUnorderedMap, 10000);
+BENCHMARK_RELATIVE_PARAM(cloneHamt, 10000);
+BENCHMARK_PARAM(cloneUnorderedMap, 100000);
+BENCHMARK_RELATIVE_PARAM(cloneHamt, 100000);
+BENCHMARK_PARAM(cloneUnorderedMap, 1000000);
+BENCHMARK_RELATIVE_PARAM(cloneHamt, 1000000);
+BENCHMARK_DRAW_LINE();
+BENCHMARK_PARAM(modifyUnorderedMap, 10000);
+BENCHMARK_RELATIVE_PARAM(modifyHamt, 10000);
+BENCHMARK_PARAM(modifyUnorderedMap, 100000);
+BENCHMARK_RELATIVE_PARAM(modifyHamt, 100000);
+BENCHMARK_PARAM(modifyUnorderedMap, 1000000);
+BENCHMARK_RELATIVE_PARAM(modifyHamt, 1000000);
+BENCHMARK_DRAW_LINE();
+BENCHMARK_PARAM(deltaUnorderedMap, 10000);
+BENCHMARK_RELATIVE_PARAM(deltaHamt, 10000);
+BENCHMARK_PARAM(deltaUnorderedMap, 100000);
+BENCHMARK_RELATIVE_PARAM(deltaHamt, 100000);
+BENCHMARK_PARAM(deltaUnorderedMap, 1000000);
+BENCHMARK_RELATIVE_PARAM(deltaHamt, 1000000);
+
+int main(int argc, char** argv) {
+  folly::init(&argc, &argv, true);
+  folly::runBenchmarks();
+  return 0;
+}
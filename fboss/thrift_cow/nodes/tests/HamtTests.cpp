@@ -0,0 +1,257 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/thrift_cow/nodes/Hamt.h"
+
+#include <gtest/gtest.h>
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+
+using namespace facebook::fboss::thrift_cow;
+
+namespace {
+
+// Only a handful of distinct hashes, to exercise collision nodes
+struct CollidingHash {
+  std::size_t operator()(int key) const {
+    return key % 7;
+  }
+};
+
+using TestMap = HamtMap<int, std::shared_ptr<int>>;
+
+TestMap buildMap(int size) {
+  TestMap map;
+  for (int i = 0; i < size; ++i) {
+    map.try_emplace(i, std::make_shared<int>(i));
+  }
+  return map;
+}
+
+template <typename Map>
+std::map<int, int> toStdMap(const Map& map) {
+  std::map<int, int> result;
+  for (const auto& [key, val] : map) {
+    EXPECT_TRUE(result.emplace(key, *val).second);
+  }
+  return result;
+}
+
+struct Diff {
+  std::set<int> removed;
+  std::set<int> added;
+  std::set<int> changed;
+};
+
+template <typename Map>
+Diff diff(const Map& oldMap, const Map& newMap) {
+  Diff result;
+  Map::diff(
+      oldMap,
+      newMap,
+      [&](const auto& entry) { result.removed.insert(entry.first); },
+      [&](const auto& entry) { result.added.insert(entry.first); },
+      [&](const auto& oldEntry, const auto& newEntry) {
+        EXPECT_EQ(oldEntry.first, newEntry.first);
+        if (oldEntry.second != newEntry.second) {
+          result.changed.insert(oldEntry.first);
+        }
+      });
+  return result;
+}
+
+template <typename Hash>
+void randomOps(int keyRange) {
+  std::mt19937 rng(keyRange);
+  HamtMap<int, std::shared_ptr<int>, Hash> map;
+  std::map<int, int> expected;
+  std::vector<std::pair<decltype(map), std::map<int, int>>> snapshots;
+
+  for (int i = 0; i < 10000; ++i) {
+    int key = rng() % keyRange;
+    switch (rng() % 5) {
+      case 0:
+      case 1: {
+        auto [it, inserted] = map.try_emplace(key, std::make_shared<int>(i));
+        ASSERT_EQ(inserted, expected.emplace(key, i).second);
+        ASSERT_EQ(it->first, key);
+        break;
+      }
+      case 2:
+        ASSERT_EQ(map.erase(key), expected.erase(key));
+        break;
+      case 3:
+        if (auto it = map.find(key); it != map.end()) {
+          it->second = std::make_shared<int>(i);
+          expected[key] = i;
+        } else {
+          ASSERT_EQ(expected.count(key), 0);
+        }
+        break;
+      case 4:
+        if (snapshots.size() < 20) {
+          snapshots.emplace_back(map, expected);
+        }
+        break;
+    }
+    ASSERT_EQ(map.size(), expected.size());
+  }
+
+  ASSERT_EQ(toStdMap(map), expected);
+  for (const auto& [snapshot, snapshotExpected] : snapshots) {
+    // later modifications never leak into copies
+    ASSERT_EQ(toStdMap(snapshot), snapshotExpected);
+
+    auto result = diff(snapshot, map);
+    for (const auto& [key, val] : snapshotExpected) {
+      auto it = expected.find(key);
+      EXPECT_EQ(result.removed.count(key), it == expected.end());
+      if (it != expected.end() && it->second != val) {
+        EXPECT_EQ(result.changed.count(key), 1);
+      }
+    }
+    for (const auto& [key, val] : expected) {
+      EXPECT_EQ(result.added.count(key), snapshotExpected.count(key) == 0);
+    }
+  }
+}
+
+} // namespace
+
+TEST(HamtTests, MapGetSet) {
+  TestMap map;
+  ASSERT_TRUE(map.empty());
+  ASSERT_EQ(map.begin(), map.end());
+
+  ASSERT_TRUE(map.try_emplace(3, std::make_shared<int>(30)).second);
+  ASSERT_TRUE(map.emplace(7, std::make_shared<int>(70)).second);
+  ASSERT_FALSE(map.try_emplace(3, std::make_shared<int>(31)).second);
+  ASSERT_EQ(map.size(), 2);
+  ASSERT_EQ(*map.at(3), 30);
+  ASSERT_EQ(*map.find(7)->second, 70);
+  ASSERT_EQ(map.find(5), map.end());
+  ASSERT_THROW(map.at(5), std::out_of_range);
+
+  ASSERT_EQ(map.erase(3), 1);
+  ASSERT_EQ(map.erase(3), 0);
+  ASSERT_EQ(map.size(), 1);
+  ASSERT_EQ(map.find(3), map.end());
+
+  auto it = map.erase(map.find(7));
+  ASSERT_EQ(it, map.end());
+  ASSERT_TRUE(map.empty());
+}
+
+TEST(HamtTests, MapIterate) {
+  auto map = buildMap(10000);
+  auto expected = toStdMap(map);
+  ASSERT_EQ(expected.size(), 10000);
+  for (const auto& [key, val] : expected) {
+    ASSERT_EQ(key, val);
+  }
+
+  // erasing while iterating visits every entry once
+  int erased = 0;
+  for (auto it = map.begin(); it != map.end();) {
+    it = (it->first % 2) ? map.erase(it) : std::next(it);
+    ++erased;
+  }
+  ASSERT_EQ(erased, 10000);
+  ASSERT_EQ(map.size(), 5000);
+}
+
+TEST(HamtTests, CopyOnWrite) {
+  auto map = buildMap(10000);
+  auto copy = map;
+
+  *copy.at(5) = 0;
+  copy.at(6) = std::make_shared<int>(0);
+  copy.erase(7);
+  copy.try_emplace(10000, std::make_shared<int>(10000));
+  for (auto& [key, val] : copy) {
+    if (key == 8) {
+      val = nullptr;
+    }
+  }
+
+  // the shared child object itself was modified, not the entry
+  ASSERT_EQ(*map.at(5), 0);
+  ASSERT_EQ(*map.at(6), 6);
+  ASSERT_NE(map.find(7), map.end());
+  ASSERT_NE(map.at(8), nullptr);
+  ASSERT_EQ(map.find(10000), map.end());
+  ASSERT_EQ(map.size(), 10000);
+  ASSERT_EQ(copy.size(), 10000);
+}
+
+TEST(HamtTests, DiffSkipsSharedSubtrees) {
+  auto map = buildMap(100000);
+  auto copy = map;
+  copy.at(5) = std::make_shared<int>(5);
+  copy.erase(6);
+  copy.try_emplace(100000, std::make_shared<int>(100000));
+
+  int visited = 0;
+  TestMap::diff(
+      map,
+      copy,
+      [&](const auto&) { ++visited; },
+      [&](const auto&) { ++visited; },
+      [&](const auto&, const auto&) { ++visited; });
+  // only entries next to the modified ones get visited
+  ASSERT_LT(visited, 200);
+
+  auto result = diff(map, copy);
+  ASSERT_EQ(result.removed, std::set<int>{6});
+  ASSERT_EQ(result.added, std::set<int>{100000});
+  ASSERT_EQ(result.changed, std::set<int>{5});
+
+  // diffing unrelated maps still finds all differences
+  result = diff(buildMap(1000), buildMap(1500));
+  ASSERT_TRUE(result.removed.empty());
+  ASSERT_EQ(result.added.size(), 500);
+  ASSERT_EQ(result.changed.size(), 1000);
+}
+
+TEST(HamtTests, RandomOps) {
+  randomOps<std::hash<int>>(50);
+  randomOps<std::hash<int>>(5000);
+}
+
+TEST(HamtTests, RandomOpsWithCollisions) {
+  randomOps<CollidingHash>(300);
+}
+
+TEST(HamtTests, Set) {
+  HamtSet<std::string> set;
+  ASSERT_TRUE(set.emplace("a").second);
+  ASSERT_TRUE(set.insert("b").second);
+  ASSERT_FALSE(set.emplace("a").second);
+  ASSERT_EQ(set.size(), 2);
+  ASSERT_EQ(*set.find("b"), "b");
+
+  auto copy = set;
+  copy.erase("a");
+  copy.emplace("c");
+  ASSERT_EQ(set.count("a"), 1);
+  ASSERT_EQ(set.count("c"), 0);
+
+  std::set<std::string> removed, added;
+  HamtSet<std::string>::diff(
+      set,
+      copy,
+      [&](const auto& val) { removed.insert(val); },
+      [&](const auto& val) { added.insert(val); },
+      [](const auto&, const auto&) {});
+  ASSERT_EQ(removed, std::set<std::string>{"a"});
+  ASSERT_EQ(added, std::set<std::string>{"c"});
+}
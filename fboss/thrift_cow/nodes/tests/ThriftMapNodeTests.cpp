@@ -594,3 +594,43 @@ TEST(ThriftMapNodeTests, ThriftMapNodeStructsModify) {
   ASSERT_EQ(node->size(), 3);
   ASSERT_NE(node->find(TestEnum::THIRD), node->end());
 }
+
+TEST(ThriftMapNodeTests, ThriftMapNodeStructsCloneSharesChildren) {
+  using TestNodeType = ThriftMapNode<
+      apache::thrift::type_class::map<
+          apache::thrift::type_class::integral,
+          apache::thrift::type_class::structure>,
+      std::unordered_map<int, cfg::L4PortRange>>;
+
+  std::unordered_map<int, cfg::L4PortRange> data;
+  for (int i = 0; i < 1000; ++i) {
+    data.emplace(i, buildPortRange(i, i + 1));
+  }
+
+  auto node = std::make_shared<TestNodeType>(data);
+  node->publish();
+  auto oldNode = node;
+
+  TestNodeType::modify(&node, "7");
+  node->ref(7)->template set<sk::max>(42);
+  TestNodeType::modify(&node, "1000");
+  node->remove(3);
+
+  // the published node is left untouched
+  ASSERT_EQ(oldNode->size(), 1000);
+  ASSERT_EQ(oldNode->toThrift(), data);
+
+  ASSERT_EQ(node->size(), 1000);
+  for (int i = 0; i < 1000; ++i) {
+    if (i == 3) {
+      ASSERT_EQ(node->find(i), node->end());
+    } else if (i == 7) {
+      ASSERT_NE(node->cref(i), oldNode->cref(i));
+      ASSERT_EQ(node->cref(i)->template cref<sk::max>()->cref(), 42);
+    } else {
+      // unmodified children are shared with the published node
+      ASSERT_EQ(node->cref(i), oldNode->cref(i));
+    }
+  }
+  ASSERT_NE(node->find(1000), node->end());
+}
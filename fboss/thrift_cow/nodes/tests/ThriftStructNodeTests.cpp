@@ -18,9 +18,12 @@
 #include "fboss/thrift_cow/nodes/Types.h"
 #include "fboss/thrift_cow/nodes/tests/gen-cpp2/test_fatal_types.h"
 
+#include <gflags/gflags.h>
 #include <gtest/gtest.h>
 #include <type_traits>
 
+DECLARE_bool(thrift_cow_cache_encodings);
+
 using namespace facebook::fboss;
 using namespace facebook::fboss::thrift_cow;
 
@@ -480,6 +483,60 @@ TEST(ThriftStructNodeTests, ThriftStructNodeEncode) {
   ASSERT_EQ(decoded, data);
 }
 
+TEST(ThriftStructNodeTests, ThriftStructNodeCachedEncode) {
+  gflags::FlagSaver flagSaver;
+  FLAGS_thrift_cow_cache_encodings = true;
+
+  TestStruct data;
+  data.inlineInt() = 123;
+  data.inlineStruct() = buildPortRange(100, 999);
+  for (int i = 0; i < 10; ++i) {
+    (*data.mapOfI32ToStruct())[i] = buildPortRange(i, i * 10);
+  }
+
+  auto node = std::make_shared<ThriftStructNode<TestStruct>>(data);
+  node->publish();
+
+  using TC = apache::thrift::type_class::structure;
+  auto checkEncodings = [&](const auto& node, const TestStruct& expected) {
+    for (auto proto :
+         {fsdb::OperProtocol::BINARY,
+          fsdb::OperProtocol::COMPACT,
+          fsdb::OperProtocol::SIMPLE_JSON}) {
+      auto reference = serialize<TC>(proto, node->toThrift());
+      // first encode populates the cache, second one reads it
+      for (int i = 0; i < 2; ++i) {
+        auto encoded = node->encode(proto);
+        ASSERT_EQ(
+            (deserialize<TC, TestStruct>(proto, encoded)),
+            (deserialize<TC, TestStruct>(proto, reference)));
+        ASSERT_EQ((deserialize<TC, TestStruct>(proto, encoded)), expected);
+      }
+
+      // without caching, encodings are those of toThrift(), byte for byte
+      FLAGS_thrift_cow_cache_encodings = false;
+      ASSERT_EQ(node->encode(proto), reference);
+      FLAGS_thrift_cow_cache_encodings = true;
+    }
+  };
+  checkEncodings(node, data);
+
+  // modified nodes on the path to the root get encoded again, their
+  // unmodified siblings get spliced in from the cache
+  ThriftStructNode<TestStruct>::modify(&node, "mapOfI32ToStruct");
+  auto& map = node->template ref<k::mapOfI32ToStruct>();
+  map->modify("5");
+  map->ref(5)->template set<sk::min>(55);
+  node->template set<k::inlineInt>(321);
+  (*data.mapOfI32ToStruct())[5].min() = 55;
+  data.inlineInt() = 321;
+
+  // unpublished nodes never cache
+  checkEncodings(node, data);
+  node->publish();
+  checkEncodings(node, data);
+}
+
 TEST(ThriftStructNodeTests, UnsignedInteger) {
   ThriftStructFields<TestStruct> fields;
   using UnderlyingType = folly::remove_cvref_t<
@@ -5,8 +5,6 @@
 #include <type_traits>
 #include "folly/ScopeGuard.h"
 
-#include <boost/function_output_iterator.hpp>
-
 #include <thrift/lib/cpp2/Thrift.h>
 #include <thrift/lib/cpp2/TypeClass.h>
 #include <thrift/lib/cpp2/reflection/reflection.h>
@@ -25,7 +23,9 @@ namespace facebook::fboss::thrift_cow {
  *
  * NOTE: this is not super efficient right now. In particular, we use
  * operator== to recursively compare the objects, which can be
- * nontrivially expensive.
+ * nontrivially expensive. Maps and sets at least skip over the storage
+ * the two versions share, so a clone with a single modified key only
+ * visits the path to that key.
  */
 
 template <typename TC>
@@ -192,35 +192,23 @@ struct DeltaVisitor<apache::thrift::type_class::set<ValueTypeClass>> {
     // assuming that sets cannot contain any complex types, so just
     // calculating difference.
     bool hasDifferences{false};
-    std::set_symmetric_difference(
-        oldFields.begin(),
-        oldFields.end(),
-        newFields.begin(),
-        newFields.end(),
-        boost::make_function_output_iterator([&](const auto& val) {
-          if (!val) {
-            // shouldn't happen...
-            return;
-          }
-          hasDifferences = true;
-          path.push_back(folly::to<std::string>(val->cref()));
-          if (auto it = oldFields.find(val); it != oldFields.end()) {
-            dv_detail::visitAddedOrRemovedNode<ValueTypeClass>(
-                path,
-                typename Fields::value_type{val},
-                typename Fields::value_type{},
-                mode,
-                std::forward<Func>(f));
-          } else {
-            dv_detail::visitAddedOrRemovedNode<ValueTypeClass>(
-                path,
-                typename Fields::value_type{},
-                typename Fields::value_type{val},
-                mode,
-                std::forward<Func>(f));
-          }
-          path.pop_back();
-        }));
+    auto visitChange = [&](const auto& oldVal, const auto& newVal) {
+      hasDifferences = true;
+      const auto& val = oldVal ? oldVal : newVal;
+      path.push_back(folly::to<std::string>(val->cref()));
+      dv_detail::visitAddedOrRemovedNode<ValueTypeClass>(
+          path, oldVal, newVal, mode, std::forward<Func>(f));
+      path.pop_back();
+    };
+    Fields::diff(
+        oldFields,
+        newFields,
+        [&](const auto& val) {
+          visitChange(val, typename Fields::value_type{});
+        },
+        [&](const auto& val) {
+          visitChange(typename Fields::value_type{}, val);
+        });
 
     return hasDifferences;
   }
@@ -346,38 +334,42 @@ struct DeltaVisitor<
       Func&& f) {
     bool hasDifferences{false};
 
-    // changed fields
-    for (const auto& [key, val] : oldFields) {
-      path.push_back(folly::to<std::string>(key));
-      if (auto it = newFields.find(key); it != newFields.end()) {
-        // only recurse further if pointers aren't equal
-        if (val != it->second) {
+    // Only keys in storage not shared by the two fields get visited
+    Fields::diff(
+        oldFields,
+        newFields,
+        [&](const auto& removed) {
+          hasDifferences = true;
+          const auto& [key, val] = removed;
+          path.push_back(folly::to<std::string>(key));
+          dv_detail::visitAddedOrRemovedNode<MappedTypeClass>(
+              path, val, decltype(val){}, mode, std::forward<Func>(f));
+          path.pop_back();
+        },
+        [&](const auto& added) {
+          hasDifferences = true;
+          const auto& [key, val] = added;
+          path.push_back(folly::to<std::string>(key));
+          dv_detail::visitAddedOrRemovedNode<MappedTypeClass>(
+              path, decltype(val){}, val, mode, std::forward<Func>(f));
+          path.pop_back();
+        },
+        [&](const auto& oldEntry, const auto& newEntry) {
+          // only recurse further if pointers aren't equal
+          if (oldEntry.second == newEntry.second) {
+            return;
+          }
+          path.push_back(folly::to<std::string>(oldEntry.first));
           if (DeltaVisitor<MappedTypeClass>::visit(
-                  path, val, it->second, mode, std::forward<Func>(f))) {
+                  path,
+                  oldEntry.second,
+                  newEntry.second,
+                  mode,
+                  std::forward<Func>(f))) {
             hasDifferences = true;
           }
-        }
-      } else {
-        hasDifferences = true;
-        dv_detail::visitAddedOrRemovedNode<MappedTypeClass>(
-            path, val, decltype(val){}, mode, std::forward<Func>(f));
-      }
-      path.pop_back();
-    }
-
-    for (const auto& [key, val] : newFields) {
-      if (oldFields.find(key) == oldFields.end()) {
-        // only look at keys that didn't exist. First loop should handle all
-        // replacement deltas
-        hasDifferences = true;
-        path.push_back(folly::to<std::string>(key));
-
-        dv_detail::visitAddedOrRemovedNode<MappedTypeClass>(
-            path, decltype(val){}, val, mode, std::forward<Func>(f));
-
-        path.pop_back();
-      }
-    }
+          path.pop_back();
+        });
 
     return hasDifferences;
   }
@@ -0,0 +1,346 @@
+// (c) Facebook, Inc. and its affiliates. Confidential and proprietary.
+
+#pragma once
+
+#include <folly/Executor.h>
+#include <folly/Function.h>
+#include <folly/futures/Future.h>
+
+#include <fboss/thrift_cow/visitors/DeltaVisitor.h>
+
+#include <memory>
+#include <vector>
+
+namespace facebook::fboss::thrift_cow {
+
+struct ParallelDeltaVisitOptions {
+  // Executor the differing subtrees get visited on. Visits happen on the
+  // calling thread if null. The calling thread blocks until all visits
+  // are done, so it must not be one of the executor's own threads.
+  folly::Executor* executor{nullptr};
+
+  // Maps with fewer entries than this get visited as a whole by a single
+  // task, rather than splitting their differing entries across tasks
+  std::size_t minParallelMapSize{1024};
+
+  // Number of tasks the differing subtrees get split into
+  std::size_t numTasks{8};
+};
+
+namespace pdv_detail {
+
+template <typename TC>
+struct IsMapTypeClass : std::false_type {};
+
+template <typename KeyTypeClass, typename MappedTypeClass>
+struct IsMapTypeClass<
+    apache::thrift::type_class::map<KeyTypeClass, MappedTypeClass>>
+    : std::true_type {
+  using mapped_type_class = MappedTypeClass;
+};
+
+/*
+ * A parallel delta visit happens in three phases:
+ *  - plan: walk down structs, and maps with at least minParallelMapSize
+ *    entries, on the calling thread, adding a leaf for every differing
+ *    member or entry below them. This only touches the storage the two
+ *    trees do not share, so it is cheap.
+ *  - execute: visit the subtrees of the leaves with the sequential
+ *    DeltaVisitor, on the executor, each leaf collecting what f returns
+ *    into its own results.
+ *  - merge: concatenate the results of the leaves in plan order, which is
+ *    the order the sequential DeltaVisitor visits them in, adding those
+ *    of the planned nodes themselves after their children.
+ */
+template <typename Result, typename Func>
+class ParallelDeltaVisit {
+ public:
+  ParallelDeltaVisit(
+      const DeltaVisitMode& mode,
+      const ParallelDeltaVisitOptions& options,
+      Func& f)
+      : mode_(mode), options_(options), f_(f) {}
+
+  template <typename TC, typename Node>
+  std::vector<Result> visit(
+      const std::shared_ptr<Node>& oldNode,
+      const std::shared_ptr<Node>& newNode) {
+    std::vector<std::string> path;
+    PlanNode root;
+    planChild<TC>(path, oldNode, newNode, root);
+    execute();
+
+    std::vector<Result> results;
+    merge(root, results);
+    return results;
+  }
+
+ private:
+  struct Leaf {
+    folly::Function<bool(std::vector<Result>&)> visit;
+    std::vector<Result> results;
+    bool hasDifferences{false};
+  };
+
+  struct PlanNode {
+    // either a planned node or the index of a leaf, in visit order
+    struct Child {
+      std::unique_ptr<PlanNode> node;
+      std::size_t leaf{0};
+    };
+    std::vector<Child> children;
+    // emits the node itself, in PARENTS and FULL modes
+    folly::Function<void(std::vector<Result>&)> emitSelf;
+  };
+
+  auto collector(std::vector<Result>& results) {
+    return [this, &results](
+               auto& path, auto&& oldNode, auto&& newNode, auto tag) {
+      results.push_back(f_(path, oldNode, newNode, tag));
+    };
+  }
+
+  void addLeaf(
+      PlanNode& parent,
+      folly::Function<bool(std::vector<Result>&)> visit) {
+    parent.children.push_back({nullptr, leaves_.size()});
+    leaves_.push_back({std::move(visit), {}, false});
+  }
+
+  template <typename TC, typename T>
+  void addVisitLeaf(
+      const std::vector<std::string>& path,
+      const T& oldRef,
+      const T& newRef,
+      PlanNode& parent) {
+    addLeaf(
+        parent,
+        [this, path, &oldRef, &newRef](
+            std::vector<Result>& results) mutable {
+          return DeltaVisitor<TC>::visit(
+              path, oldRef, newRef, mode_, collector(results));
+        });
+  }
+
+  template <typename TC, typename T>
+  void addAddedOrRemovedLeaf(
+      const std::vector<std::string>& path,
+      const T& oldRef,
+      const T& newRef,
+      PlanNode& parent) {
+    addLeaf(
+        parent,
+        [this, path, &oldRef, &newRef](
+            std::vector<Result>& results) mutable {
+          dv_detail::visitAddedOrRemovedNode<TC>(
+              path, oldRef, newRef, mode_, collector(results));
+          return true;
+        });
+  }
+
+  template <typename Node, typename PlanFields>
+  void planNode(
+      const std::vector<std::string>& path,
+      const std::shared_ptr<Node>& oldNode,
+      const std::shared_ptr<Node>& newNode,
+      PlanNode& parent,
+      PlanFields&& planFields) {
+    auto node = std::make_unique<PlanNode>();
+    planFields(*node);
+    if (mode_ != DeltaVisitMode::MINIMAL) {
+      node->emitSelf = [this, path, &oldNode, &newNode](
+                           std::vector<Result>& results) mutable {
+        results.push_back(
+            f_(path, oldNode, newNode, DeltaElemTag::NOT_MINIMAL));
+      };
+    }
+    parent.children.push_back({std::move(node), 0});
+  }
+
+  template <typename TC, typename T>
+  void planChild(
+      std::vector<std::string>& path,
+      const T& oldRef,
+      const T& newRef,
+      PlanNode& parent) {
+    if constexpr (std::is_same_v<TC, apache::thrift::type_class::structure>) {
+      planNode(path, oldRef, newRef, parent, [&](PlanNode& node) {
+        planStructFields(
+            path, *oldRef->getFields(), *newRef->getFields(), node);
+      });
+      return;
+    } else if constexpr (IsMapTypeClass<TC>::value) {
+      if (std::max(oldRef->size(), newRef->size()) >=
+          options_.minParallelMapSize) {
+        planNode(path, oldRef, newRef, parent, [&](PlanNode& node) {
+          planMapFields<TC>(
+              path, *oldRef->getFields(), *newRef->getFields(), node);
+        });
+        return;
+      }
+    }
+    addVisitLeaf<TC>(path, oldRef, newRef, parent);
+  }
+
+  template <typename Fields>
+  void planStructFields(
+      std::vector<std::string>& path,
+      const Fields& oldFields,
+      const Fields& newFields,
+      PlanNode& node) {
+    using Members = typename Fields::Members;
+
+    fatal::foreach<Members>([&](auto indexed) {
+      using member = decltype(fatal::tag_type(indexed));
+      using name = typename member::name;
+      using tc = typename member::type_class;
+
+      path.emplace_back(fatal::z_data<name>(), fatal::size<name>::value);
+      SCOPE_EXIT {
+        path.pop_back();
+      };
+
+      const auto& oldRef = oldFields.template cref<name>();
+      const auto& newRef = newFields.template cref<name>();
+
+      if (member::optional::value == apache::thrift::optionality::optional) {
+        if (!oldRef && !newRef) {
+          return;
+        } else if (!oldRef || !newRef) {
+          addAddedOrRemovedLeaf<tc>(path, oldRef, newRef, node);
+          return;
+        }
+      }
+
+      if (oldRef != newRef) {
+        planChild<tc>(path, oldRef, newRef, node);
+      }
+    });
+  }
+
+  template <typename TC, typename Fields>
+  void planMapFields(
+      std::vector<std::string>& path,
+      const Fields& oldFields,
+      const Fields& newFields,
+      PlanNode& node) {
+    using MappedTypeClass = typename IsMapTypeClass<TC>::mapped_type_class;
+
+    Fields::diff(
+        oldFields,
+        newFields,
+        [&](const auto& removed) {
+          const auto& [key, val] = removed;
+          path.push_back(folly::to<std::string>(key));
+          addAddedOrRemovedLeaf<MappedTypeClass>(
+              path, val, emptyValue<Fields>(), node);
+          path.pop_back();
+        },
+        [&](const auto& added) {
+          const auto& [key, val] = added;
+          path.push_back(folly::to<std::string>(key));
+          addAddedOrRemovedLeaf<MappedTypeClass>(
+              path, emptyValue<Fields>(), val, node);
+          path.pop_back();
+        },
+        [&](const auto& oldEntry, const auto& newEntry) {
+          if (oldEntry.second == newEntry.second) {
+            return;
+          }
+          path.push_back(folly::to<std::string>(oldEntry.first));
+          addVisitLeaf<MappedTypeClass>(
+              path, oldEntry.second, newEntry.second, node);
+          path.pop_back();
+        });
+  }
+
+  // Leaves visit later on, so they need a null value that outlives them
+  template <typename Fields>
+  static const typename Fields::value_type& emptyValue() {
+    static const typename Fields::value_type empty;
+    return empty;
+  }
+
+  void runLeaves(std::size_t begin, std::size_t end) {
+    for (auto i = begin; i < end; ++i) {
+      auto& leaf = leaves_[i];
+      leaf.hasDifferences = leaf.visit(leaf.results);
+    }
+  }
+
+  void execute() {
+    auto numTasks = std::min(leaves_.size(), options_.numTasks);
+    if (!options_.executor || numTasks <= 1) {
+      runLeaves(0, leaves_.size());
+      return;
+    }
+
+    auto leavesPerTask = (leaves_.size() + numTasks - 1) / numTasks;
+    std::vector<folly::Future<folly::Unit>> tasks;
+    for (std::size_t begin = 0; begin < leaves_.size();
+         begin += leavesPerTask) {
+      auto end = std::min(begin + leavesPerTask, leaves_.size());
+      tasks.push_back(folly::via(options_.executor, [this, begin, end]() {
+        runLeaves(begin, end);
+      }));
+    }
+    // wait for every task before rethrowing, as they all reference leaves_
+    for (auto& result : folly::collectAll(std::move(tasks)).get()) {
+      result.throwIfFailed();
+    }
+  }
+
+  bool merge(PlanNode& node, std::vector<Result>& results) {
+    bool hasDifferences{false};
+    for (auto& child : node.children) {
+      if (child.node) {
+        hasDifferences |= merge(*child.node, results);
+        continue;
+      }
+      auto& leaf = leaves_[child.leaf];
+      hasDifferences |= leaf.hasDifferences;
+      std::move(
+          leaf.results.begin(),
+          leaf.results.end(),
+          std::back_inserter(results));
+    }
+    if (hasDifferences && node.emitSelf) {
+      node.emitSelf(results);
+    }
+    return hasDifferences;
+  }
+
+  const DeltaVisitMode& mode_;
+  const ParallelDeltaVisitOptions& options_;
+  Func& f_;
+  std::vector<Leaf> leaves_;
+};
+
+} // namespace pdv_detail
+
+/*
+ * Parallel version of DeltaVisitor, for diffing large trees.
+ *
+ * f gets called with the same arguments, and in the same order, as with
+ * DeltaVisitor, but from the executor's threads, so it must be safe to
+ * call concurrently. What f returns for each delta gets collected, in
+ * visit order, into the returned vector.
+ */
+template <typename TC>
+struct ParallelDeltaVisitor {
+  template <typename Result, typename Node, typename Func>
+  static std::vector<Result> visit(
+      const std::shared_ptr<Node>& oldNode,
+      const std::shared_ptr<Node>& newNode,
+      const DeltaVisitMode& mode,
+      const ParallelDeltaVisitOptions& options,
+      Func&& f) {
+    pdv_detail::ParallelDeltaVisit<Result, Func> visit(mode, options, f);
+    return visit.template visit<TC>(oldNode, newNode);
+  }
+};
+
+using RootParallelDeltaVisitor =
+    ParallelDeltaVisitor<apache::thrift::type_class::structure>;
+
+} // namespace facebook::fboss::thrift_cow
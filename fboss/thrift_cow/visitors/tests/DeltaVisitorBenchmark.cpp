@@ -0,0 +1,118 @@
+// (c) Facebook, Inc. and its affiliates. Confidential and proprietary.
+
+#include <folly/Benchmark.h>
+#include <folly/String.h>
+#include <folly/executors/CPUThreadPoolExecutor.h>
+#include <folly/init/Init.h>
+
+#include <fboss/thrift_cow/visitors/DeltaVisitor.h>
+#include <fboss/thrift_cow/visitors/ParallelDeltaVisitor.h>
+#include "fboss/fsdb/if/gen-cpp2/fsdb_oper_types.h"
+#include "fboss/thrift_cow/nodes/Types.h"
+#include "fboss/thrift_cow/nodes/tests/gen-cpp2/test_fatal_types.h"
+
+/*
+ * Cost of diffing two large trees that differ in 1% of their entries, as
+ * publishing state deltas to fsdb does: every minimal delta gets its path
+ * joined and its new value encoded.
+ */
+
+using namespace facebook::fboss;
+using namespace facebook::fboss::thrift_cow;
+
+namespace {
+
+using TestStructNode = ThriftStructNode<TestStruct>;
+
+struct Delta {
+  std::string path;
+  folly::fbstring newState;
+};
+
+std::pair<std::shared_ptr<TestStructNode>, std::shared_ptr<TestStructNode>>
+buildTrees(int size) {
+  TestStruct oldStruct;
+  for (int i = 0; i < size; ++i) {
+    cfg::L4PortRange portRange;
+    portRange.min() = i;
+    portRange.max() = i + 100;
+    oldStruct.mapOfI32ToStruct()->emplace(i, portRange);
+    oldStruct.mapOfStringToStruct()->emplace(
+        folly::to<std::string>(i), portRange);
+  }
+  auto newStruct = oldStruct;
+  for (int i = 0; i < size; i += 100) {
+    newStruct.mapOfI32ToStruct()->at(i).max() = i;
+    newStruct.mapOfStringToStruct()->erase(folly::to<std::string>(i));
+  }
+  return {
+      std::make_shared<TestStructNode>(oldStruct),
+      std::make_shared<TestStructNode>(newStruct)};
+}
+
+auto toDelta = [](const std::vector<std::string>& path,
+                  auto&& /*oldNode*/,
+                  auto&& newNode,
+                  DeltaElemTag /*tag*/) {
+  Delta delta;
+  delta.path = folly::join('/', path);
+  if (newNode) {
+    delta.newState = newNode->encode(fsdb::OperProtocol::BINARY);
+  }
+  return delta;
+};
+
+void diff(unsigned iters, int size, int numThreads) {
+  folly::BenchmarkSuspender suspender;
+  auto [oldNode, newNode] = buildTrees(size);
+  std::unique_ptr<folly::CPUThreadPoolExecutor> executor;
+  ParallelDeltaVisitOptions options;
+  if (numThreads) {
+    executor = std::make_unique<folly::CPUThreadPoolExecutor>(numThreads);
+    options.executor = executor.get();
+    options.numTasks = numThreads * 4;
+  }
+  suspender.dismiss();
+
+  for (unsigned i = 0; i < iters; ++i) {
+    if (!numThreads) {
+      std::vector<Delta> deltas;
+      RootDeltaVisitor::visit(
+          oldNode, newNode, DeltaVisitMode::MINIMAL, [&](auto&&... args) {
+            deltas.push_back(toDelta(args...));
+          });
+      folly::doNotOptimizeAway(deltas);
+    } else {
+      folly::doNotOptimizeAway(RootParallelDeltaVisitor::visit<Delta>(
+          oldNode, newNode, DeltaVisitMode::MINIMAL, options, toDelta));
+    }
+  }
+  suspender.rehire();
+}
+
+} // namespace
+
+void sequentialDelta(unsigned iters, int size) {
+  diff(iters, size, 0);
+}
+
+void parallelDelta4(unsigned iters, int size) {
+  diff(iters, size, 4);
+}
+
+void parallelDelta16(unsigned iters, int size) {
+  diff(iters, size, 16);
+}
+
+BENCHMARK_PARAM(sequentialDelta, 10000);
+BENCHMARK_RELATIVE_PARAM(parallelDelta4, 10000);
+BENCHMARK_RELATIVE_PARAM(parallelDelta16, 10000);
+BENCHMARK_PARAM(sequentialDelta, 100000);
+BENCHMARK_RELATIVE_PARAM(parallelDelta4, 100000);
+BENCHMARK_RELATIVE_PARAM(parallelDelta16, 100000);
+
+int main(int argc, char** argv) {
+  folly::init(&argc, &argv, true);
+  folly::runBenchmarks();
+  return 0;
+}
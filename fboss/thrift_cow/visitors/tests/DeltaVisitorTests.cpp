@@ -2,11 +2,13 @@
 
 #include <folly/String.h>
 #include <folly/dynamic.h>
+#include <folly/executors/CPUThreadPoolExecutor.h>
 #include <folly/logging/xlog.h>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include <fboss/thrift_cow/visitors/DeltaVisitor.h>
+#include <fboss/thrift_cow/visitors/ParallelDeltaVisitor.h>
 #include <thrift/lib/cpp2/reflection/folly_dynamic.h>
 #include "fboss/thrift_cow/nodes/Types.h"
 #include "fboss/thrift_cow/nodes/tests/gen-cpp2/test_fatal_types.h"
@@ -658,3 +660,60 @@ TEST(DeltaVisitorTests, SwitchVariantFieldToStruct) {
               "/inlineVariant/inlineStruct/invert",
               DeltaElemTag::NOT_MINIMAL)}));
 }
+
+TEST(DeltaVisitorTests, ParallelMatchesSequential) {
+  using namespace facebook::fboss::thrift_cow;
+
+  auto structA = createTestStruct();
+  for (int i = 0; i < 1000; ++i) {
+    cfg::L4PortRange portRange;
+    portRange.min() = i;
+    portRange.max() = i + 100;
+    structA.mapOfI32ToStruct()->emplace(i, std::move(portRange));
+  }
+  auto structB = structA;
+  structB.inlineInt() = 99;
+  structB.optionalString().reset();
+  for (int i = 0; i < 1000; i += 7) {
+    structB.mapOfI32ToStruct()->at(i).max() = 0;
+  }
+  for (int i = 1; i < 1000; i += 50) {
+    structB.mapOfI32ToStruct()->erase(i);
+  }
+  for (int i = 1000; i < 1010; ++i) {
+    structB.mapOfI32ToStruct()->emplace(i, cfg::L4PortRange());
+  }
+
+  auto nodeA = std::make_shared<ThriftStructNode<TestStruct>>(structA);
+  auto nodeB = std::make_shared<ThriftStructNode<TestStruct>>(structB);
+
+  using PathTag = std::pair<std::string, DeltaElemTag>;
+  auto toPathTag = [](std::vector<std::string>& path,
+                      auto&& /*oldValue*/,
+                      auto&& /*newValue*/,
+                      auto&& tag) {
+    return std::make_pair("/" + folly::join('/', path), tag);
+  };
+
+  folly::CPUThreadPoolExecutor executor(4);
+  ParallelDeltaVisitOptions options;
+  options.executor = &executor;
+  options.minParallelMapSize = 100;
+
+  for (auto mode :
+       {DeltaVisitMode::PARENTS,
+        DeltaVisitMode::MINIMAL,
+        DeltaVisitMode::FULL}) {
+    std::vector<PathTag> expected;
+    auto result = RootDeltaVisitor::visit(
+        nodeA, nodeB, mode, [&](auto&&... args) {
+          expected.push_back(toPathTag(args...));
+        });
+    EXPECT_EQ(result, true);
+
+    // same deltas, in the same order
+    auto deltas = RootParallelDeltaVisitor::visit<PathTag>(
+        nodeA, nodeB, mode, options, toPathTag);
+    EXPECT_THAT(deltas, ::testing::ContainerEq(expected));
+  }
+}
@@ -269,6 +269,10 @@ DEFINE_string(module_type, "", "specify the module type, ie: finisar-200g");
 DEFINE_string(fw_version, "", "specify the firmware version, ie: 7.8 or ca.f8");
 DEFINE_string(port_range, "", "specify the port range, ie: 1,3,5-8");
 DEFINE_bool(dsp_image, false, "if this is a DSP firmware image");
+DEFINE_int32(
+    fw_upgrades_per_controller,
+    1,
+    "Number of modules on one i2c controller downloading the firmware at the same time, use with --update_bulk_module_fw. Values above 1 pipeline the CDB downloads of a controller");
 DEFINE_bool(
     client_parser,
     false,
@@ -351,12 +355,6 @@ std::vector<unsigned int> getUpgradeModList(
     std::string moduleType,
     std::string fwVer);
 
-void fwUpgradeThreadHandler(
-    TransceiverI2CApi* bus,
-    std::vector<unsigned int> modlist,
-    std::string firmwareFilename,
-    uint32_t imageHdrLen);
-
 std::ostream& operator<<(std::ostream& os, const FlagCommand& cmd) {
   gflags::CommandLineFlagInfo flagInfo;
 
@@ -2617,16 +2615,18 @@ bool cliModulefirmwareUpgrade(
  * create separate buckets of optics for upgrade. Then the threads are created
  * for each bucket and each thread takes care of upgrading the optics in that
  * bucket. The idea here is that one thread will take care of upgrading the
- * optics belonging to one controller so that two ports of the same controller
- * can't upgrade at the same time whereas multiple ports belonging to
- * different controller can upgrade at the same time. This function waits for
- * all threads to finish.
+ * optics belonging to one controller so that the i2c transactions of the
+ * ports of the same controller don't compete whereas multiple ports belonging
+ * to different controller can upgrade at the same time. Within a bucket, one
+ * optic is upgraded at a time by default. With --fw_upgrades_per_controller
+ * above 1, that many optics download at the same time, the thread writing
+ * the image to one while the others run their CDB commands.
+ * This function waits for all threads to finish.
  */
 bool cliModulefirmwareUpgrade(
     DirectI2cInfo i2cInfo,
     std::string portRangeStr,
     std::string firmwareFilename) {
-  std::vector<std::thread> threadList;
   std::vector<std::vector<unsigned int>> bucket;
 
   // Check if the filename is specified
@@ -2692,63 +2692,28 @@ bool cliModulefirmwareUpgrade(
     }
   }
 
-  // Create threads one for each bucket row and do the upgrade there
-  for (auto& bucketrow : bucket) {
-    std::thread tHandler(
-        fwUpgradeThreadHandler,
-        i2cInfo.bus,
-        bucketrow,
-        firmwareFilename,
-        imageHdrLen);
-    threadList.push_back(std::move(tHandler));
-  }
-
-  // Wait for all threads to finish
-  for (auto& tHandler : threadList) {
-    tHandler.join();
-  }
-
-  printf("Firmware upgrade done on some of the modules");
-  printf(
-      "Check the status using: wedge_qsfp_util --get_module_fw_info <portA> <portB>\n");
-  printf("Pl reload the chassis to finish the firmware upgrade last step\n");
-  return true;
-}
+  // Create FbossFirmware object using firmware filename and msa password,
+  // header length as properties
+  FbossFirmware::FwAttributes firmwareAttr;
+  firmwareAttr.filename = firmwareFilename;
+  firmwareAttr.properties["msa_password"] =
+      folly::to<std::string>(FLAGS_msa_password);
+  firmwareAttr.properties["header_length"] =
+      folly::to<std::string>(imageHdrLen);
+  firmwareAttr.properties["image_type"] =
+      FLAGS_dsp_image ? "dsp" : "application";
+  auto fbossFwObj = std::make_unique<FbossFirmware>(firmwareAttr);
 
-/*
- * fwUpgradeThreadHandler
- *
- * This is Entry function for the thread which will do the firmware upgrade
- * operation. This function gets the list of optics as an argument. It will do
- * fw upgrade on all these modules one by one in this thread context.
- */
-void fwUpgradeThreadHandler(
-    TransceiverI2CApi* bus,
-    std::vector<unsigned int> modlist,
-    std::string firmwareFilename,
-    uint32_t imageHdrLen) {
-  std::array<uint8_t, 2> versionNumber;
+  // Upgrade the modules of every bucket in a thread of its own, pipelining
+  // the upgrade of the modules in it
+  CmisMultiModuleFirmwareUpgrader::Options options;
+  options.maxModulesPerController = FLAGS_fw_upgrades_per_controller;
+  CmisMultiModuleFirmwareUpgrader fwUpgrader(
+      i2cInfo.bus, bucket, std::move(fbossFwObj), options);
+  fwUpgrader.upgrade();
 
-  for (auto module : modlist) {
-    // Create FbossFirmware object using firmware filename and msa password,
-    // header length as properties
-    FbossFirmware::FwAttributes firmwareAttr;
-    firmwareAttr.filename = firmwareFilename;
-    firmwareAttr.properties["msa_password"] =
-        folly::to<std::string>(FLAGS_msa_password);
-    firmwareAttr.properties["header_length"] =
-        folly::to<std::string>(imageHdrLen);
-    firmwareAttr.properties["image_type"] =
-        FLAGS_dsp_image ? "dsp" : "application";
-    auto fbossFwObj = std::make_unique<FbossFirmware>(firmwareAttr);
-
-    auto fwUpgradeObj = std::make_unique<CmisFirmwareUpgrader>(
-        bus, module, std::move(fbossFwObj));
-
-    // Do the upgrade in this thread
-    bool ret = fwUpgradeObj->cmisModuleFirmwareUpgrade();
-
-    if (ret) {
+  for (const auto& [module, progress] : fwUpgrader.getProgress()) {
+    if (progress.step == ModuleUpgradeStep::DONE) {
       printf(
           "Firmware download successful for module %d, the module is running desired firmware\n",
           module);
@@ -2759,7 +2724,8 @@ void fwUpgradeThreadHandler(
     }
 
     // Find out the current version running on module
-    bus->moduleRead(
+    std::array<uint8_t, 2> versionNumber;
+    i2cInfo.bus->moduleRead(
         module, {TransceiverI2CApi::ADDR_QSFP, 39, 2}, versionNumber.data());
     printf(
         "cmisModuleFirmwareUpgrade: Mod%d: Module Active Firmware Revision now: %d.%d\n",
@@ -2767,6 +2733,12 @@ void fwUpgradeThreadHandler(
         versionNumber[0],
         versionNumber[1]);
   }
+
+  printf("Firmware upgrade done on some of the modules");
+  printf(
+      "Check the status using: wedge_qsfp_util --get_module_fw_info <portA> <portB>\n");
+  printf("Pl reload the chassis to finish the firmware upgrade last step\n");
+  return true;
 }
 
 /*
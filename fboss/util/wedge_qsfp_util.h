@@ -4,6 +4,7 @@
 #include "fboss/agent/types.h"
 #include "fboss/lib/firmware_storage/FbossFirmware.h"
 #include "fboss/lib/i2c/FirmwareUpgrader.h"
+#include "fboss/lib/i2c/MultiModuleFirmwareUpgrader.h"
 #include "fboss/lib/usb/TransceiverI2CApi.h"
 #include "fboss/lib/usb/TransceiverPlatformApi.h"
 #include "fboss/lib/usb/TransceiverPlatformI2cApi.h"